@@ -62,6 +62,7 @@
 #include "Core/FontEffectInstancer.h"
 #include "Core/FontEngineInterface.h"
 #include "Core/FontGlyph.h"
+#include "Core/FrameProfiler.h"
 #include "Core/Geometry.h"
 #include "Core/Header.h"
 #include "Core/ID.h"
@@ -72,6 +73,7 @@
 #include "Core/MeshUtilities.h"
 #include "Core/NumericValue.h"
 #include "Core/Plugin.h"
+#include "Core/PreparedDocument.h"
 #include "Core/PropertiesIteratorView.h"
 #include "Core/Property.h"
 #include "Core/PropertyDefinition.h"
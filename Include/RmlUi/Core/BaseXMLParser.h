@@ -31,16 +31,31 @@
 
 #include "Dictionary.h"
 #include "Header.h"
+#include "Span.h"
 #include "Types.h"
 
 namespace Rml {
 
 class Stream;
+class StringView;
 class URL;
 using XMLAttributes = Dictionary;
 
 enum class XMLDataType { Text, CData, InnerXML };
 
+/// A node recorded while parsing an XML file, which can later be submitted to the handlers without parsing the file again.
+struct XMLParsedNode {
+	enum class Type { ElementStart, ElementEnd, Data };
+	Type type = Type::Data;
+	XMLDataType data_type = XMLDataType::Text;
+	// The line number in the source file where the node was encountered.
+	int line_number = 0;
+	// The tag name of elements, or the data contents.
+	String value;
+	XMLAttributes attributes;
+};
+using XMLParsedNodeList = Vector<XMLParsedNode>;
+
 /**
     @author Peter Curry
  */
@@ -66,6 +81,14 @@ public:
 	/// Parses the given stream as an XML file, and calls the handlers when
 	/// interesting phenomena are encountered.
 	void Parse(Stream* stream);
+	/// Parses the given stream as an XML file, and records the nodes instead of calling the handlers.
+	/// @param[in] stream The stream to parse.
+	/// @param[out] nodes The parsed nodes, in the order they were encountered.
+	void ParseNodes(Stream* stream, XMLParsedNodeList& nodes);
+	/// Calls the handlers for previously parsed nodes, as if parsing the XML file they were recorded from.
+	/// @param[in] nodes The parsed nodes, in the order they were encountered.
+	/// @param[in] source_url The source URL of the file the nodes were recorded from.
+	void HandleNodes(Span<const XMLParsedNode> nodes, const URL& source_url);
 
 	/// Get the line number in the stream.
 	/// @return The line currently being processed in the XML stream.
@@ -86,6 +109,9 @@ protected:
 private:
 	const URL* source_url = nullptr;
 	String xml_source;
+
+	// When set, the nodes are recorded here instead of calling the handlers.
+	XMLParsedNodeList* parsed_nodes = nullptr;
 	size_t xml_index = 0;
 
 	void Next();
@@ -105,12 +131,12 @@ private:
 	bool ReadCDATA(const char* tag_terminator = nullptr);
 
 	// Reads from the stream until a complete word is found.
-	// @param[out] word Word thats been found
+	// @param[out] word Word thats been found, as a view into the source
 	// @param[in] terminators List of characters that terminate the search
-	bool FindWord(String& word, const char* terminators = nullptr);
+	bool FindWord(StringView& word, const char* terminators = nullptr);
 	// Reads from the stream until the given character set is found. All
-	// intervening characters will be returned in data.
-	bool FindString(const char* string, String& data, bool escape_brackets = false);
+	// intervening characters will be returned in data, as a view into the source.
+	bool FindString(const char* string, StringView& data, bool escape_brackets = false);
 	// Returns true if the next sequence of characters in the stream
 	// matches the given string. If consume is set and this returns true,
 	// the characters will be consumed.
@@ -125,7 +151,7 @@ private:
 	int inner_xml_data_terminate_depth = 0;
 	size_t inner_xml_data_index_begin = 0;
 
-	// The element attributes being read.
+	// The element attributes being read, reused between tags to avoid reallocating them.
 	XMLAttributes attributes;
 	// The loose data being read.
 	String data;
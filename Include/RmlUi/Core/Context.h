@@ -41,6 +41,7 @@ namespace Rml {
 class Stream;
 class ContextInstancer;
 class ElementDocument;
+class PreparedDocument;
 class EventListener;
 class DataModel;
 class DataModelConstructor;
@@ -52,6 +53,10 @@ enum class EventId : uint16_t;
 /**
     A context for storing, rendering and processing RML documents. Multiple contexts can exist simultaneously.
 
+    Independent contexts may be updated and rendered in parallel, each on at most one thread at a time, as long as every such context uses its
+    own render interface. Creating and destroying contexts, loading documents, and modifying the global registries such as the factory
+    instancers, node handlers, plugins, and the style sheet specification, must only be done while no context is being updated or rendered.
+
     @author Peter Curry
  */
 
@@ -106,6 +111,10 @@ public:
 	/// @param[in] source_url Optional string used to set the document's source URL, or naming the document for log messages.
 	/// @return The loaded document, or nullptr if no document was loaded.
 	ElementDocument* LoadDocumentFromMemory(const String& document_rml, const String& source_url = "[document from memory]");
+	/// Load a prepared document into the context.
+	/// @param[in] prepared_document The document prepared by Rml::PrepareDocument, its style sheets are shared with the loaded document.
+	/// @return The loaded document, or nullptr if no document was loaded.
+	ElementDocument* LoadDocument(const PreparedDocument& prepared_document);
 	/// Unload the given document.
 	/// @param[in] document The document to unload.
 	/// @note The destruction of the document is deferred until the next call to Context::Update().
@@ -408,6 +417,8 @@ private:
 	// Builds the parameters for a drag event.
 	void GenerateDragEventParameters(Dictionary& parameters);
 
+	// Adds a newly instanced document to the context, and dispatches its load notifications.
+	ElementDocument* AddLoadedDocument(ElementPtr document);
 	// Releases all unloaded documents pending destruction.
 	void ReleaseUnloadedDocuments();
 
@@ -38,6 +38,7 @@ namespace Rml {
 
 class Plugin;
 class Context;
+class PreparedDocument;
 class FileInterface;
 class FontEngineInterface;
 class RenderInterface;
@@ -94,7 +95,8 @@ RMLUICORE_API FontEngineInterface* GetFontEngineInterface();
 /// Creates a new element context.
 /// @param[in] name The new name of the context. This must be unique.
 /// @param[in] dimensions The initial dimensions of the new context.
-/// @param[in] render_interface The custom render interface to use, or nullptr to use the default.
+/// @param[in] render_interface The custom render interface to use, or nullptr to use the default. Contexts which are updated and rendered in
+///                             parallel on different threads must each use their own render interface.
 /// @lifetime If specified, the render interface must be kept alive until after the call to Rml::Shutdown. Alternatively, the render interface can be
 ///           destroyed after all contexts it belongs to have been destroyed and a subsequent call has been made to Rml::ReleaseTextures.
 /// @return A non-owning pointer to the new context, or nullptr if the context could not be created.
@@ -115,6 +117,20 @@ RMLUICORE_API Context* GetContext(int index);
 /// @return The total number of active RmlUi contexts.
 RMLUICORE_API int GetNumContexts();
 
+/// Prepares a document for loading by reading and parsing it, and loading its style sheets and templates, without instancing any elements.
+/// Can be called from any thread, also while contexts are being updated and rendered. The document is then loaded into a context by
+/// calling Context::LoadDocument with the prepared document, which must be done on the thread updating the context.
+/// @param[in] document_path The path to the document to prepare. The path is passed directly to the file interface which is used to load the file.
+/// @return The prepared document, or nullptr if the document could not be read.
+/// @note When called from a different thread, the file interface and the system interface must be safe to call from that thread.
+RMLUICORE_API UniquePtr<PreparedDocument> PrepareDocument(const String& document_path);
+/// Prepares a document for loading from a string, see Rml::PrepareDocument.
+/// @param[in] document_rml The string containing the document RML.
+/// @param[in] source_url Optional string used to set the document's source URL, or naming the document for log messages.
+/// @return The prepared document.
+RMLUICORE_API UniquePtr<PreparedDocument> PrepareDocumentFromMemory(const String& document_rml,
+	const String& source_url = "[document from memory]");
+
 /// Adds a new font face to the font engine. The face's family, style and weight will be determined from the face itself.
 /// @param[in] file_path The path to the file to load the face from. The path is passed directly to the file interface which is used to load the file.
 /// The default file interface accepts both absolute paths and paths relative to the working directory.
@@ -166,6 +182,12 @@ RMLUICORE_API void ReleaseCompiledGeometry(RenderInterface* render_interface = n
 /// Releases unused font textures and rendered glyphs to free up memory, and regenerates actively used fonts.
 /// @note Invalidates all existing FontFaceHandles returned from the font engine.
 RMLUICORE_API void ReleaseFontResources();
+/// Renders the glyphs of all font sizes at or above the given size from signed distance fields in the default font engine. Each glyph is then
+/// rasterized only once and scaled to all such sizes, and outlines and glows are generated from its distance field. This greatly reduces the
+/// cost of using many different font sizes, such as in zoomable interfaces, at the expense of font hinting.
+/// @param[in] font_size The smallest font size to render from distance fields, or zero to disable distance fields (default).
+/// @note Releases the font resources to apply the setting. Has no effect when using a custom font engine.
+RMLUICORE_API void SetFontDistanceFieldThreshold(int font_size);
 
 /// Forces all memory pools used by RmlUi to be released.
 RMLUICORE_API void ReleaseMemoryPools();
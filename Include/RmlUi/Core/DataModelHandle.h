@@ -48,6 +48,12 @@ public:
 	void DirtyVariable(const String& variable_name);
 	void DirtyAllVariables();
 
+	// Limit the number of data views updated during each context update, remaining views are carried over to the next update.
+	// @param[in] max_views The maximum number of views updated per context update, or zero for no limit.
+	void SetMaxViewsPerUpdate(int max_views);
+	// Returns the number of data views updated during the last update of the data model.
+	int GetNumViewsUpdated() const;
+
 	explicit operator bool() { return model; }
 
 private:
@@ -127,6 +133,11 @@ public:
 		type_register->GetTransformFuncRegister()->Register(name, std::move(transform_func));
 	}
 
+	// Set whether text views with only numeric values are translated, enabled by default.
+	// When disabled, text nodes consisting solely of whitespace and data expressions evaluating to numbers are not passed through
+	// 'SystemInterface::TranslateString' whenever their value changes. Useful for frequently updated counters and timers.
+	void SetTranslateNumericText(bool translate);
+
 	// Returns the type register.
 	// The type register contains VariableDefinitions of all the data types registered to this data model's owning context.
 	DataTypeRegister* GetDataTypeRegister() const { return type_register; }
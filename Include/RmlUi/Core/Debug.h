@@ -120,8 +120,8 @@ struct RmlUiAssertNonrecursive {
 	~RmlUiAssertNonrecursive() { entered = false; }
 };
 
-	#define RMLUI_ASSERT_NONRECURSIVE                   \
-		static bool rmlui_nonrecursive_entered = false; \
+	#define RMLUI_ASSERT_NONRECURSIVE                                \
+		static thread_local bool rmlui_nonrecursive_entered = false; \
 		RmlUiAssertNonrecursive rmlui_nonrecursive(rmlui_nonrecursive_entered)
 
 #endif // RMLUI_DEBUG
@@ -55,6 +55,7 @@ class ElementDefinition;
 class ElementDocument;
 class ElementScroll;
 class ElementStyle;
+class ElementUtilities;
 class ContainerBox;
 class InlineLevelBox;
 class ReplacedBox;
@@ -64,8 +65,11 @@ class RenderManager;
 class StyleSheet;
 class StyleSheetContainer;
 class TransformState;
+struct ElementColdMeta;
 struct ElementMeta;
+struct ElementMemoryUsage;
 struct StackingContextChild;
+enum class StyleSheetInvalidation : uint8_t;
 
 /**
     A generic element in the DOM tree.
@@ -662,6 +666,8 @@ protected:
 	enum class DirtyNodes { Self, SelfAndSiblings };
 	// Dirty the element style definition, including all descendants of the specificed nodes.
 	void DirtyDefinition(DirtyNodes dirty_nodes);
+	// Dirty the style definitions of the elements affected by a name change on this element, as given by the style sheet's invalidation sets.
+	void DirtyDefinition(StyleSheetInvalidation invalidation);
 
 	void SetOwnerDocument(ElementDocument* document);
 
@@ -692,6 +698,14 @@ private:
 	void OnDpRatioChangeRecursive();
 	void DirtyFontFaceRecursive();
 
+	/// Returns the element's id as an atom, or 'Atom::Invalid' if no selector refers to it.
+	Atom GetIdAtom() const;
+
+	/// Returns the cold meta data, allocating it if necessary.
+	ElementColdMeta& GetColdMeta() const;
+	/// Adds the memory used by this element, excluding its children, to the given usage report.
+	void AddMemoryUsage(ElementMemoryUsage& usage) const;
+
 	/// Start an animation, replacing any existing animations of the same property name. If start_value is null, the element's current value is used.
 	ElementAnimationList::iterator StartAnimation(PropertyId property_id, const Property* start_value, int num_iterations, bool alternate_direction,
 		float delay, bool initiated_by_animation_property);
@@ -726,6 +740,7 @@ private:
 
 	bool dirty_definition : 1; // Implies dirty child definitions as well.
 	bool dirty_child_definitions : 1;
+	bool dirty_own_definition : 1; // Only this element's definition needs to be updated, not its descendants.
 
 	bool dirty_animation : 1;
 	bool dirty_transition : 1;
@@ -738,11 +753,15 @@ private:
 	// Defines what box area represents the element's client area; this is usually padding, but may be content.
 	BoxArea client_area;
 
-	// Original tag this element came from.
-	String tag;
+	// Original tag this element came from, interned.
+	Atom tag;
 
 	// The optional, unique ID of this object.
 	String id;
+	// The id as an atom for selector matching, or 'Atom::Invalid' when no selector uses it, along with the size of the atom table at the time
+	// of lookup. Ids are looked up rather than interned, so that ids generated at runtime do not grow the atom table.
+	mutable Atom id_atom;
+	mutable size_t id_atom_table_size;
 
 	// Instancer that created us, used for destruction.
 	ElementInstancer* instancer;
@@ -769,14 +788,8 @@ private:
 	// The offset this element adds to its logical children due to scrolling content.
 	Vector2f scroll_offset;
 
-	// The size of the element.
-	struct PositionedBox {
-		Box box;
-		Vector2f offset;
-	};
-	using PositionedBoxList = Vector<PositionedBox>;
+	// The size of the element. Any additional boxes, such as for inline elements split across lines, are stored in the cold meta data.
 	Box main_box;
-	PositionedBoxList additional_boxes;
 
 	// And of the element's scrollable content.
 	Vector2f scrollable_overflow_rectangle;
@@ -790,7 +803,10 @@ private:
 
 	ElementAnimationList animations;
 
+	// Meta data needed by every element.
 	ElementMeta* meta;
+	// Meta data needed only by some elements, such as effects and event attributes. Allocated on first use.
+	mutable ElementColdMeta* cold_meta;
 
 	friend class Rml::Context;
 	friend class Rml::ElementStyle;
@@ -798,6 +814,7 @@ private:
 	friend class Rml::InlineLevelBox;
 	friend class Rml::ReplacedBox;
 	friend class Rml::ElementScroll;
+	friend class Rml::ElementUtilities;
 	friend RMLUICORE_API void Rml::ReleaseFontResources();
 };
 
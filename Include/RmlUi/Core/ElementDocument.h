@@ -185,6 +185,9 @@ private:
 	// The document's style sheet container.
 	SharedPtr<StyleSheetContainer> style_sheet_container;
 
+	// Style sheets loaded ahead of time from a prepared document, consumed when the header is processed.
+	SharedPtr<StyleSheetContainer> prepared_style_sheet_container;
+
 	Context* context;
 
 	// Is the current display modal
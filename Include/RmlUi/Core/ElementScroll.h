@@ -73,6 +73,9 @@ public:
 	/// @param[in] orientation Which scrollbar (vertical or horizontal) to query.
 	/// @return The size of the scrollbar, or 0 if the scrollbar is disabled.
 	float GetScrollbarSize(Orientation orientation);
+	/// Returns true if one of the scrollbars is enabled.
+	/// @param[in] orientation Which scrollbar (vertical or horizontal) to query.
+	bool IsScrollbarEnabled(Orientation orientation) const;
 
 	/// Formats the enabled scrollbars based on the current size of the host element.
 	void FormatScrollbars();
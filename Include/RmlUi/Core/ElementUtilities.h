@@ -41,6 +41,25 @@ namespace Style {
 	class ComputedValues;
 }
 
+/**
+    Approximate memory footprint of a hierarchy of elements, see ElementUtilities::GetMemoryUsage().
+ */
+struct ElementMemoryUsage {
+	int num_elements = 0;
+	// Number of elements which have allocated their cold meta data, such as for effects, event attributes, or split inline boxes.
+	int num_elements_with_cold_meta = 0;
+
+	// Base element objects along with the meta data allocated for every element.
+	size_t element_bytes = 0;
+	// Lazily allocated meta data.
+	size_t cold_meta_bytes = 0;
+	// Approximate heap usage of children, stacking context, animation, and attribute containers.
+	size_t container_bytes = 0;
+
+	size_t GetTotalBytes() const { return element_bytes + cold_meta_bytes + container_bytes; }
+	size_t GetBytesPerElement() const { return num_elements > 0 ? GetTotalBytes() / size_t(num_elements) : 0; }
+};
+
 /**
     Utility functions for dealing with elements.
 
@@ -142,6 +161,11 @@ public:
 	/// Right now, this only applies to the 'data-for' view.
 	/// @return True if a data view was constructed.
 	static bool ApplyStructuralDataViews(Element* element, const String& inner_rml);
+
+	/// Reports the approximate memory used by an element and all of its descendants, including non-DOM children.
+	/// @param[in] element The root element of the hierarchy to measure.
+	/// @return The accumulated memory usage.
+	static ElementMemoryUsage GetMemoryUsage(Element* element);
 };
 
 } // namespace Rml
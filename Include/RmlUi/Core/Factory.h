@@ -51,6 +51,7 @@ class FontEffect;
 class FontEffectInstancer;
 class Filter;
 class FilterInstancer;
+class PreparedDocument;
 class StyleSheetContainer;
 class PropertyDictionary;
 class PropertySpecification;
@@ -118,6 +119,17 @@ public:
 	/// @param[in] document_base_tag The tag used to wrap the document, eg. 'rml'.
 	/// @return The instanced document, or nullptr if an error occurred.
 	static ElementPtr InstanceDocumentStream(Context* context, Stream* stream, const String& document_base_tag);
+	/// Prepares a document from a stream, without instancing any elements.
+	/// @param[in] stream The stream to read the document from.
+	/// @return The prepared document, or nullptr if an error occurred.
+	/// @note Can be called from any thread.
+	static UniquePtr<PreparedDocument> PrepareDocumentStream(Stream* stream);
+	/// Instances a previously prepared document.
+	/// @param[in] context The context that is creating the document.
+	/// @param[in] prepared_document The prepared document to instance from.
+	/// @param[in] document_base_tag The tag used to wrap the document, eg. 'rml'.
+	/// @return The instanced document, or nullptr if an error occurred.
+	static ElementPtr InstanceDocument(Context* context, const PreparedDocument& prepared_document, const String& document_base_tag);
 
 	/// Registers a non-owning pointer to an instancer that will be used to instance decorators.
 	/// @param[in] name The name of the decorator the instancer will be called for.
@@ -83,6 +83,11 @@ protected:
 	// Helper function to copy the alpha value to the colour channels for each pixel, assuming RGBA-ordered bytes, resulting in a grayscale texture.
 	static void FillColorValuesFromAlpha(byte* destination, Vector2i dimensions, int stride);
 
+	// Helper function to write the alpha values of the glyph dilated by the given width, using the glyph's distance field. The glyph's bitmap is
+	// placed at the given offset in the destination. Returns false without writing anything if the distance field cannot resolve the width.
+	static bool DilateGlyphFromDistanceField(byte* destination, Vector2i dimensions, int stride, ColorFormat color_format, const FontGlyph& glyph,
+		Vector2i glyph_offset, int width);
+
 private:
 	Layer layer;
 
@@ -37,6 +37,26 @@
 
 namespace Rml {
 
+/**
+    Statistics of the font face handles held by a font engine, for monitoring its memory usage and cache efficiency.
+ */
+struct FontEngineStatistics {
+	/// The number of times a font face handle was used with its resources, such as rendered glyphs, already available.
+	uint64_t handle_hits = 0;
+	/// The number of times the resources of a font face handle had to be generated, either for a new handle or after being released.
+	uint64_t handle_misses = 0;
+	/// The number of times the resources of a font face handle were released to stay within the memory budget.
+	uint64_t handle_evictions = 0;
+
+	/// The number of font face handles, and the number of them currently holding their resources.
+	int num_handles = 0;
+	int num_loaded_handles = 0;
+
+	/// The estimated memory used by the resources of all font face handles, including any distance fields, and the memory budget, in bytes.
+	size_t memory_usage = 0;
+	size_t memory_budget = 0;
+};
+
 /**
     The abstract base class for an application-specific font engine implementation.
 
@@ -123,9 +143,24 @@ public:
 	/// @return The version required for using any geometry generated with the face handle.
 	virtual int GetVersion(FontFaceHandle handle);
 
+	/// Called by RmlUi when a context begins rendering, before any string geometry is generated during the render. Can be used to keep track of
+	/// which resources are still in use.
+	virtual void PrepareRender();
+
 	/// Called by RmlUi when it wants to garbage collect memory used by fonts.
 	/// @note All existing FontFaceHandles and FontEffectsHandles are considered invalid after this call.
 	virtual void ReleaseFontResources();
+
+	/// Called by the application to limit the memory used by font face handles, such as for their rendered glyphs and textures. When the budget
+	/// is exceeded, the resources of the least recently used handles are released, to be generated again if they are used later on. Resources
+	/// used during the last couple of renders are kept, thus the budget may be temporarily exceeded.
+	/// @param[in] bytes The memory budget in bytes, or zero for no limit.
+	/// @note Font face handles and font effects handles remain valid when their resources are released.
+	virtual void SetMemoryBudget(size_t bytes);
+
+	/// Called by the application to retrieve statistics of the font face handles.
+	/// @return The current statistics, or empty statistics if not supported by the font engine.
+	virtual FontEngineStatistics GetStatistics();
 };
 
 } // namespace Rml
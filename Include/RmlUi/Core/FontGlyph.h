@@ -33,6 +33,20 @@
 
 namespace Rml {
 
+/**
+    Signed distance field of a glyph, rendered once at a reference size and shared between all sizes of the glyph.
+ */
+
+struct FontGlyphDistanceField {
+	/// Distance values, with 128 on the edge of the glyph and increasing towards its inside.
+	UniquePtr<byte[]> data;
+	Vector2i dimensions;
+	/// The position of the field's top-left corner relative to the glyph's origin on the baseline, in field pixels with the y-axis pointing down.
+	Vector2i origin;
+	/// The distance in field pixels represented by a difference of 128 in the distance values.
+	float spread = 0.f;
+};
+
 /**
     Metrics and bitmap data for a single glyph within a font face.
 
@@ -41,7 +55,10 @@ namespace Rml {
 
 class RMLUICORE_API FontGlyph {
 public:
-	FontGlyph() : dimensions(0, 0), bearing(0, 0), advance(0), bitmap_data(nullptr), bitmap_dimensions(0, 0), color_format(ColorFormat::A8) {}
+	FontGlyph() :
+		dimensions(0, 0), bearing(0, 0), advance(0), bitmap_data(nullptr), bitmap_dimensions(0, 0), color_format(ColorFormat::A8),
+		distance_field(nullptr), distance_field_scale(1.f)
+	{}
 
 	/// The glyph's bounding box. Not to be confused with the dimensions of the glyph's bitmap!
 	Vector2i dimensions;
@@ -61,6 +78,26 @@ public:
 	// bitmap_data may point to this member or another font glyph data.
 	UniquePtr<byte[]> bitmap_owned_data;
 
+	/// The signed distance field the bitmap was generated from, or nullptr if the glyph was rendered directly.
+	const FontGlyphDistanceField* distance_field;
+	/// The number of bitmap pixels per distance field pixel.
+	float distance_field_scale;
+
+	/// Returns the signed distance from the given position to the edge of the glyph, positive inside the glyph. Requires a distance field.
+	/// @param[in] position The position relative to the top-left corner of the glyph's bitmap, in bitmap pixels.
+	/// @return The distance in bitmap pixels, limited to the maximum edge distance.
+	float GetEdgeDistance(Vector2f position) const;
+	/// Returns the largest distance from the edge of the glyph that can be resolved, or zero if the glyph has no distance field.
+	float GetMaxEdgeDistance() const;
+	/// Writes the anti-aliased coverage of the glyph from its distance field, optionally dilated. Requires a distance field.
+	/// @param[out] destination The destination data, only its alpha channel is written to.
+	/// @param[in] dimensions The dimensions of the destination.
+	/// @param[in] stride The stride of the destination, in bytes.
+	/// @param[in] color_format The format of the destination.
+	/// @param[in] offset The position of the top-left corner of the glyph's bitmap in the destination.
+	/// @param[in] dilation The distance to grow the glyph by, in pixels.
+	void GenerateCoverage(byte* destination, Vector2i dimensions, int stride, ColorFormat color_format, Vector2i offset, float dilation) const;
+
 	// Create a copy with its bitmap data owned by another glyph.
 	FontGlyph WeakCopy() const
 	{
@@ -71,6 +108,8 @@ public:
 		glyph.bitmap_data = bitmap_data;
 		glyph.bitmap_dimensions = bitmap_dimensions;
 		glyph.color_format = color_format;
+		glyph.distance_field = distance_field;
+		glyph.distance_field_scale = distance_field_scale;
 		return glyph;
 	}
 };
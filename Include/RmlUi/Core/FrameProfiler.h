@@ -0,0 +1,109 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FRAMEPROFILER_H
+#define RMLUI_CORE_FRAMEPROFILER_H
+
+#include "Header.h"
+#include "Types.h"
+
+namespace Rml {
+
+/**
+    The stages of a frame timed by the frame profiler.
+
+    The stages are timed inclusively, thus events dispatched during another stage are also counted towards that stage.
+ */
+enum class FrameTimer {
+	DataModelUpdate, // Updating the data models and their views.
+	StyleUpdate,     // Updating the definitions, properties, and animations of elements, including their update callbacks.
+	Layout,          // Formatting and positioning documents.
+	Render,          // Rendering contexts.
+	EventDispatch,   // Dispatching events to their listeners.
+	Count
+};
+
+/**
+    The amounts of work counted by the frame profiler.
+ */
+enum class FrameCounter {
+	ElementsUpdated,   // Elements whose computed values were updated.
+	DefinitionLookups, // Elements whose style sheet definition was looked up.
+	Layouts,           // Documents formatted by the layout engine.
+	DrawCalls,         // Geometry submitted to the render interface.
+	GlyphsRasterized,  // Glyph bitmaps rendered by the default font engine.
+	Count
+};
+
+/**
+    The timings and counters recorded during a single frame.
+ */
+struct FrameProfile {
+	// The time spent in each stage, in seconds.
+	double timers[size_t(FrameTimer::Count)] = {};
+	uint64_t counters[size_t(FrameCounter::Count)] = {};
+	// The time between the start and end of the frame, in seconds.
+	double duration = 0;
+
+	double GetTimer(FrameTimer timer) const { return timers[size_t(timer)]; }
+	uint64_t GetCounter(FrameCounter counter) const { return counters[size_t(counter)]; }
+};
+
+/**
+    Built-in profiler, recording the time spent in the main stages of each frame, and counting the work done.
+
+    Contrary to the profiling zones, which require building the library with Tracy, the frame profiler is always available and enabled at
+    runtime. While disabled, its instrumentation only costs a single branch. A frame is ended whenever a context is updated after any context
+    has been rendered, or by explicitly calling EndFrame(). Contexts updated and rendered on separate threads are recorded into shared frames.
+ */
+namespace FrameProfiler {
+
+	/// The number of completed frames kept by the profiler.
+	constexpr int max_frames = 120;
+
+	/// Enables or disables the profiler, frames are discarded when enabling the profiler.
+	RMLUICORE_API void SetEnabled(bool enable);
+	/// Returns true if the profiler is enabled.
+	RMLUICORE_API bool IsEnabled();
+
+	/// Ends the current frame and starts a new one.
+	RMLUICORE_API void EndFrame();
+
+	/// Returns the completed frames, ordered from oldest to newest.
+	RMLUICORE_API Vector<FrameProfile> GetFrames();
+	/// Discards all completed frames.
+	RMLUICORE_API void ClearFrames();
+
+	/// Returns a display name for the given timer or counter.
+	RMLUICORE_API const char* GetName(FrameTimer timer);
+	RMLUICORE_API const char* GetName(FrameCounter counter);
+
+} // namespace FrameProfiler
+
+} // namespace Rml
+#endif
@@ -45,6 +45,8 @@ struct Mesh {
 struct TexturedMesh {
 	Mesh mesh;
 	Texture texture;
+	// Free for use by the font engine generating the mesh, such as for detecting meshes which refer to texture contents that have since changed.
+	int texture_generation = 0;
 };
 
 using TexturedMeshList = Vector<TexturedMesh>;
@@ -0,0 +1,75 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_PREPAREDDOCUMENT_H
+#define RMLUI_CORE_PREPAREDDOCUMENT_H
+
+#include "BaseXMLParser.h"
+#include "Header.h"
+#include "Traits.h"
+#include "Types.h"
+#include "URL.h"
+
+namespace Rml {
+
+class Factory;
+class StyleSheetContainer;
+
+/**
+    A document which has been read and parsed, and had its style sheets loaded, without being attached to any context.
+
+    Prepared documents are created by Rml::PrepareDocument, which may be called from any thread, also while contexts are being
+    updated and rendered. The prepared document can then be loaded into a context using Context::LoadDocument. Loading submits
+    the parsed nodes to the node handlers, which instance the elements and their templates, without parsing any RML again. A
+    prepared document can be loaded any number of times, into any context.
+
+    @lifetime Prepared documents must be destroyed before the call to Rml::Shutdown.
+ */
+
+class RMLUICORE_API PreparedDocument : public NonCopyMoveable {
+public:
+	/// Returns the source address of the document.
+	const String& GetSourceURL() const { return source_url.GetURL(); }
+	/// Returns the parsed nodes of the document.
+	const XMLParsedNodeList& GetNodes() const { return nodes; }
+	/// Returns the style sheets of the document, combined with any style sheets from its templates.
+	/// @return The combined style sheets, or nullptr if the document has none.
+	const SharedPtr<const StyleSheetContainer>& GetStyleSheetContainer() const { return style_sheet_container; }
+
+private:
+	PreparedDocument() = default;
+
+	URL source_url;
+	XMLParsedNodeList nodes;
+	SharedPtr<const StyleSheetContainer> style_sheet_container;
+
+	friend class Rml::Factory;
+};
+
+} // namespace Rml
+#endif
@@ -125,6 +125,7 @@ private:
 	bool ReleaseTexture(const String& texture_source);
 	void ReleaseAllTextures();
 	void ReleaseAllCompiledGeometry();
+	void ReleaseTextureHandle(Texture texture);
 
 	void ReleaseResource(const CallbackTexture& texture);
 	Mesh ReleaseResource(const Geometry& geometry);
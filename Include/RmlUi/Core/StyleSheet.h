@@ -33,6 +33,7 @@
 #include "Spritesheet.h"
 #include "StyleSheetTypes.h"
 #include "Traits.h"
+#include <mutex>
 
 namespace Rml {
 
@@ -65,7 +66,7 @@ public:
 	/// Merges another style sheet into this.
 	void MergeStyleSheet(const StyleSheet& sheet);
 
-	/// Builds the node index for a combined style sheet.
+	/// Builds the node index for a combined style sheet, unless it has already been built.
 	void BuildNodeIndex();
 
 	/// Returns the named @decorator, or null if it does not exist.
@@ -82,10 +83,16 @@ public:
 	const Sprite* GetSprite(const String& name) const;
 
 	/// Returns the compiled element definition for a given element and its hierarchy.
+	/// @note Style sheets may be shared between documents of different contexts, thus this may be called from multiple threads.
 	SharedPtr<const ElementDefinition> GetElementDefinition(const Element* element) const;
 
+	/// Returns the elements whose definitions may be affected when the given class, pseudo-class, or attribute is changed on an element.
+	StyleSheetInvalidation GetClassInvalidation(const String& class_name) const;
+	StyleSheetInvalidation GetPseudoClassInvalidation(const String& pseudo_class) const;
+	StyleSheetInvalidation GetAttributeInvalidation(const String& attribute_name) const;
+
 	/// Returns a list of instanced decorators from the declarations. The instances are cached for faster future retrieval.
-	const DecoratorPtrList& InstanceDecorators(RenderManager& render_manager, const DecoratorDeclarationList& declaration_list,
+	DecoratorPtrList InstanceDecorators(RenderManager& render_manager, const DecoratorDeclarationList& declaration_list,
 		const PropertySource* decorator_source) const;
 
 private:
@@ -112,6 +119,10 @@ private:
 
 	// Map of all styled nodes, that is, they have one or more properties.
 	StyleSheetIndex styled_node_index;
+	bool styled_node_index_built = false;
+
+	// Guards the node index and the caches below, which are written to lazily during updates.
+	mutable std::mutex cache_mutex;
 
 	// Index of node sets to element definitions.
 	using ElementDefinitionCache = UnorderedMap<StyleSheetIndex::NodeList, SharedPtr<const ElementDefinition>>;
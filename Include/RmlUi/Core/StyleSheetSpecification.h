@@ -32,6 +32,7 @@
 #include "Header.h"
 #include "PropertySpecification.h"
 #include "Types.h"
+#include "Unit.h"
 
 namespace Rml {
 
@@ -103,6 +104,19 @@ public:
 	/// @param[in] line_number The location of the source file where this property was declared. Used for error reporting and debugging.
 	/// @return True if all properties were parsed successfully, false otherwise.
 	static bool ParsePropertyDeclaration(PropertyDictionary& dictionary, const String& property_name, const String& property_value);
+	/// Parses a property declaration, reusing the results of recent parses of the same property. Intended for values which are set repeatedly,
+	/// such as inline properties set from code or data bindings.
+	/// @param[in] property_name The name of the declared property.
+	/// @param[in] property_value The values the property is being set to.
+	/// @return The parsed properties, or nullptr if the declaration is invalid. Only valid until the next call to this function on the same thread.
+	static const PropertyDictionary* ParsePropertyDeclarationCached(const String& property_name, const String& property_value);
+	/// Constructs a numeric property directly, equivalent to parsing the number followed by its unit, without going through its string form.
+	/// @param[out] property The constructed property.
+	/// @param[in] id The id of the property.
+	/// @param[in] value The numeric value of the property.
+	/// @param[in] unit The unit of the value, or Unit::NUMBER for plain numbers.
+	/// @return True if the property accepts the value and unit, false otherwise.
+	static bool ParseNumericProperty(Property& property, PropertyId id, float value, Unit unit);
 
 	static PropertyId GetPropertyId(const String& property_name);
 	static ShorthandId GetShorthandId(const String& shorthand_name);
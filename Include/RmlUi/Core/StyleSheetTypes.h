@@ -96,6 +96,26 @@ struct MediaBlock {
 };
 using MediaBlockList = Vector<MediaBlock>;
 
+/**
+   StyleSheetInvalidation describes which elements may need their definition updated when a name changes on an element, as determined by the
+   positions the name appears in the selectors of a style sheet.
+ */
+enum class StyleSheetInvalidation : uint8_t {
+	None = 0,
+	Self = 1 << 0,        // The name appears in the subject of a selector, the element itself may be affected.
+	Descendants = 1 << 1, // The name appears before a descendant or child combinator, the element's descendants may be affected.
+	Siblings = 1 << 2,    // The name appears before a sibling combinator, the element's siblings and their descendants may be affected.
+	All = Self | Descendants | Siblings,
+};
+inline StyleSheetInvalidation operator|(StyleSheetInvalidation lhs, StyleSheetInvalidation rhs)
+{
+	return StyleSheetInvalidation(uint8_t(lhs) | uint8_t(rhs));
+}
+inline StyleSheetInvalidation operator&(StyleSheetInvalidation lhs, StyleSheetInvalidation rhs)
+{
+	return StyleSheetInvalidation(uint8_t(lhs) & uint8_t(rhs));
+}
+
 /**
    StyleSheetIndex contains a cached index of all styled nodes for quick lookup when finding applicable style nodes for the current state of a given
    element.
@@ -107,6 +127,10 @@ struct StyleSheetIndex {
 	// The following objects are given in prioritized order. Any nodes in the first object will not be contained in the next one and so on.
 	NodeIndex ids, classes, tags;
 	NodeList other;
+
+	// Invalidation sets of every name appearing in the selectors, keyed by the atom of the name.
+	using InvalidationIndex = UnorderedMap<std::size_t, StyleSheetInvalidation>;
+	InvalidationIndex class_invalidation, pseudo_class_invalidation, attribute_invalidation;
 };
 } // namespace Rml
 
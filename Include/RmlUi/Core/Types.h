@@ -44,6 +44,7 @@ using std::size_t;
 
 enum class Character : char32_t { Null, Replacement = 0xfffd }; // Unicode code point
 enum class BoxArea { Margin, Border, Padding, Content, Auto };
+enum class Atom : uint32_t { Empty = 0, Invalid = 0xffff'ffff }; // Interned string, such as a tag name or class name
 
 } // namespace Rml
 
@@ -40,6 +40,10 @@ class Animation;
 
 namespace Rml {
 
+namespace Lottie {
+	class LottieFrameRenderer;
+}
+
 class RMLUICORE_API ElementLottie : public Element {
 public:
 	RMLUI_RTTI_DefineWithParent(ElementLottie, Element)
@@ -82,9 +86,6 @@ private:
 
 	// The texture this element is rendering from.
 	CallbackTexture texture;
-	// The texture data buffer.
-	size_t texture_data_size = 0;
-	UniquePtr<byte[]> texture_data;
 
 	// The animation's intrinsic dimensions.
 	Vector2f intrinsic_dimensions;
@@ -96,10 +97,14 @@ private:
 
 	// The absolute time when the current animation was first displayed.
 	double time_animation_start = -1;
+	// The absolute time when the texture was last updated to a new frame.
+	double time_prev_texture_update = -1;
 	// The previous animation frame displayed.
 	size_t prev_animation_frame = size_t(-1);
 
 	UniquePtr<rlottie::Animation> animation;
+	// Renders the frames of the animation, declared after the animation so that it is destroyed first.
+	UniquePtr<Lottie::LottieFrameRenderer> frame_renderer;
 };
 
 } // namespace Rml
@@ -41,6 +41,7 @@ namespace Lua {
 
 #if LUA_VERSION_NUM < 502
 	#define lua_setuservalue(L, i) (luaL_checktype((L), -1, LUA_TTABLE), lua_setfenv((L), (i)))
+	#define lua_rawlen(L, i) lua_objlen((L), (i))
 
 	inline int lua_absindex(lua_State* L, int idx)
 	{
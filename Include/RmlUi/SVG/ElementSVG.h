@@ -29,17 +29,18 @@
 #ifndef RMLUI_SVG_ELEMENT_SVG_H
 #define RMLUI_SVG_ELEMENT_SVG_H
 
-#include "../Core/CallbackTexture.h"
 #include "../Core/Element.h"
 #include "../Core/Geometry.h"
 #include "../Core/Header.h"
-
-namespace lunasvg {
-class Document;
-}
+#include "../Core/Texture.h"
 
 namespace Rml {
 
+namespace SVG {
+	struct SVGDocument;
+	struct SVGTexture;
+} // namespace SVG
+
 class RMLUICORE_API ElementSVG : public Element {
 public:
 	RMLUI_RTTI_DefineWithParent(ElementSVG, Element)
@@ -70,15 +71,18 @@ private:
 	void GenerateGeometry();
 	// Loads the SVG document specified by the 'src' attribute.
 	bool LoadSource();
-	// Update the texture when necessary.
+	// Update the texture when necessary, and swap in the pending texture once it is ready.
 	void UpdateTexture();
 
 	bool source_dirty = false;
 	bool geometry_dirty = false;
 	bool texture_dirty = false;
 
-	// The texture this element is rendering from.
-	CallbackTexture texture;
+	// The texture this element is rendering from, shared with other elements showing the same file at the same size.
+	SharedPtr<SVG::SVGTexture> svg_texture;
+	Texture texture;
+	// The texture of the current size while it is being rasterized, until then the previous texture is rendered scaled to the new size.
+	SharedPtr<SVG::SVGTexture> pending_svg_texture;
 
 	// The image's intrinsic dimensions.
 	Vector2f intrinsic_dimensions;
@@ -88,7 +92,8 @@ private:
 	// The geometry used to render this element.
 	Geometry geometry;
 
-	UniquePtr<lunasvg::Document> svg_document;
+	// The parsed document, shared with other elements showing the same file.
+	SharedPtr<SVG::SVGDocument> svg_document;
 };
 
 } // namespace Rml
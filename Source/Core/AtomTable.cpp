@@ -0,0 +1,191 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "AtomTable.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+namespace Rml {
+
+namespace {
+	// Strings are stored in blocks which are never reallocated, each twice the size of the previous one, so that they can be read without locking
+	// while the table grows. Enough blocks are available to hold every possible atom.
+	constexpr size_t first_block_size = 64;
+	constexpr size_t max_num_blocks = 27;
+
+	// Open-addressing hash index from strings to atoms, replaced by a larger index when it becomes half full. Each slot holds the string's hash
+	// in its upper half and the atom plus one in its lower half, or zero when empty, so that a slot can be published in a single store.
+	struct AtomIndex {
+		explicit AtomIndex(size_t capacity) : slots(capacity), mask(capacity - 1) {}
+		Vector<std::atomic<uint64_t>> slots;
+		size_t mask;
+	};
+
+	struct AtomTableData {
+		AtomTableData() { Add(String(), HashString(String())); }
+
+		static uint32_t HashString(const String& string) { return uint32_t(std::hash<String>()(string)); }
+
+		static void LocateString(size_t string_index, size_t& block_index, size_t& offset)
+		{
+			size_t blocks_before = string_index / first_block_size + 1;
+			block_index = 0;
+			while (blocks_before >>= 1)
+				block_index += 1;
+			offset = string_index - first_block_size * ((size_t(1) << block_index) - 1);
+		}
+
+		const String& GetString(size_t string_index) const
+		{
+			size_t block_index, offset;
+			LocateString(string_index, block_index, offset);
+			return blocks[block_index][offset];
+		}
+
+		// Returns the atom of the given string in the current index, or 'Atom::Invalid' if it is not found. Does not require locking.
+		Atom Find(const String& string, uint32_t hash) const
+		{
+			const AtomIndex& atom_index = *index.load(std::memory_order_acquire);
+			for (size_t i = hash & atom_index.mask;; i = (i + 1) & atom_index.mask)
+			{
+				const uint64_t slot = atom_index.slots[i].load(std::memory_order_acquire);
+				if (slot == 0)
+					return Atom::Invalid;
+
+				const uint32_t atom_plus_one = uint32_t(slot);
+				if (uint32_t(slot >> 32) == hash && GetString(atom_plus_one - 1) == string)
+					return Atom(atom_plus_one - 1);
+			}
+		}
+
+		// Adds a new string to the table, must be called with the mutex locked.
+		Atom Add(const String& string, uint32_t hash)
+		{
+			const size_t string_index = size.load(std::memory_order_relaxed);
+			RMLUI_ASSERTMSG(string_index < size_t(Atom::Invalid), "Atom table is full.");
+
+			size_t block_index, offset;
+			LocateString(string_index, block_index, offset);
+			if (!blocks[block_index])
+				blocks[block_index].reset(new String[first_block_size << block_index]);
+			blocks[block_index][offset] = string;
+
+			const Atom atom = Atom(string_index);
+			size.store(string_index + 1, std::memory_order_release);
+
+			AtomIndex* atom_index = index.load(std::memory_order_relaxed);
+			if (!atom_index || 2 * (string_index + 1) > atom_index->slots.size())
+			{
+				// Build the larger index completely before publishing it. The previous index is kept, as other threads may still be reading it.
+				auto new_index = MakeUnique<AtomIndex>(atom_index ? 2 * atom_index->slots.size() : 2 * first_block_size);
+				if (atom_index)
+				{
+					for (const std::atomic<uint64_t>& slot : atom_index->slots)
+					{
+						if (const uint64_t value = slot.load(std::memory_order_relaxed))
+							Insert(*new_index, value);
+					}
+				}
+				atom_index = new_index.get();
+				indices.push_back(std::move(new_index));
+			}
+
+			Insert(*atom_index, (uint64_t(hash) << 32) | (uint64_t(atom) + 1));
+			index.store(atom_index, std::memory_order_release);
+
+			return atom;
+		}
+
+		static void Insert(AtomIndex& atom_index, uint64_t value)
+		{
+			size_t i = size_t(value >> 32) & atom_index.mask;
+			while (atom_index.slots[i].load(std::memory_order_relaxed) != 0)
+				i = (i + 1) & atom_index.mask;
+			atom_index.slots[i].store(value, std::memory_order_release);
+		}
+
+		UniquePtr<String[]> blocks[max_num_blocks];
+		// The number of strings, readable without locking.
+		std::atomic<size_t> size{0};
+
+		std::atomic<AtomIndex*> index{nullptr};
+		// All indices created, only the last one is in use for new lookups.
+		Vector<UniquePtr<AtomIndex>> indices;
+
+		// Contexts may be updated on different threads, all of which can add new atoms. Only adding atoms requires locking.
+		std::mutex mutex;
+	};
+} // namespace
+
+static AtomTableData& GetAtomTableData()
+{
+	static AtomTableData data;
+	return data;
+}
+
+Atom AtomTable::Intern(const String& string)
+{
+	AtomTableData& data = GetAtomTableData();
+	const uint32_t hash = AtomTableData::HashString(string);
+
+	const Atom atom = data.Find(string, hash);
+	if (atom != Atom::Invalid)
+		return atom;
+
+	// Look it up again while locked, another thread may have added the string in the meantime.
+	std::lock_guard<std::mutex> lock(data.mutex);
+	const Atom added_atom = data.Find(string, hash);
+	if (added_atom != Atom::Invalid)
+		return added_atom;
+
+	return data.Add(string, hash);
+}
+
+Atom AtomTable::Find(const String& string)
+{
+	const AtomTableData& data = GetAtomTableData();
+	return data.Find(string, AtomTableData::HashString(string));
+}
+
+size_t AtomTable::GetSize()
+{
+	return GetAtomTableData().size.load(std::memory_order_acquire);
+}
+
+const String& AtomTable::GetString(Atom atom)
+{
+	const AtomTableData& data = GetAtomTableData();
+
+	if (size_t(atom) < data.size.load(std::memory_order_acquire))
+		return data.GetString(size_t(atom));
+
+	return data.GetString(size_t(Atom::Empty));
+}
+
+} // namespace Rml
@@ -0,0 +1,63 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ATOMTABLE_H
+#define RMLUI_CORE_ATOMTABLE_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+using AtomList = Vector<Atom>;
+
+/**
+    Global table of interned strings.
+
+    Strings identifying elements and selectors, such as tag names, classes, and pseudo-classes, are interned as atoms so that they can be compared
+    and hashed as integers. Equal strings always result in the same atom, and the empty string is always 'Atom::Empty'. Atoms are never released,
+    thus the table grows with the number of unique strings encountered. Element ids and classes are therefore only looked up, as they are only
+    interned by the selectors referring to them. The table may be used from multiple threads, only adding new atoms requires locking.
+ */
+class AtomTable {
+public:
+	/// Returns the atom representing the given string, adding it to the table if necessary.
+	static Atom Intern(const String& string);
+
+	/// Returns the atom representing the given string, or 'Atom::Invalid' if the string has never been interned.
+	/// @note Since no element or selector can refer to a string which has not been interned, this can be used for lookups without growing the table.
+	static Atom Find(const String& string);
+
+	/// Returns the number of atoms in the table. Since atoms are never released, the result of 'Find' can only change when this number changes.
+	static size_t GetSize();
+
+	/// Returns the string represented by the given atom. The reference remains valid until the library is unloaded.
+	static const String& GetString(Atom atom);
+};
+
+} // namespace Rml
+#endif
@@ -30,6 +30,7 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/Stream.h"
 #include "XMLParseTools.h"
+#include <algorithm>
 #include <string.h>
 
 namespace Rml {
@@ -79,6 +80,37 @@ void BaseXMLParser::Parse(Stream* stream)
 	source_url = nullptr;
 }
 
+void BaseXMLParser::ParseNodes(Stream* stream, XMLParsedNodeList& nodes)
+{
+	parsed_nodes = &nodes;
+	Parse(stream);
+	parsed_nodes = nullptr;
+}
+
+void BaseXMLParser::HandleNodes(Span<const XMLParsedNode> nodes, const URL& _source_url)
+{
+	source_url = &_source_url;
+	line_number = 1;
+	line_number_open_tag = 1;
+
+	for (const XMLParsedNode& node : nodes)
+	{
+		line_number = node.line_number;
+
+		switch (node.type)
+		{
+		case XMLParsedNode::Type::ElementStart:
+			line_number_open_tag = node.line_number;
+			HandleElementStart(node.value, node.attributes);
+			break;
+		case XMLParsedNode::Type::ElementEnd: HandleElementEnd(node.value); break;
+		case XMLParsedNode::Type::Data: HandleData(node.value, node.data_type); break;
+		}
+	}
+
+	source_url = nullptr;
+}
+
 int BaseXMLParser::GetLineNumber() const
 {
 	return line_number;
@@ -119,19 +151,34 @@ char BaseXMLParser::Look() const
 void BaseXMLParser::HandleElementStartInternal(const String& name, const XMLAttributes& attributes)
 {
 	line_number_open_tag = line_number;
-	if (!inner_xml_data)
+	if (inner_xml_data)
+		return;
+
+	if (parsed_nodes)
+		parsed_nodes->push_back(XMLParsedNode{XMLParsedNode::Type::ElementStart, XMLDataType::Text, line_number, name, attributes});
+	else
 		HandleElementStart(name, attributes);
 }
 
 void BaseXMLParser::HandleElementEndInternal(const String& name)
 {
-	if (!inner_xml_data)
+	if (inner_xml_data)
+		return;
+
+	if (parsed_nodes)
+		parsed_nodes->push_back(XMLParsedNode{XMLParsedNode::Type::ElementEnd, XMLDataType::Text, line_number, name, {}});
+	else
 		HandleElementEnd(name);
 }
 
 void BaseXMLParser::HandleDataInternal(const String& data, XMLDataType type)
 {
-	if (!inner_xml_data)
+	if (inner_xml_data)
+		return;
+
+	if (parsed_nodes)
+		parsed_nodes->push_back(XMLParsedNode{XMLParsedNode::Type::Data, type, line_number, data, {}});
+	else
 		HandleData(data, type);
 }
 
@@ -139,8 +186,8 @@ void BaseXMLParser::ReadHeader()
 {
 	if (PeekString("<?"))
 	{
-		String temp;
-		FindString(">", temp);
+		StringView header;
+		FindString(">", header);
 	}
 }
 
@@ -154,17 +201,20 @@ void BaseXMLParser::ReadBody()
 	for (;;)
 	{
 		// Find the next open tag.
-		if (!FindString("<", data, true))
+		StringView text;
+		if (!FindString("<", text, true))
 			break;
 
+		data.append(text.begin(), text.size());
+
 		const size_t xml_index_tag = xml_index - 1;
 
 		// Check what kind of tag this is.
 		if (PeekString("!--"))
 		{
 			// Comment.
-			String temp;
-			if (!FindString("-->", temp))
+			StringView comment;
+			if (!FindString("-->", comment))
 				break;
 		}
 		else if (PeekString("![CDATA["))
@@ -209,22 +259,25 @@ bool BaseXMLParser::ReadOpenTag()
 		data.clear();
 	}
 
-	String tag_name;
-	if (!FindWord(tag_name, "/>"))
+	StringView tag_name_view;
+	if (!FindWord(tag_name_view, "/>"))
 		return false;
 
+	const String tag_name(tag_name_view);
 	bool section_opened = false;
 
+	attributes.clear();
+
 	if (PeekString(">"))
 	{
 		// Simple open tag.
-		HandleElementStartInternal(tag_name, XMLAttributes());
+		HandleElementStartInternal(tag_name, attributes);
 		section_opened = true;
 	}
 	else if (PeekString("/") && PeekString(">"))
 	{
 		// Empty open tag.
-		HandleElementStartInternal(tag_name, XMLAttributes());
+		HandleElementStartInternal(tag_name, attributes);
 		HandleElementEndInternal(tag_name);
 
 		// Tag immediately closed, reduce count
@@ -234,7 +287,6 @@ bool BaseXMLParser::ReadOpenTag()
 	{
 		// It appears we have some attributes. Let's parse them.
 		bool parse_inner_xml_as_data = false;
-		XMLAttributes attributes;
 		if (!ReadAttributes(attributes, parse_inner_xml_as_data))
 			return false;
 
@@ -312,7 +364,7 @@ bool BaseXMLParser::ReadCloseTag(const size_t xml_index_tag)
 		data.clear();
 	}
 
-	String tag_name;
+	StringView tag_name;
 	if (!FindString(">", tag_name))
 		return false;
 
@@ -328,8 +380,8 @@ bool BaseXMLParser::ReadAttributes(XMLAttributes& attributes, bool& parse_raw_xm
 {
 	for (;;)
 	{
-		String attribute;
-		String value;
+		StringView attribute;
+		StringView value;
 
 		// Get the attribute name
 		if (!FindWord(attribute, "=/>"))
@@ -356,10 +408,16 @@ bool BaseXMLParser::ReadAttributes(XMLAttributes& attributes, bool& parse_raw_xm
 			}
 		}
 
-		if (attributes_for_inner_xml_data.count(attribute) == 1)
+		String attribute_name(attribute);
+		if (attributes_for_inner_xml_data.count(attribute_name) == 1)
 			parse_raw_xml_content = true;
 
-		attributes[attribute] = StringUtilities::DecodeRml(value);
+		// Most values contain no entities, and can be copied directly from the source.
+		String attribute_value(value);
+		if (std::find(value.begin(), value.end(), '&') != value.end())
+			attribute_value = StringUtilities::DecodeRml(attribute_value);
+
+		attributes[std::move(attribute_name)] = std::move(attribute_value);
 
 		// Check for the end of the tag.
 		if (PeekString("/", false) || PeekString(">", false))
@@ -369,97 +427,104 @@ bool BaseXMLParser::ReadAttributes(XMLAttributes& attributes, bool& parse_raw_xm
 
 bool BaseXMLParser::ReadCDATA(const char* tag_terminator)
 {
-	String cdata;
 	if (tag_terminator == nullptr)
 	{
+		StringView cdata;
 		FindString("]]>", cdata);
-		data += cdata;
+		data.append(cdata.begin(), cdata.size());
 		return true;
 	}
 	else
 	{
+		// The character data spans the source up until the closing tag.
+		const size_t cdata_begin = xml_index;
+
 		for (;;)
 		{
 			// Search for the next tag opening.
-			if (!FindString("<", cdata))
+			StringView skipped;
+			if (!FindString("<", skipped))
 				return false;
 
+			const size_t cdata_end = xml_index - 1;
+
 			if (PeekString("/", false))
 			{
-				String tag;
+				StringView tag;
 				if (FindString(">", tag))
 				{
-					size_t slash_pos = tag.find('/');
-					String tag_name = StringUtilities::StripWhitespace(slash_pos == String::npos ? tag : tag.substr(slash_pos + 1));
+					const char* slash = std::find(tag.begin(), tag.end(), '/');
+					String tag_name = StringUtilities::StripWhitespace(slash == tag.end() ? tag : StringView(slash + 1, tag.end()));
 					if (StringUtilities::ToLower(std::move(tag_name)) == tag_terminator)
 					{
-						data += cdata;
+						data.append(xml_source, cdata_begin, cdata_end - cdata_begin);
 						return true;
 					}
-					else
-					{
-						cdata += '<' + tag + '>';
-					}
 				}
-				else
-					cdata += "<";
 			}
-			else
-				cdata += "<";
 		}
 	}
 }
 
-bool BaseXMLParser::FindWord(String& word, const char* terminators)
+bool BaseXMLParser::FindWord(StringView& word, const char* terminators)
 {
-	while (!AtEnd())
+	// Skip any leading white space.
+	while (!AtEnd() && StringUtilities::IsWhitespace(Look()))
 	{
-		char c = Look();
-
-		// Count line numbers
-		if (c == '\n')
-		{
+		if (Look() == '\n')
 			line_number++;
-		}
+		Next();
+	}
 
-		// Ignore white space
-		if (StringUtilities::IsWhitespace(c))
-		{
-			if (word.empty())
-			{
-				Next();
-				continue;
-			}
-			else
-				return true;
-		}
+	const size_t word_begin = xml_index;
+
+	while (!AtEnd())
+	{
+		const char c = Look();
 
-		// Check for termination condition
-		if (terminators && strchr(terminators, c))
+		// The word ends at white space or any of the terminators, which are left in the stream.
+		if (StringUtilities::IsWhitespace(c) || (terminators && strchr(terminators, c)))
 		{
-			return !word.empty();
+			word = StringView(xml_source, word_begin, xml_index - word_begin);
+			return word.size() > 0;
 		}
 
-		word += c;
 		Next();
 	}
 
 	return false;
 }
 
-bool BaseXMLParser::FindString(const char* string, String& data, bool escape_brackets)
+bool BaseXMLParser::FindString(const char* string, StringView& data, bool escape_brackets)
 {
-	int index = 0;
+	const size_t string_length = strlen(string);
+	const size_t data_begin = xml_index;
+	const size_t source_size = xml_source.size();
+	const char first_character = string[0];
+
 	bool in_brackets = false;
 	bool in_string = false;
-	char previous = 0;
 
-	while (string[index])
+	while (xml_index < source_size)
 	{
-		if (AtEnd())
-			return false;
+		// Skip quickly past characters which can't affect the search. Outside brackets, only curly brackets are of interest to the bracket
+		// parser, and only when following another one of its kind, so they can be handled below.
+		if (!in_brackets)
+		{
+			while (xml_index < source_size)
+			{
+				const char c = xml_source[xml_index];
+				if (c == first_character || c == '\n' || (escape_brackets && (c == '{' || c == '}')))
+					break;
+				xml_index++;
+			}
+
+			if (xml_index >= source_size)
+				break;
+		}
 
 		const char c = Look();
+		const char previous = (xml_index > data_begin ? xml_source[xml_index - 1] : 0);
 
 		// Count line numbers
 		if (c == '\n')
@@ -477,26 +542,18 @@ bool BaseXMLParser::FindString(const char* string, String& data, bool escape_bra
 			}
 		}
 
-		if (c == string[index] && !in_brackets)
-		{
-			index += 1;
-		}
-		else
+		if (c == first_character && !in_brackets && xml_index + string_length <= source_size &&
+			memcmp(xml_source.data() + xml_index + 1, string + 1, string_length - 1) == 0)
 		{
-			if (index > 0)
-			{
-				data += String(string, index);
-				index = 0;
-			}
-
-			data += c;
+			data = StringView(xml_source, data_begin, xml_index - data_begin);
+			xml_index += string_length;
+			return true;
 		}
 
-		previous = c;
 		Next();
 	}
 
-	return true;
+	return false;
 }
 
 bool BaseXMLParser::PeekString(const char* string, bool consume)
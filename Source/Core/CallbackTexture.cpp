@@ -29,9 +29,13 @@
 #include "../../Include/RmlUi/Core/CallbackTexture.h"
 #include "../../Include/RmlUi/Core/Texture.h"
 #include "RenderManagerAccess.h"
+#include <mutex>
 
 namespace Rml {
 
+// Callback texture sources may be shared by contexts on different threads, each using their own render manager.
+static std::mutex callback_texture_source_mutex;
+
 void CallbackTexture::Release()
 {
 	if (resource_handle != StableVectorIndex::Invalid)
@@ -97,10 +101,20 @@ CallbackTextureSource& CallbackTextureSource::operator=(CallbackTextureSource&&
 
 Texture CallbackTextureSource::GetTexture(RenderManager& render_manager) const
 {
-	CallbackTexture& texture = textures[&render_manager];
-	if (!texture)
-		texture = render_manager.MakeCallbackTexture(callback);
-	return Texture(texture);
+	{
+		std::lock_guard<std::mutex> lock(callback_texture_source_mutex);
+		auto it = textures.find(&render_manager);
+		if (it != textures.end() && it->second)
+			return Texture(it->second);
+	}
+
+	// Create the texture outside the lock, a render manager is only ever used by a single thread at a time.
+	CallbackTexture texture = render_manager.MakeCallbackTexture(callback);
+
+	std::lock_guard<std::mutex> lock(callback_texture_source_mutex);
+	CallbackTexture& stored_texture = textures[&render_manager];
+	stored_texture = std::move(texture);
+	return Texture(stored_texture);
 }
 
 } // namespace Rml
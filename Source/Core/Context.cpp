@@ -34,13 +34,16 @@
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/PreparedDocument.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderManager.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/Debug.h"
+#include "ContextActivity.h"
 #include "DataModel.h"
 #include "EventDispatcher.h"
+#include "FrameProfilerRecorder.h"
 #include "PluginRegistry.h"
 #include "ScrollController.h"
 #include "StreamFile.h"
@@ -174,6 +177,8 @@ float Context::GetDensityIndependentPixelRatio() const
 bool Context::Update()
 {
 	RMLUI_ZoneScoped;
+	ContextActivityScope activity_scope;
+	FrameProfilerRecorder::OnContextUpdate();
 
 	next_update_timeout = std::numeric_limits<double>::infinity();
 
@@ -184,9 +189,18 @@ bool Context::Update()
 	if (mouse_active)
 		UpdateHoverChain(mouse_position);
 
-	// Update all the data models before updating properties and layout.
-	for (auto& data_model : data_models)
-		data_model.second->Update(true);
+	// Update all the data models before updating properties and layout. Models without any dirty variables or pending views return immediately.
+	{
+		FrameProfilerScope profiler_scope(FrameTimer::DataModelUpdate);
+		for (auto& data_model : data_models)
+		{
+			data_model.second->Update(true, true);
+
+			// Views exceeding the model's update limit are carried over to the next update.
+			if (data_model.second->HasPendingViewUpdates())
+				RequestNextUpdate(0);
+		}
+	}
 
 	// The style definition of each document should be independent of each other. By manually resetting these flags we avoid unnecessary definition
 	// lookups in unrelated documents, such as when adding a new document. Adding an element dirties the parent definition, which in this case is the
@@ -194,7 +208,10 @@ bool Context::Update()
 	root->dirty_definition = false;
 	root->dirty_child_definitions = false;
 
-	root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
+	{
+		FrameProfilerScope profiler_scope(FrameTimer::StyleUpdate);
+		root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
+	}
 
 	for (int i = 0; i < root->GetNumChildren(); ++i)
 	{
@@ -214,8 +231,11 @@ bool Context::Update()
 bool Context::Render()
 {
 	RMLUI_ZoneScoped;
+	ContextActivityScope activity_scope;
+	FrameProfilerScope profiler_scope(FrameTimer::Render);
 
 	render_manager->PrepareRender();
+	GetFontEngineInterface()->PrepareRender();
 
 	root->Render();
 
@@ -229,6 +249,7 @@ bool Context::Render()
 	}
 
 	render_manager->ResetState();
+	FrameProfilerRecorder::OnContextRender();
 
 	return true;
 }
@@ -276,6 +297,21 @@ ElementDocument* Context::LoadDocument(Stream* stream)
 	PluginRegistry::NotifyDocumentOpen(this, stream->GetSourceURL().GetURL());
 
 	ElementPtr element = Factory::InstanceDocumentStream(this, stream, GetDocumentsBaseTag());
+
+	return AddLoadedDocument(std::move(element));
+}
+
+ElementDocument* Context::LoadDocument(const PreparedDocument& prepared_document)
+{
+	PluginRegistry::NotifyDocumentOpen(this, prepared_document.GetSourceURL());
+
+	ElementPtr element = Factory::InstanceDocument(this, prepared_document, GetDocumentsBaseTag());
+
+	return AddLoadedDocument(std::move(element));
+}
+
+ElementDocument* Context::AddLoadedDocument(ElementPtr element)
+{
 	if (!element)
 		return nullptr;
 
@@ -294,7 +330,7 @@ ElementDocument* Context::LoadDocument(Stream* stream)
 	// any data variables first. We do not clear dirty variables here, since users may need to
 	// retrieve whether or not eg. a data variable has changed in a controller.
 	for (auto& data_model : data_models)
-		data_model.second->Update(false);
+		data_model.second->Update(false, false);
 
 	document->UpdateDocument();
 
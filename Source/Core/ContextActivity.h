@@ -0,0 +1,59 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_CONTEXTACTIVITY_H
+#define RMLUI_CORE_CONTEXTACTIVITY_H
+
+#include "../../Include/RmlUi/Core/Debug.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+
+namespace Rml {
+
+/**
+    Tracks the number of contexts currently being updated or rendered, across all threads.
+
+    Contexts may be updated and rendered in parallel. The global registries, such as the factory instancers, node handlers, and the style sheet
+    specification, are read without any synchronization during these calls. Thus, they must only be modified while no context is active.
+ */
+class ContextActivityScope : NonCopyMoveable {
+public:
+	ContextActivityScope();
+	~ContextActivityScope();
+
+	/// Returns true if any context is currently being updated or rendered, on any thread.
+	static bool IsAnyContextActive();
+};
+
+} // namespace Rml
+
+// Asserts that global registries are not modified while any context is being updated or rendered, possibly on other threads.
+#define RMLUI_ASSERT_NO_ACTIVE_CONTEXTS                              \
+	RMLUI_ASSERTMSG(!::Rml::ContextActivityScope::IsAnyContextActive(), \
+		"Global registries must not be modified while any context is being updated or rendered.")
+
+#endif
@@ -28,6 +28,7 @@
 
 #include "../../Include/RmlUi/Core/ConvolutionFilter.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include "Memory.h"
 #include <float.h>
 #include <string.h>
 
@@ -67,6 +68,45 @@ float* ConvolutionFilter::operator[](int kernel_y_index)
 	return kernel.get() + kernel_size.x * kernel_y_index;
 }
 
+// Accumulation loops are kept free of branches and bounds checks so that the compiler can vectorize them.
+static void AccumulateSum(float* accumulator, const float* source, const int count, const float weight)
+{
+	for (int i = 0; i < count; i++)
+		accumulator[i] += source[i] * weight;
+}
+
+static void AccumulateMax(float* accumulator, const float* source, const int count, const float weight)
+{
+	for (int i = 0; i < count; i++)
+	{
+		const float value = source[i] * weight;
+		accumulator[i] = (value > accumulator[i] ? value : accumulator[i]);
+	}
+}
+
+// Finds the maximum value of every window of consecutive source values using the van Herk/Gil-Werman algorithm, which takes constant time per
+// value regardless of the window size. Writes 'count' values to the destination, reading 'count + window_size - 1' values from the source.
+static void SlidingWindowMax(float* destination, const float* source, const int count, const int window_size, float* prefix_max, float* suffix_max)
+{
+	const int source_count = count + window_size - 1;
+
+	for (int block_begin = 0; block_begin < source_count; block_begin += window_size)
+	{
+		const int block_end = Math::Min(block_begin + window_size, source_count);
+
+		prefix_max[block_begin] = source[block_begin];
+		for (int i = block_begin + 1; i < block_end; i++)
+			prefix_max[i] = Math::Max(prefix_max[i - 1], source[i]);
+
+		suffix_max[block_end - 1] = source[block_end - 1];
+		for (int i = block_end - 2; i >= block_begin; i--)
+			suffix_max[i] = Math::Max(suffix_max[i + 1], source[i]);
+	}
+
+	for (int i = 0; i < count; i++)
+		destination[i] = Math::Max(suffix_max[i], prefix_max[i + window_size - 1]);
+}
+
 void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimensions, const int destination_stride,
 	const ColorFormat destination_color_format, const byte* source, const Vector2i source_dimensions, const Vector2i source_offset,
 	const ColorFormat source_color_format) const
@@ -80,37 +120,108 @@ void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimens
 
 	const Vector2i kernel_radius = (kernel_size - Vector2i(1)) / 2;
 
+	if (destination_dimensions.x <= 0 || destination_dimensions.y <= 0)
+		return;
+
+	// Convert the source opacity to floating point values, and pad each row with zeros so that every kernel tap of every destination pixel
+	// stays within the row. Zero-valued pixels never contribute to the result of either operation, just like pixels outside the source.
+	const int padded_width = destination_dimensions.x + kernel_size.x - 1;
+	const int padded_height = Math::Max(source_dimensions.y, 0);
+	const int source_x_begin = -source_offset.x - kernel_radius.x;
+
+	DynamicArray<float, GlobalStackAllocator<float>> padded_source(size_t(padded_width * padded_height));
+	for (int y = 0; y < padded_height; ++y)
+	{
+		float* padded_row = padded_source.data() + y * padded_width;
+		for (int x = 0; x < padded_width; ++x)
+		{
+			const int source_x = source_x_begin + x;
+			if (source_x >= 0 && source_x < source_dimensions.x)
+				padded_row[x] = float(source[(y * source_dimensions.x + source_x) * source_bytes_per_pixel + source_alpha_offset]);
+			else
+				padded_row[x] = 0.f;
+		}
+	}
+
+	// For dilation, find the longest run of unit weights in each kernel row. The run is resolved using a sliding window maximum instead of
+	// testing each of its taps separately, which reduces eg. round outline kernels to a small number of operations per kernel row.
+	constexpr int min_window_run_length = 4;
+	DynamicArray<int, GlobalStackAllocator<int>> run_begin((size_t)kernel_size.y);
+	DynamicArray<int, GlobalStackAllocator<int>> run_length((size_t)kernel_size.y);
+
+	for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+	{
+		run_begin[kernel_y] = 0;
+		run_length[kernel_y] = 0;
+
+		if (operation != FilterOperation::Dilation)
+			continue;
+
+		const float* kernel_row = kernel.get() + kernel_y * kernel_size.x;
+		for (int kernel_x = 0; kernel_x < kernel_size.x;)
+		{
+			int length = 0;
+			while (kernel_x + length < kernel_size.x && kernel_row[kernel_x + length] == 1.f)
+				length += 1;
+
+			if (length > run_length[kernel_y])
+			{
+				run_begin[kernel_y] = kernel_x;
+				run_length[kernel_y] = length;
+			}
+			kernel_x += Math::Max(length, 1);
+		}
+
+		if (run_length[kernel_y] < min_window_run_length)
+			run_length[kernel_y] = 0;
+	}
+
+	DynamicArray<float, GlobalStackAllocator<float>> accumulator((size_t)destination_dimensions.x);
+	DynamicArray<float, GlobalStackAllocator<float>> window_max((size_t)destination_dimensions.x);
+	DynamicArray<float, GlobalStackAllocator<float>> prefix_max((size_t)padded_width);
+	DynamicArray<float, GlobalStackAllocator<float>> suffix_max((size_t)padded_width);
+
 	for (int y = 0; y < destination_dimensions.y; ++y)
 	{
 		for (int x = 0; x < destination_dimensions.x; ++x)
+			accumulator[x] = 0.f;
+
+		for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
 		{
-			float opacity = 0.f;
+			const int source_y = y - source_offset.y - kernel_radius.y + kernel_y;
+			if (source_y < 0 || source_y >= padded_height)
+				continue;
 
-			for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+			const float* padded_row = padded_source.data() + source_y * padded_width;
+			const float* kernel_row = kernel.get() + kernel_y * kernel_size.x;
+
+			const int run_end = run_begin[kernel_y] + run_length[kernel_y];
+			if (run_length[kernel_y] > 0)
 			{
-				const int source_y = y - source_offset.y - kernel_radius.y + kernel_y;
+				SlidingWindowMax(window_max.data(), padded_row + run_begin[kernel_y], destination_dimensions.x, run_length[kernel_y],
+					prefix_max.data(), suffix_max.data());
+				AccumulateMax(accumulator.data(), window_max.data(), destination_dimensions.x, 1.f);
+			}
 
-				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+			for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+			{
+				const float weight = kernel_row[kernel_x];
+				if (weight == 0.f || (kernel_x >= run_begin[kernel_y] && kernel_x < run_end))
+					continue;
+
+				switch (operation)
 				{
-					const int source_x = x - source_offset.x - kernel_radius.x + kernel_x;
-					if (source_y >= 0 && source_y < source_dimensions.y && source_x >= 0 && source_x < source_dimensions.x)
-					{
-						const int source_index = (source_y * source_dimensions.x + source_x) * source_bytes_per_pixel + source_alpha_offset;
-						const float pixel_opacity = float(source[source_index]) * kernel[kernel_y * kernel_size.x + kernel_x];
-
-						switch (operation)
-						{
-						case FilterOperation::Sum: opacity += pixel_opacity; break;
-						case FilterOperation::Dilation: opacity = Math::Max(opacity, pixel_opacity); break;
-						}
-					}
+				case FilterOperation::Sum: AccumulateSum(accumulator.data(), padded_row + kernel_x, destination_dimensions.x, weight); break;
+				case FilterOperation::Dilation: AccumulateMax(accumulator.data(), padded_row + kernel_x, destination_dimensions.x, weight); break;
 				}
 			}
+		}
 
-			opacity = Math::Min(255.f, opacity);
-
-			const int destination_index = y * destination_stride + x * destination_bytes_per_pixel + destination_alpha_offset;
-			destination[destination_index] = byte(opacity);
+		byte* destination_row = destination + y * destination_stride + destination_alpha_offset;
+		for (int x = 0; x < destination_dimensions.x; ++x)
+		{
+			const float opacity = Math::Min(255.f, accumulator[x]);
+			destination_row[x * destination_bytes_per_pixel] = byte(opacity);
 		}
 	}
 }
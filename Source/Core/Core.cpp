@@ -33,15 +33,19 @@
 #include "../../Include/RmlUi/Core/FileInterface.h"
 #include "../../Include/RmlUi/Core/FontEngineInterface.h"
 #include "../../Include/RmlUi/Core/Plugin.h"
+#include "../../Include/RmlUi/Core/PreparedDocument.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/RenderManager.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "ContextActivity.h"
 #include "EventSpecification.h"
 #include "FileInterfaceDefault.h"
 #include "PluginRegistry.h"
 #include "RenderManagerAccess.h"
+#include "StreamFile.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetParser.h"
 #include "TemplateCache.h"
@@ -49,6 +53,7 @@
 
 #ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
 	#include "FontEngineDefault/FontEngineInterfaceDefault.h"
+	#include "FontEngineDefault/FontProvider.h"
 #endif
 
 #ifdef RMLUI_ENABLE_LOTTIE_PLUGIN
@@ -321,6 +326,23 @@ int GetNumContexts()
 	return (int)contexts.size();
 }
 
+UniquePtr<PreparedDocument> PrepareDocument(const String& document_path)
+{
+	StreamFile stream;
+	if (!stream.Open(document_path))
+		return nullptr;
+
+	return Factory::PrepareDocumentStream(&stream);
+}
+
+UniquePtr<PreparedDocument> PrepareDocumentFromMemory(const String& document_rml, const String& source_url)
+{
+	StreamMemory stream(reinterpret_cast<const byte*>(document_rml.c_str()), document_rml.size());
+	stream.SetSourceURL(source_url);
+
+	return Factory::PrepareDocumentStream(&stream);
+}
+
 bool LoadFontFace(const String& file_path, bool fallback_face, Style::FontWeight weight)
 {
 	return font_interface->LoadFontFace(file_path, fallback_face, weight);
@@ -349,6 +371,7 @@ void UnregisterPlugin(Plugin* plugin)
 
 EventId RegisterEventType(const String& type, bool interruptible, bool bubbles, DefaultActionPhase default_action_phase)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	return EventSpecificationInterface::InsertOrReplaceCustom(type, interruptible, bubbles, default_action_phase);
 }
 
@@ -416,6 +439,19 @@ void ReleaseFontResources()
 	}
 }
 
+void SetFontDistanceFieldThreshold(int font_size)
+{
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+	FontProvider::SetDistanceFieldThreshold(font_size);
+
+	// Regenerate the font face handles currently in use with the new setting.
+	if (font_interface && font_interface == default_font_interface.get())
+		ReleaseFontResources();
+#else
+	(void)font_size;
+#endif
+}
+
 void ReleaseMemoryPools()
 {
 	if (observerPtrBlockPool && observerPtrBlockPool->GetNumAllocatedObjects() <= 0)
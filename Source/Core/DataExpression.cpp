@@ -28,6 +28,7 @@
 
 #include "DataExpression.h"
 #include "../../Include/RmlUi/Core/DataModelHandle.h"
+#include "../../Include/RmlUi/Core/DataVariable.h"
 #include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataModel.h"
@@ -912,6 +913,59 @@ static String DumpProgram(const Program& program)
 	return str;
 }
 
+// Executes an operator instruction using the registers of the abstract machine, the result is written to R.
+static void ExecuteOperator(const Instruction instruction, const Variant& L, const Variant& C, Variant& R)
+{
+	auto AnyString = [](const Variant& v1, const Variant& v2) { return v1.GetType() == Variant::STRING || v2.GetType() == Variant::STRING; };
+
+	switch (instruction)
+	{
+	case Instruction::Add:
+	{
+		if (AnyString(L, R))
+			R = Variant(L.Get<String>() + R.Get<String>());
+		else
+			R = Variant(L.Get<double>() + R.Get<double>());
+	}
+	break;
+		// clang-format off
+	case Instruction::Subtract:  R = Variant(L.Get<double>() - R.Get<double>());  break;
+	case Instruction::Multiply:  R = Variant(L.Get<double>() * R.Get<double>());  break;
+	case Instruction::Divide:    R = Variant(L.Get<double>() / R.Get<double>());  break;
+	case Instruction::Not:       R = Variant(!R.Get<bool>());                     break;
+	case Instruction::And:       R = Variant(L.Get<bool>() && R.Get<bool>());     break;
+	case Instruction::Or:        R = Variant(L.Get<bool>() || R.Get<bool>());     break;
+	case Instruction::Less:      R = Variant(L.Get<double>() < R.Get<double>());  break;
+	case Instruction::LessEq:    R = Variant(L.Get<double>() <= R.Get<double>()); break;
+	case Instruction::Greater:   R = Variant(L.Get<double>() > R.Get<double>());  break;
+	case Instruction::GreaterEq: R = Variant(L.Get<double>() >= R.Get<double>()); break;
+		// clang-format on
+	case Instruction::Equal:
+	{
+		if (AnyString(L, R))
+			R = Variant(L.Get<String>() == R.Get<String>());
+		else
+			R = Variant(L.Get<double>() == R.Get<double>());
+	}
+	break;
+	case Instruction::NotEqual:
+	{
+		if (AnyString(L, R))
+			R = Variant(L.Get<String>() != R.Get<String>());
+		else
+			R = Variant(L.Get<double>() != R.Get<double>());
+	}
+	break;
+	case Instruction::Ternary:
+	{
+		if (L.Get<bool>())
+			R = C;
+	}
+	break;
+	default: RMLUI_ERRORMSG("Not an operator instruction."); break;
+	}
+}
+
 class DataInterpreter {
 public:
 	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface) :
@@ -963,8 +1017,6 @@ private:
 
 	bool Execute(const Instruction instruction, const Variant& data)
 	{
-		auto AnyString = [](const Variant& v1, const Variant& v2) { return v1.GetType() == Variant::STRING || v2.GetType() == Variant::STRING; };
-
 		switch (instruction)
 		{
 		case Instruction::Push:
@@ -1014,45 +1066,21 @@ private:
 		}
 		break;
 		case Instruction::Add:
-		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() + R.Get<String>());
-			else
-				R = Variant(L.Get<double>() + R.Get<double>());
-		}
-		break;
-			// clang-format off
-		case Instruction::Subtract:  R = Variant(L.Get<double>() - R.Get<double>());  break;
-		case Instruction::Multiply:  R = Variant(L.Get<double>() * R.Get<double>());  break;
-		case Instruction::Divide:    R = Variant(L.Get<double>() / R.Get<double>());  break;
-		case Instruction::Not:       R = Variant(!R.Get<bool>());                     break;
-		case Instruction::And:       R = Variant(L.Get<bool>() && R.Get<bool>());     break;
-		case Instruction::Or:        R = Variant(L.Get<bool>() || R.Get<bool>());     break;
-		case Instruction::Less:      R = Variant(L.Get<double>() < R.Get<double>());  break;
-		case Instruction::LessEq:    R = Variant(L.Get<double>() <= R.Get<double>()); break;
-		case Instruction::Greater:   R = Variant(L.Get<double>() > R.Get<double>());  break;
-		case Instruction::GreaterEq: R = Variant(L.Get<double>() >= R.Get<double>()); break;
-			// clang-format on
+		case Instruction::Subtract:
+		case Instruction::Multiply:
+		case Instruction::Divide:
+		case Instruction::Not:
+		case Instruction::And:
+		case Instruction::Or:
+		case Instruction::Less:
+		case Instruction::LessEq:
+		case Instruction::Greater:
+		case Instruction::GreaterEq:
 		case Instruction::Equal:
-		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() == R.Get<String>());
-			else
-				R = Variant(L.Get<double>() == R.Get<double>());
-		}
-		break;
 		case Instruction::NotEqual:
-		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() != R.Get<String>());
-			else
-				R = Variant(L.Get<double>() != R.Get<double>());
-		}
-		break;
 		case Instruction::Ternary:
 		{
-			if (L.Get<bool>())
-				R = C;
+			ExecuteOperator(instruction, L, C, R);
 		}
 		break;
 		case Instruction::NumArguments:
@@ -1128,6 +1156,831 @@ private:
 	}
 };
 
+/*
+    The typed register machine for RmlUi data expressions.
+
+    After parsing, the program for the abstract machine above is compiled into a typed program. The compiler reconstructs the
+    expression tree from the stack operations, infers the type of each subexpression, and folds constant subexpressions. It then
+    emits instructions operating on separate banks of double, bool, string, and variant registers. Variants are only used at the
+    boundaries: When reading and assigning data variables, when calling transform functions and event callbacks, for subexpressions
+    whose type depends on data variables, and for the final result.
+
+    Literals are placed in registers during compilation, and registers persist between executions to avoid reallocations.
+
+    Notation used in the instruction list below:
+        D, B, S, V  The double, bool, string, and variant register banks, respectively.
+        dst, a, b   Instruction operands, each an index into the register bank specified by the instruction.
+*/
+enum class ValueType : uint8_t { Double, Bool, String, Variant };
+
+enum class TypedInstruction : uint8_t {
+	// clang-format off
+	Variable,            //  V[dst] = DataModel.GetVariable(a)  (a is an index into the variable address list)
+	BoolToDouble,        //  D[dst] = (double)B[a]
+	StringToDouble,      //  D[dst] = (double)S[a]
+	VariantToDouble,     //  D[dst] = (double)V[a]
+	DoubleToBool,        //  B[dst] = (bool)D[a]
+	StringToBool,        //  B[dst] = (bool)S[a]
+	VariantToBool,       //  B[dst] = (bool)V[a]
+	DoubleToString,      //  S[dst] = (String)D[a]
+	BoolToString,        //  S[dst] = (String)B[a]
+	VariantToString,     //  S[dst] = (String)V[a]
+	DoubleToVariant,     //  V[dst] = D[a]
+	BoolToVariant,       //  V[dst] = B[a]
+	StringToVariant,     //  V[dst] = S[a]
+	Add,                 //  D[dst] = D[a] + D[b]
+	Subtract,            //  D[dst] = D[a] - D[b]
+	Multiply,            //  D[dst] = D[a] * D[b]
+	Divide,              //  D[dst] = D[a] / D[b]
+	Less,                //  B[dst] = D[a] < D[b]
+	LessEq,              //  B[dst] = D[a] <= D[b]
+	Greater,             //  B[dst] = D[a] > D[b]
+	GreaterEq,           //  B[dst] = D[a] >= D[b]
+	Equal,               //  B[dst] = D[a] == D[b]
+	NotEqual,            //  B[dst] = D[a] != D[b]
+	Concatenate,         //  S[dst] = S[a] + S[b]
+	EqualString,         //  B[dst] = S[a] == S[b]
+	NotEqualString,      //  B[dst] = S[a] != S[b]
+	Not,                 //  B[dst] = !B[a]
+	And,                 //  B[dst] = B[a] && B[b]
+	Or,                  //  B[dst] = B[a] || B[b]
+	AddVariant,          //  V[dst] = V[a] + V[b]   (Concatenates strings if any operand is a string, otherwise adds numbers)
+	EqualVariant,        //  B[dst] = V[a] == V[b]  (Compares strings if any operand is a string, otherwise compares numbers)
+	NotEqualVariant,     //  B[dst] = V[a] != V[b]  (Compares strings if any operand is a string, otherwise compares numbers)
+	TernaryDouble,       //  D[dst] = B[c] ? D[a] : D[b]
+	TernaryBool,         //  B[dst] = B[c] ? B[a] : B[b]
+	TernaryString,       //  S[dst] = B[c] ? S[a] : S[b]
+	TernaryVariant,      //  V[dst] = B[c] ? V[a] : V[b]
+	TransformFnc,        //  V[dst] = DataModel.Execute(F[c], A)  (A = Arguments[a, a + b], F the function name list)
+	EventFnc,            //  DataModel.EventCallback(F[c], A)     (A = Arguments[a, a + b], F the function name list)
+	Assign,              //  DataModel.SetVariable(dst, V[a])     (dst is an index into the variable address list)
+	// clang-format on
+};
+
+struct TypedInstructionData {
+	TypedInstruction instruction;
+	int dst, a, b, c;
+};
+
+struct TypedArgument {
+	int variant_register;
+	// Constant registers are copied, other registers are moved into the argument list.
+	bool is_constant;
+};
+
+struct CompiledProgram {
+	Vector<TypedInstructionData> instructions;
+	Vector<TypedArgument> arguments;
+	StringList function_names;
+
+	// Direct access to top-level data variables, indexed by the variable address list. Empty for variables that must be resolved
+	// on every execution.
+	Vector<DataVariable> variables;
+
+	Vector<double> doubles;
+	Vector<bool> bools;
+	StringList strings;
+	Vector<Variant> variants;
+	VariantList argument_list;
+
+	ValueType result_type = ValueType::Variant;
+	int result_register = -1;
+	bool result_is_constant = true;
+};
+
+namespace TypedConvert {
+	static double ToDouble(bool value) { return value ? 1.0 : 0.0; }
+	static double ToDouble(const String& value)
+	{
+		double result = 0.0;
+		TypeConverter<String, double>::Convert(value, result);
+		return result;
+	}
+	static bool ToBool(double value) { return value != 0.0; }
+	static bool ToBool(const String& value)
+	{
+		bool result = false;
+		TypeConverter<String, bool>::Convert(value, result);
+		return result;
+	}
+	static void ToStringInto(double value, String& out_value)
+	{
+		out_value.clear();
+		TypeConverter<double, String>::Convert(value, out_value);
+	}
+	static void ToStringInto(bool value, String& out_value)
+	{
+		out_value.clear();
+		TypeConverter<bool, String>::Convert(value, out_value);
+	}
+	static void ToStringInto(const Variant& value, String& out_value)
+	{
+		out_value.clear();
+		value.GetInto(out_value);
+	}
+} // namespace TypedConvert
+
+class DataCompiler {
+public:
+	DataCompiler(const Program& program, const AddressList& addresses, const DataExpressionInterface& expression_interface) :
+		program(program), addresses(addresses), expression_interface(expression_interface)
+	{}
+
+	// Returns null if the program contains instructions not supported by the compiler, it should then be run by the data interpreter.
+	UniquePtr<CompiledProgram> Compile()
+	{
+		nodes.clear();
+		statements.clear();
+		result = MakeUnique<CompiledProgram>();
+
+		int result_node = -1;
+		if (!BuildTree(result_node))
+			return nullptr;
+
+		for (int statement : statements)
+			EmitNode(statement);
+
+		if (result_node >= 0)
+		{
+			const Node& node = EmitNode(result_node);
+			result->result_type = node.type;
+			result->result_register = node.reg;
+			result->result_is_constant = IsConstant(result_node);
+		}
+
+		result->variables.resize(addresses.size());
+		for (size_t i = 0; i < addresses.size(); i++)
+		{
+			// Top-level variables are never removed from the data model, thus their handles can be stored.
+			if (addresses[i].size() == 1)
+				result->variables[i] = expression_interface.GetVariable(addresses[i]);
+		}
+
+		return std::move(result);
+	}
+
+private:
+	struct Node {
+		Instruction instruction;
+		ValueType type;
+		// Operand nodes as [L, C, R] according to the registers used by the corresponding instruction, or -1 if unused.
+		int operands[3];
+		// The literal value, variable address index, or function name.
+		Variant data;
+		// Function argument nodes.
+		Vector<int> arguments;
+		// False if the node or any of its operands invokes transform functions, event callbacks, or assignments.
+		bool pure;
+		// The register of the node's value in the bank of its type, set during emission.
+		int reg;
+	};
+
+	static ValueType GetValueType(const Variant& value)
+	{
+		switch (value.GetType())
+		{
+		case Variant::DOUBLE: return ValueType::Double;
+		case Variant::BOOL: return ValueType::Bool;
+		case Variant::STRING: return ValueType::String;
+		default: break;
+		}
+		return ValueType::Variant;
+	}
+	static bool IsNumeric(ValueType type) { return type == ValueType::Double || type == ValueType::Bool; }
+
+	bool IsLiteral(int node_index) const { return nodes[node_index].instruction == Instruction::Literal; }
+	// Returns true if the node's value is stored in a constant register, assignments evaluate to the register of their value.
+	bool IsConstant(int node_index) const
+	{
+		const Node& node = nodes[node_index];
+		return node.instruction == Instruction::Literal || (node.instruction == Instruction::Assign && IsConstant(node.operands[2]));
+	}
+
+	int AddNode(Instruction instruction, ValueType type, int operand0 = -1, int operand1 = -1, int operand2 = -1, Variant data = Variant())
+	{
+		bool pure = !(instruction == Instruction::TransformFnc || instruction == Instruction::EventFnc || instruction == Instruction::Assign);
+		for (int operand : {operand0, operand1, operand2})
+		{
+			if (operand >= 0)
+				pure &= nodes[operand].pure;
+		}
+		nodes.push_back(Node{instruction, type, {operand0, operand1, operand2}, std::move(data), {}, pure, -1});
+		return int(nodes.size()) - 1;
+	}
+
+	int AddLiteral(Variant value)
+	{
+		const ValueType type = GetValueType(value);
+		return AddNode(Instruction::Literal, type, -1, -1, -1, std::move(value));
+	}
+
+	int AddOperator(Instruction instruction, int left, int center, int right)
+	{
+		// Fold operators with constant operands, using the same rules as the data interpreter.
+		if (instruction == Instruction::Ternary && IsLiteral(left))
+		{
+			const bool condition = nodes[left].data.Get<bool>();
+			const int discarded = (condition ? right : center);
+			if (nodes[discarded].pure)
+				return condition ? center : right;
+		}
+		else if ((left < 0 || IsLiteral(left)) && (center < 0 || IsLiteral(center)) && IsLiteral(right))
+		{
+			Variant value = nodes[right].data;
+			ExecuteOperator(instruction, left >= 0 ? nodes[left].data : Variant(), center >= 0 ? nodes[center].data : Variant(), value);
+			return AddLiteral(std::move(value));
+		}
+
+		ValueType type = ValueType::Variant;
+		switch (instruction)
+		{
+		case Instruction::Add:
+		{
+			const ValueType left_type = nodes[left].type, right_type = nodes[right].type;
+			if (left_type == ValueType::String || right_type == ValueType::String)
+				type = ValueType::String;
+			else if (IsNumeric(left_type) && IsNumeric(right_type))
+				type = ValueType::Double;
+		}
+		break;
+		case Instruction::Subtract:
+		case Instruction::Multiply:
+		case Instruction::Divide: type = ValueType::Double; break;
+		case Instruction::Not:
+		case Instruction::And:
+		case Instruction::Or:
+		case Instruction::Less:
+		case Instruction::LessEq:
+		case Instruction::Greater:
+		case Instruction::GreaterEq:
+		case Instruction::Equal:
+		case Instruction::NotEqual: type = ValueType::Bool; break;
+		case Instruction::Ternary:
+		{
+			if (nodes[center].type == nodes[right].type)
+				type = nodes[center].type;
+		}
+		break;
+		default: RMLUI_ERRORMSG("Not an operator instruction."); break;
+		}
+
+		return AddNode(instruction, type, left, center, right);
+	}
+
+	bool BuildTree(int& out_result_node)
+	{
+		// Execute the program symbolically, with registers and the stack containing node indices instead of values.
+		int R = -1, L = -1, C = -1;
+		Vector<int> stack;
+
+		for (const InstructionData& instruction_data : program)
+		{
+			const Instruction instruction = instruction_data.instruction;
+			const Variant& data = instruction_data.data;
+
+			switch (instruction)
+			{
+			case Instruction::Push:
+			{
+				stack.push_back(R);
+				R = -1;
+			}
+			break;
+			case Instruction::Pop:
+			{
+				if (stack.empty())
+					return false;
+
+				switch (Register(data.Get<int>(-1)))
+				{
+				// clang-format off
+				case Register::R: R = stack.back(); break;
+				case Register::L: L = stack.back(); break;
+				case Register::C: C = stack.back(); break;
+				// clang-format on
+				default: return false;
+				}
+				stack.pop_back();
+			}
+			break;
+			case Instruction::Literal:
+			{
+				R = AddLiteral(data);
+			}
+			break;
+			case Instruction::Variable:
+			{
+				const int address_index = data.Get<int>(-1);
+				if (address_index < 0 || address_index >= int(addresses.size()))
+					return false;
+				R = AddNode(Instruction::Variable, ValueType::Variant, -1, -1, -1, Variant(address_index));
+			}
+			break;
+			case Instruction::Add:
+			case Instruction::Subtract:
+			case Instruction::Multiply:
+			case Instruction::Divide:
+			case Instruction::And:
+			case Instruction::Or:
+			case Instruction::Less:
+			case Instruction::LessEq:
+			case Instruction::Greater:
+			case Instruction::GreaterEq:
+			case Instruction::Equal:
+			case Instruction::NotEqual:
+			{
+				if (L < 0 || R < 0)
+					return false;
+				R = AddOperator(instruction, L, -1, R);
+			}
+			break;
+			case Instruction::Not:
+			{
+				if (R < 0)
+					return false;
+				R = AddOperator(instruction, -1, -1, R);
+			}
+			break;
+			case Instruction::Ternary:
+			{
+				if (L < 0 || C < 0 || R < 0)
+					return false;
+				R = AddOperator(instruction, L, C, R);
+			}
+			break;
+			case Instruction::NumArguments:
+			{
+				num_arguments = data.Get<int>(-1);
+				R = -1;
+			}
+			break;
+			case Instruction::TransformFnc:
+			case Instruction::EventFnc:
+			{
+				if (num_arguments < 0 || stack.size() < size_t(num_arguments))
+					return false;
+
+				Vector<int> arguments(stack.end() - num_arguments, stack.end());
+				stack.resize(stack.size() - size_t(num_arguments));
+				num_arguments = -1;
+
+				for (int argument : arguments)
+				{
+					if (argument < 0)
+						return false;
+				}
+
+				R = AddNode(instruction, ValueType::Variant, -1, -1, -1, data);
+				nodes[R].arguments = std::move(arguments);
+
+				if (instruction == Instruction::EventFnc)
+					statements.push_back(R);
+			}
+			break;
+			case Instruction::Assign:
+			{
+				const int address_index = data.Get<int>(-1);
+				if (R < 0 || address_index < 0 || address_index >= int(addresses.size()))
+					return false;
+				R = AddNode(Instruction::Assign, ValueType::Variant, -1, -1, R, Variant(address_index));
+				statements.push_back(R);
+			}
+			break;
+			case Instruction::DynamicVariable:
+			case Instruction::CastToInt:
+			default:
+				// Not supported by the compiler, leave these programs to the interpreter.
+				return false;
+			}
+		}
+
+		if (!stack.empty())
+			return false;
+
+		out_result_node = R;
+		return true;
+	}
+
+	int AddRegister(ValueType type)
+	{
+		switch (type)
+		{
+		case ValueType::Double: result->doubles.push_back(0.0); return int(result->doubles.size()) - 1;
+		case ValueType::Bool: result->bools.push_back(false); return int(result->bools.size()) - 1;
+		case ValueType::String: result->strings.emplace_back(); return int(result->strings.size()) - 1;
+		case ValueType::Variant: result->variants.emplace_back(); return int(result->variants.size()) - 1;
+		}
+		return -1;
+	}
+
+	int AddConstantRegister(ValueType type, const Variant& value)
+	{
+		const int reg = AddRegister(type);
+		switch (type)
+		{
+		case ValueType::Double: result->doubles[reg] = value.Get<double>(); break;
+		case ValueType::Bool: result->bools[reg] = value.Get<bool>(); break;
+		case ValueType::String: result->strings[reg] = value.Get<String>(); break;
+		case ValueType::Variant: result->variants[reg] = value; break;
+		}
+		return reg;
+	}
+
+	void Emit(TypedInstruction instruction, int dst, int a = -1, int b = -1, int c = -1)
+	{
+		result->instructions.push_back(TypedInstructionData{instruction, dst, a, b, c});
+	}
+
+	// Emits the node if needed, and returns the register of its value in the bank of the requested type.
+	int EmitNodeAs(int node_index, ValueType type)
+	{
+		const Node& node = EmitNode(node_index);
+		if (node.type == type)
+			return node.reg;
+
+		if (node.instruction == Instruction::Literal)
+			return AddConstantRegister(type, node.data);
+
+		const int reg = AddRegister(type);
+
+		// Conversion instructions indexed by [from][to] value types, the diagonal is unused.
+		using T = TypedInstruction;
+		static const TypedInstruction conversions[4][4] = {
+			{T::DoubleToVariant, T::DoubleToBool, T::DoubleToString, T::DoubleToVariant},
+			{T::BoolToDouble, T::BoolToVariant, T::BoolToString, T::BoolToVariant},
+			{T::StringToDouble, T::StringToBool, T::StringToVariant, T::StringToVariant},
+			{T::VariantToDouble, T::VariantToBool, T::VariantToString, T::VariantToDouble},
+		};
+		const TypedInstruction conversion = conversions[int(node.type)][int(type)];
+
+		Emit(conversion, reg, node.reg);
+		return reg;
+	}
+
+	const Node& EmitNode(int node_index)
+	{
+		if (nodes[node_index].reg >= 0)
+			return nodes[node_index];
+
+		// Copy the node fields we need, the node vector is not modified but recursion may reference nodes.
+		const Instruction instruction = nodes[node_index].instruction;
+		const ValueType type = nodes[node_index].type;
+		const int left = nodes[node_index].operands[0];
+		const int center = nodes[node_index].operands[1];
+		const int right = nodes[node_index].operands[2];
+
+		int reg = -1;
+
+		switch (instruction)
+		{
+		case Instruction::Literal:
+		{
+			reg = AddConstantRegister(type, nodes[node_index].data);
+		}
+		break;
+		case Instruction::Variable:
+		{
+			reg = AddRegister(ValueType::Variant);
+			Emit(TypedInstruction::Variable, reg, nodes[node_index].data.Get<int>());
+		}
+		break;
+		case Instruction::Add:
+		{
+			TypedInstruction typed_instruction = TypedInstruction::Add;
+			if (type == ValueType::String)
+				typed_instruction = TypedInstruction::Concatenate;
+			else if (type == ValueType::Variant)
+				typed_instruction = TypedInstruction::AddVariant;
+
+			const int a = EmitNodeAs(left, type);
+			const int b = EmitNodeAs(right, type);
+			reg = AddRegister(type);
+			Emit(typed_instruction, reg, a, b);
+		}
+		break;
+		case Instruction::Subtract:
+		case Instruction::Multiply:
+		case Instruction::Divide:
+		case Instruction::Less:
+		case Instruction::LessEq:
+		case Instruction::Greater:
+		case Instruction::GreaterEq:
+		{
+			// clang-format off
+			TypedInstruction typed_instruction = TypedInstruction::Subtract;
+			switch (instruction)
+			{
+			case Instruction::Multiply:  typed_instruction = TypedInstruction::Multiply;  break;
+			case Instruction::Divide:    typed_instruction = TypedInstruction::Divide;    break;
+			case Instruction::Less:      typed_instruction = TypedInstruction::Less;      break;
+			case Instruction::LessEq:    typed_instruction = TypedInstruction::LessEq;    break;
+			case Instruction::Greater:   typed_instruction = TypedInstruction::Greater;   break;
+			case Instruction::GreaterEq: typed_instruction = TypedInstruction::GreaterEq; break;
+			default: break;
+			}
+			// clang-format on
+
+			const int a = EmitNodeAs(left, ValueType::Double);
+			const int b = EmitNodeAs(right, ValueType::Double);
+			reg = AddRegister(type);
+			Emit(typed_instruction, reg, a, b);
+		}
+		break;
+		case Instruction::Equal:
+		case Instruction::NotEqual:
+		{
+			const bool equal = (instruction == Instruction::Equal);
+			const ValueType left_type = nodes[left].type, right_type = nodes[right].type;
+
+			ValueType operand_type = ValueType::Variant;
+			TypedInstruction typed_instruction = (equal ? TypedInstruction::EqualVariant : TypedInstruction::NotEqualVariant);
+			if (left_type == ValueType::String || right_type == ValueType::String)
+			{
+				operand_type = ValueType::String;
+				typed_instruction = (equal ? TypedInstruction::EqualString : TypedInstruction::NotEqualString);
+			}
+			else if (IsNumeric(left_type) && IsNumeric(right_type))
+			{
+				operand_type = ValueType::Double;
+				typed_instruction = (equal ? TypedInstruction::Equal : TypedInstruction::NotEqual);
+			}
+
+			const int a = EmitNodeAs(left, operand_type);
+			const int b = EmitNodeAs(right, operand_type);
+			reg = AddRegister(ValueType::Bool);
+			Emit(typed_instruction, reg, a, b);
+		}
+		break;
+		case Instruction::Not:
+		{
+			const int a = EmitNodeAs(right, ValueType::Bool);
+			reg = AddRegister(ValueType::Bool);
+			Emit(TypedInstruction::Not, reg, a);
+		}
+		break;
+		case Instruction::And:
+		case Instruction::Or:
+		{
+			const int a = EmitNodeAs(left, ValueType::Bool);
+			const int b = EmitNodeAs(right, ValueType::Bool);
+			reg = AddRegister(ValueType::Bool);
+			Emit(instruction == Instruction::And ? TypedInstruction::And : TypedInstruction::Or, reg, a, b);
+		}
+		break;
+		case Instruction::Ternary:
+		{
+			// clang-format off
+			TypedInstruction typed_instruction = TypedInstruction::TernaryVariant;
+			switch (type)
+			{
+			case ValueType::Double:  typed_instruction = TypedInstruction::TernaryDouble;  break;
+			case ValueType::Bool:    typed_instruction = TypedInstruction::TernaryBool;    break;
+			case ValueType::String:  typed_instruction = TypedInstruction::TernaryString;  break;
+			case ValueType::Variant: typed_instruction = TypedInstruction::TernaryVariant; break;
+			}
+			// clang-format on
+
+			const int condition = EmitNodeAs(left, ValueType::Bool);
+			const int a = EmitNodeAs(center, type);
+			const int b = EmitNodeAs(right, type);
+			reg = AddRegister(type);
+			Emit(typed_instruction, reg, a, b, condition);
+		}
+		break;
+		case Instruction::TransformFnc:
+		case Instruction::EventFnc:
+		{
+			const Vector<int> arguments = nodes[node_index].arguments;
+			Vector<TypedArgument> typed_arguments;
+			typed_arguments.reserve(arguments.size());
+			for (int argument : arguments)
+			{
+				const int argument_reg = EmitNodeAs(argument, ValueType::Variant);
+				typed_arguments.push_back(TypedArgument{argument_reg, IsLiteral(argument)});
+			}
+
+			const int first_argument = int(result->arguments.size());
+			result->arguments.insert(result->arguments.end(), typed_arguments.begin(), typed_arguments.end());
+
+			const int function_index = int(result->function_names.size());
+			result->function_names.push_back(nodes[node_index].data.Get<String>());
+
+			// Event callbacks have no result, their register is left empty.
+			reg = AddRegister(ValueType::Variant);
+			Emit(instruction == Instruction::TransformFnc ? TypedInstruction::TransformFnc : TypedInstruction::EventFnc, reg, first_argument,
+				int(arguments.size()), function_index);
+		}
+		break;
+		case Instruction::Assign:
+		{
+			// The assignment evaluates to its assigned value.
+			reg = EmitNodeAs(right, ValueType::Variant);
+			Emit(TypedInstruction::Assign, nodes[node_index].data.Get<int>(), reg);
+		}
+		break;
+		default: RMLUI_ERRORMSG("Instruction not supported by the data compiler."); break;
+		}
+
+		nodes[node_index].reg = reg;
+		return nodes[node_index];
+	}
+
+	const Program& program;
+	const AddressList& addresses;
+	const DataExpressionInterface& expression_interface;
+
+	Vector<Node> nodes;
+	Vector<int> statements;
+	int num_arguments = -1;
+
+	UniquePtr<CompiledProgram> result;
+};
+
+class DataTypedInterpreter {
+public:
+	DataTypedInterpreter(CompiledProgram& program, const AddressList& addresses, DataExpressionInterface expression_interface) :
+		program(program), addresses(addresses), expression_interface(expression_interface)
+	{}
+
+	bool Error(const String& message) const
+	{
+		Log::Message(Log::LT_WARNING, "Error during execution. %s", message.c_str());
+		RMLUI_ERROR;
+		return false;
+	}
+
+	bool Run()
+	{
+		for (const TypedInstructionData& instruction : program.instructions)
+		{
+			if (!Execute(instruction))
+				return false;
+		}
+		return true;
+	}
+
+	// Retrieves the result, can only be called once after each run.
+	void GetResult(Variant& out_value)
+	{
+		const int reg = program.result_register;
+		if (reg < 0)
+		{
+			out_value.Clear();
+			return;
+		}
+
+		switch (program.result_type)
+		{
+		case ValueType::Double: out_value = program.doubles[reg]; break;
+		case ValueType::Bool: out_value = bool(program.bools[reg]); break;
+		case ValueType::String:
+		{
+			if (program.result_is_constant)
+				out_value = program.strings[reg];
+			else
+				out_value = std::move(program.strings[reg]);
+		}
+		break;
+		case ValueType::Variant:
+		{
+			if (program.result_is_constant)
+				out_value = program.variants[reg];
+			else
+				out_value = std::move(program.variants[reg]);
+		}
+		break;
+		}
+	}
+
+private:
+	CompiledProgram& program;
+	const AddressList& addresses;
+	DataExpressionInterface expression_interface;
+
+	bool Execute(const TypedInstructionData& instruction)
+	{
+		using namespace TypedConvert;
+		auto AnyString = [](const Variant& v1, const Variant& v2) { return v1.GetType() == Variant::STRING || v2.GetType() == Variant::STRING; };
+
+		Vector<double>& D = program.doubles;
+		Vector<bool>& B = program.bools;
+		StringList& S = program.strings;
+		Vector<Variant>& V = program.variants;
+
+		const int dst = instruction.dst, a = instruction.a, b = instruction.b, c = instruction.c;
+
+		switch (instruction.instruction)
+		{
+		case TypedInstruction::Variable:
+		{
+			DataVariable& variable = program.variables[a];
+			if (!variable)
+			{
+				V[dst] = expression_interface.GetValue(addresses[a]);
+			}
+			else if (!variable.Get(V[dst]))
+			{
+				V[dst].Clear();
+				Log::Message(Log::LT_WARNING, "Could not get value from data variable '%s'.", addresses[a].front().name.c_str());
+			}
+		}
+		break;
+			// clang-format off
+		case TypedInstruction::BoolToDouble:    D[dst] = ToDouble(bool(B[a]));   break;
+		case TypedInstruction::StringToDouble:  D[dst] = ToDouble(S[a]);         break;
+		case TypedInstruction::VariantToDouble: D[dst] = V[a].Get<double>();     break;
+		case TypedInstruction::DoubleToBool:    B[dst] = ToBool(D[a]);           break;
+		case TypedInstruction::StringToBool:    B[dst] = ToBool(S[a]);           break;
+		case TypedInstruction::VariantToBool:   B[dst] = V[a].Get<bool>();       break;
+		case TypedInstruction::DoubleToString:  ToStringInto(D[a], S[dst]);      break;
+		case TypedInstruction::BoolToString:    ToStringInto(bool(B[a]), S[dst]); break;
+		case TypedInstruction::VariantToString: ToStringInto(V[a], S[dst]);      break;
+		case TypedInstruction::DoubleToVariant: V[dst] = D[a];                   break;
+		case TypedInstruction::BoolToVariant:   V[dst] = bool(B[a]);             break;
+		case TypedInstruction::StringToVariant: V[dst] = S[a];                   break;
+		case TypedInstruction::Add:             D[dst] = D[a] + D[b];            break;
+		case TypedInstruction::Subtract:        D[dst] = D[a] - D[b];            break;
+		case TypedInstruction::Multiply:        D[dst] = D[a] * D[b];            break;
+		case TypedInstruction::Divide:          D[dst] = D[a] / D[b];            break;
+		case TypedInstruction::Less:            B[dst] = D[a] < D[b];            break;
+		case TypedInstruction::LessEq:          B[dst] = D[a] <= D[b];           break;
+		case TypedInstruction::Greater:         B[dst] = D[a] > D[b];            break;
+		case TypedInstruction::GreaterEq:       B[dst] = D[a] >= D[b];           break;
+		case TypedInstruction::Equal:           B[dst] = D[a] == D[b];           break;
+		case TypedInstruction::NotEqual:        B[dst] = D[a] != D[b];           break;
+		case TypedInstruction::Concatenate:     S[dst] = S[a]; S[dst] += S[b];   break;
+		case TypedInstruction::EqualString:     B[dst] = S[a] == S[b];           break;
+		case TypedInstruction::NotEqualString:  B[dst] = S[a] != S[b];           break;
+		case TypedInstruction::Not:             B[dst] = !B[a];                  break;
+		case TypedInstruction::And:             B[dst] = B[a] && B[b];           break;
+		case TypedInstruction::Or:              B[dst] = B[a] || B[b];           break;
+		case TypedInstruction::TernaryDouble:   D[dst] = B[c] ? D[a] : D[b];     break;
+		case TypedInstruction::TernaryBool:     B[dst] = B[c] ? B[a] : B[b];     break;
+		case TypedInstruction::TernaryString:   S[dst] = B[c] ? S[a] : S[b];     break;
+		case TypedInstruction::TernaryVariant:  V[dst] = B[c] ? V[a] : V[b];     break;
+			// clang-format on
+		case TypedInstruction::AddVariant:
+		{
+			if (AnyString(V[a], V[b]))
+				V[dst] = V[a].Get<String>() + V[b].Get<String>();
+			else
+				V[dst] = V[a].Get<double>() + V[b].Get<double>();
+		}
+		break;
+		case TypedInstruction::EqualVariant:
+		case TypedInstruction::NotEqualVariant:
+		{
+			bool equal = false;
+			if (AnyString(V[a], V[b]))
+				equal = (V[a].Get<String>() == V[b].Get<String>());
+			else
+				equal = (V[a].Get<double>() == V[b].Get<double>());
+			B[dst] = (instruction.instruction == TypedInstruction::EqualVariant ? equal : !equal);
+		}
+		break;
+		case TypedInstruction::TransformFnc:
+		case TypedInstruction::EventFnc:
+		{
+			VariantList& arguments = program.argument_list;
+			arguments.resize(size_t(b));
+			for (int i = 0; i < b; i++)
+			{
+				const TypedArgument& argument = program.arguments[a + i];
+				if (argument.is_constant)
+					arguments[i] = V[argument.variant_register];
+				else
+					arguments[i] = std::move(V[argument.variant_register]);
+			}
+
+			const String& function_name = program.function_names[c];
+			const bool is_transform = (instruction.instruction == TypedInstruction::TransformFnc);
+			const bool result = (is_transform ? expression_interface.CallTransform(function_name, arguments, V[dst])
+											  : expression_interface.EventCallback(function_name, arguments));
+			if (!result)
+			{
+				String arguments_str;
+				for (size_t i = 0; i < arguments.size(); i++)
+				{
+					arguments_str += arguments[i].Get<String>();
+					if (i < arguments.size() - 1)
+						arguments_str += ", ";
+				}
+				return Error(CreateString(60 + function_name.size() + arguments_str.size(), "Failed to execute %s: %s(%s)",
+					is_transform ? "transform function" : "event callback", function_name.c_str(), arguments_str.c_str()));
+			}
+		}
+		break;
+		case TypedInstruction::Assign:
+		{
+			if (!expression_interface.SetValue(addresses[dst], V[a]))
+				return Error("Could not assign to variable.");
+		}
+		break;
+		}
+		return true;
+	}
+};
+
 DataExpression::DataExpression(String expression) : expression(std::move(expression)) {}
 
 DataExpression::~DataExpression() {}
@@ -1141,11 +1994,30 @@ bool DataExpression::Parse(const DataExpressionInterface& expression_interface,
 	program = parser.ReleaseProgram();
 	addresses = parser.ReleaseAddresses();
 
+	DataCompiler compiler(program, addresses, expression_interface);
+	compiled_program = compiler.Compile();
+
 	return true;
 }
 
 bool DataExpression::Run(const DataExpressionInterface& expression_interface, Variant& out_value)
 {
+	if (compiled_program)
+	{
+		DataTypedInterpreter interpreter(*compiled_program, addresses, expression_interface);
+
+		if (!interpreter.Run())
+		{
+			String program_str = DumpProgram(program);
+			Log::Message(Log::LT_WARNING, "Failed to execute compiled program from %zu instructions:", program.size());
+			Log::Message(Log::LT_WARNING, "%s", program_str.c_str());
+			return false;
+		}
+
+		interpreter.GetResult(out_value);
+		return true;
+	}
+
 	DataInterpreter interpreter(program, addresses, expression_interface);
 
 	if (!interpreter.Run())
@@ -1195,6 +2067,13 @@ Variant DataExpressionInterface::GetValue(const DataAddress& address) const
 	return result;
 }
 
+DataVariable DataExpressionInterface::GetVariable(const DataAddress& address) const
+{
+	if (address.size() == 2 && address.front().name == "ev")
+		return DataVariable();
+	return data_model ? data_model->GetVariable(address) : DataVariable();
+}
+
 bool DataExpressionInterface::SetValue(const DataAddress& address, const Variant& value) const
 {
 	bool result = false;
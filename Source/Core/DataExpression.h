@@ -37,7 +37,9 @@ namespace Rml {
 
 class Element;
 class DataModel;
+class DataVariable;
 struct InstructionData;
+struct CompiledProgram;
 using Program = Vector<InstructionData>;
 using AddressList = Vector<DataAddress>;
 
@@ -48,6 +50,7 @@ public:
 
 	DataAddress ParseAddress(const String& address_str) const;
 	Variant GetValue(const DataAddress& address) const;
+	DataVariable GetVariable(const DataAddress& address) const;
 	bool SetValue(const DataAddress& address, const Variant& value) const;
 	bool CallTransform(const String& name, const VariantList& arguments, Variant& out_result);
 	bool EventCallback(const String& name, const VariantList& arguments);
@@ -75,6 +78,9 @@ private:
 
 	Program program;
 	AddressList addresses;
+
+	// Typed program compiled from the above program, or null if it could not be compiled.
+	UniquePtr<CompiledProgram> compiled_program;
 };
 
 } // namespace Rml
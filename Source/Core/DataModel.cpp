@@ -351,6 +351,7 @@ void DataModel::DirtyVariable(const String& variable_name)
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
 	RMLUI_ASSERTMSG(variables.count(variable_name) == 1, "In DirtyVariable: Variable name not found among added variables.");
 	dirty_variables.emplace(variable_name);
+	views->OnVariableDirty(variable_name);
 }
 
 bool DataModel::IsVariableDirty(const String& variable_name) const
@@ -365,6 +366,7 @@ void DataModel::DirtyAllVariables()
 	for (const auto& variable : variables)
 	{
 		dirty_variables.emplace(variable.first);
+		views->OnVariableDirty(variable.first);
 	}
 }
 
@@ -393,9 +395,9 @@ void DataModel::OnElementRemove(Element* element)
 	attached_elements.erase(element);
 }
 
-bool DataModel::Update(bool clear_dirty_variables)
+bool DataModel::Update(bool clear_dirty_variables, bool limit_view_updates)
 {
-	const bool result = views->Update(*this, dirty_variables);
+	const bool result = views->Update(*this, limit_view_updates ? max_views_per_update : 0);
 
 	if (clear_dirty_variables)
 		dirty_variables.clear();
@@ -403,4 +405,14 @@ bool DataModel::Update(bool clear_dirty_variables)
 	return result;
 }
 
+bool DataModel::HasPendingViewUpdates() const
+{
+	return views->HasPendingUpdates();
+}
+
+int DataModel::GetNumViewsUpdated() const
+{
+	return views->GetNumViewsUpdated();
+}
+
 } // namespace Rml
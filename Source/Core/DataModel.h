@@ -78,10 +78,20 @@ public:
 
 	void OnElementRemove(Element* element);
 
-	bool Update(bool clear_dirty_variables);
+	// Updates views affected by dirty variables.
+	// @param[in] limit_view_updates Limit the number of view updates to the maximum set for this model, remaining views are carried over.
+	// @return True if any view update resulted in a document change.
+	bool Update(bool clear_dirty_variables, bool limit_view_updates);
+	bool HasPendingViewUpdates() const;
+	int GetNumViewsUpdated() const;
+
+	void SetMaxViewsPerUpdate(int max_views) { max_views_per_update = max_views; }
 
 	inline DataTypeRegister* GetDataTypeRegister() const { return data_type_register; }
 
+	void SetTranslateNumericText(bool translate) { translate_numeric_text = translate; }
+	bool GetTranslateNumericText() const { return translate_numeric_text; }
+
 private:
 	UniquePtr<DataViews> views;
 	UniquePtr<DataControllers> controllers;
@@ -98,6 +108,9 @@ private:
 	DataTypeRegister* data_type_register;
 
 	SmallUnorderedSet<Element*> attached_elements;
+
+	bool translate_numeric_text = true;
+	int max_views_per_update = 0;
 };
 
 } // namespace Rml
@@ -48,6 +48,16 @@ void DataModelHandle::DirtyAllVariables()
 	model->DirtyAllVariables();
 }
 
+void DataModelHandle::SetMaxViewsPerUpdate(int max_views)
+{
+	model->SetMaxViewsPerUpdate(max_views);
+}
+
+int DataModelHandle::GetNumViewsUpdated() const
+{
+	return model->GetNumViewsUpdated();
+}
+
 DataModelConstructor::DataModelConstructor() : model(nullptr), type_register(nullptr) {}
 
 DataModelConstructor::DataModelConstructor(DataModel* model) : model(model), type_register(model->GetDataTypeRegister())
@@ -70,6 +80,11 @@ bool DataModelConstructor::BindEventCallback(const String& name, DataEventFunc e
 	return model->BindEventCallback(name, std::move(event_func));
 }
 
+void DataModelConstructor::SetTranslateNumericText(bool translate)
+{
+	model->SetTranslateNumericText(translate);
+}
+
 bool DataModelConstructor::BindVariable(const String& name, DataVariable data_variable)
 {
 	return model->BindVariable(name, data_variable);
@@ -79,6 +79,20 @@ void DataViews::OnElementRemove(Element* element)
 		auto& view = *it;
 		if (view && view->GetElement() == element)
 		{
+			// Unregister the view right away so that it can no longer be scheduled. If it is already in the queue, the entry is skipped.
+			for (const String& variable_name : view->GetVariableNameList())
+			{
+				auto pair = name_view_map.equal_range(variable_name);
+				for (auto it_name = pair.first; it_name != pair.second;)
+				{
+					if (it_name->second == view.get())
+						it_name = name_view_map.erase(it_name);
+					else
+						++it_name;
+				}
+			}
+			view->queued = false;
+
 			views_to_remove.push_back(std::move(view));
 			it = views.erase(it);
 		}
@@ -87,80 +101,132 @@ void DataViews::OnElementRemove(Element* element)
 	}
 }
 
-bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
+void DataViews::OnVariableDirty(const String& variable_name)
 {
-	bool result = false;
-	size_t num_dirty_variables_prev = 0;
+	auto pair = name_view_map.equal_range(variable_name);
+	for (auto it = pair.first; it != pair.second; ++it)
+		Enqueue(it->second);
+}
+
+bool DataViews::CompareQueueEntries(const QueueEntry& left, const QueueEntry& right)
+{
+	// Heap functions place the greatest element first, reverse the order so that we pop the lowest pass and sort order first.
+	if (left.pass != right.pass)
+		return left.pass > right.pass;
+	return left.sort_order > right.sort_order;
+}
+
+void DataViews::Enqueue(DataView* view)
+{
+	RMLUI_ASSERT(view);
+	if (view->queued)
+		return;
+
+	view->queued = true;
+	queue.push_back(QueueEntry{queue_pass, view->GetSortOrder(), view});
+	std::push_heap(queue.begin(), queue.end(), CompareQueueEntries);
+}
 
-	// View updates may result in newly added views, or even new dirty variables. Thus, we do the
-	// update recursively but with an upper limit. Without the loop, newly added views won't be
-	// updated until the next Update() call.
-	for (int i = 0; (i == 0 || !views_to_add.empty() || num_dirty_variables_prev != dirty_variables.size()) && i < 10; i++)
+void DataViews::AddPendingViews()
+{
+	if (views_to_add.empty())
+		return;
+
+	// Newly added views are always updated once.
+	views.reserve(views.size() + views_to_add.size());
+	for (auto&& view : views_to_add)
 	{
-		num_dirty_variables_prev = dirty_variables.size();
+		for (const String& variable_name : view->GetVariableNameList())
+			name_view_map.emplace(variable_name, view.get());
 
-		Vector<DataView*> dirty_views;
+		Enqueue(view.get());
+		views.push_back(std::move(view));
+	}
+	views_to_add.clear();
+}
 
-		if (!views_to_add.empty())
-		{
-			views.reserve(views.size() + views_to_add.size());
-			for (auto&& view : views_to_add)
-			{
-				dirty_views.push_back(view.get());
-				for (const String& variable_name : view->GetVariableNameList())
-					name_view_map.emplace(variable_name, view.get());
+void DataViews::RemovePendingViews()
+{
+	if (views_to_remove.empty())
+		return;
 
-				views.push_back(std::move(view));
-			}
-			views_to_add.clear();
-		}
+	// Removed views may still be referenced by entries in the queue, purge these entries before the views are destroyed.
+	auto it_remove = std::remove_if(queue.begin(), queue.end(), [](const QueueEntry& entry) { return !entry.view->queued; });
+	if (it_remove != queue.end())
+	{
+		queue.erase(it_remove, queue.end());
+		std::make_heap(queue.begin(), queue.end(), CompareQueueEntries);
+	}
 
-		for (const String& variable_name : dirty_variables)
-		{
-			auto pair = name_view_map.equal_range(variable_name);
-			for (auto it = pair.first; it != pair.second; ++it)
-				dirty_views.push_back(it->second);
-		}
+	views_to_remove.clear();
+}
 
-		// Remove duplicate entries
-		std::sort(dirty_views.begin(), dirty_views.end());
-		auto it_remove = std::unique(dirty_views.begin(), dirty_views.end());
-		dirty_views.erase(it_remove, dirty_views.end());
+bool DataViews::Update(DataModel& model, int max_views_updated)
+{
+	num_views_updated = 0;
 
-		// Sort by the element's depth in the document tree so that any structural changes due to a changed variable are reflected in the element's
-		// children. Eg. the 'data-for' view will remove children if any of its data variable array size is reduced.
-		std::sort(dirty_views.begin(), dirty_views.end(), [](auto&& left, auto&& right) { return left->GetSortOrder() < right->GetSortOrder(); });
+	if (!HasPendingUpdates())
+		return false;
 
-		for (DataView* view : dirty_views)
-		{
-			RMLUI_ASSERT(view);
-			if (!view)
-				continue;
+	bool result = false;
+	bool budget_exhausted = false;
 
-			if (view->IsValid())
-				result |= view->Update(model);
-		}
+	// View updates may result in newly added views, or even new dirty variables. These are scheduled for the next pass, with an upper limit on
+	// the number of passes. Without the passes, newly added views won't be updated until the next Update() call. Any views remaining in the
+	// queue are carried over to the next call.
+	for (int i = 0; i < 10 && !budget_exhausted; i++)
+	{
+		AddPendingViews();
+
+		const int current_pass = queue_pass;
+		queue_pass += 1;
 
-		// Destroy views marked for destruction
-		// @performance: Horrible...
-		if (!views_to_remove.empty())
+		// Views are popped by the element's depth in the document tree so that any structural changes due to a changed variable are reflected in
+		// the element's children. Eg. the 'data-for' view will remove children if any of its data variable array size is reduced.
+		while (!queue.empty() && queue.front().pass <= current_pass)
 		{
-			for (const auto& view : views_to_remove)
+			if (max_views_updated > 0 && num_views_updated >= max_views_updated)
 			{
-				for (auto it = name_view_map.begin(); it != name_view_map.end();)
-				{
-					if (it->second == view.get())
-						it = name_view_map.erase(it);
-					else
-						++it;
-				}
+				budget_exhausted = true;
+				break;
 			}
 
-			views_to_remove.clear();
+			DataView* view = queue.front().view;
+			std::pop_heap(queue.begin(), queue.end(), CompareQueueEntries);
+			queue.pop_back();
+
+			// The entry is stale if the view was removed after being scheduled.
+			if (!view->queued)
+				continue;
+			view->queued = false;
+
+			if (view->IsValid())
+			{
+				result |= view->Update(model);
+				num_views_updated += 1;
+			}
 		}
+
+		if (queue.empty() && views_to_add.empty())
+			break;
 	}
 
+	RemovePendingViews();
+
+	if (queue.empty())
+		queue_pass = 0;
+
 	return result;
 }
 
+bool DataViews::HasPendingUpdates() const
+{
+	return !queue.empty() || !views_to_add.empty() || !views_to_remove.empty();
+}
+
+int DataViews::GetNumViewsUpdated() const
+{
+	return num_views_updated;
+}
+
 } // namespace Rml
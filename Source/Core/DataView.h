@@ -99,8 +99,13 @@ protected:
 	DataView(Element* element, int sort_offset);
 
 private:
+	friend class DataViews;
+
 	ObserverPtr<Element> attached_element;
 	int sort_order;
+
+	// True while the view is waiting in the update queue of its owning data views.
+	bool queued = false;
 };
 
 class DataViews : NonCopyMoveable {
@@ -112,9 +117,25 @@ public:
 
 	void OnElementRemove(Element* element);
 
-	bool Update(DataModel& model, const DirtyVariables& dirty_variables);
+	// Schedule all views depending on the given variable for the next update.
+	void OnVariableDirty(const String& variable_name);
+
+	// Update scheduled views in order of their sort order, and add or remove any pending views.
+	// @param[in] max_views_updated If positive, the maximum number of views to update, any remaining views are carried over to the next call.
+	// @return True if any view update resulted in a document change.
+	bool Update(DataModel& model, int max_views_updated);
+
+	// Returns true if there are scheduled views, or views waiting to be added or removed.
+	bool HasPendingUpdates() const;
+
+	// Returns the number of views updated during the last call to Update().
+	int GetNumViewsUpdated() const;
 
 private:
+	void AddPendingViews();
+	void RemovePendingViews();
+	void Enqueue(DataView* view);
+
 	using DataViewList = Vector<DataViewPtr>;
 
 	DataViewList views;
@@ -124,6 +145,20 @@ private:
 
 	using NameViewMap = UnorderedMultimap<String, DataView*>;
 	NameViewMap name_view_map;
+
+	// Scheduled views are kept in a heap ordered first by the update pass they were scheduled for, then by their sort order. Views scheduled
+	// while updating are placed in the next pass, which ensures that cyclic dependencies between views cannot lock up the update loop.
+	struct QueueEntry {
+		int pass;
+		int sort_order;
+		DataView* view;
+	};
+	static bool CompareQueueEntries(const QueueEntry& left, const QueueEntry& right);
+
+	Vector<QueueEntry> queue;
+	int queue_pass = 0;
+
+	int num_views_updated = 0;
 };
 
 } // namespace Rml
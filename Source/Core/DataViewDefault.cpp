@@ -32,11 +32,16 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/ElementText.h"
 #include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataExpression.h"
 #include "DataModel.h"
 #include "XMLParseTools.h"
+#include <algorithm>
+#include <cmath>
 
 namespace Rml {
 
@@ -46,6 +51,29 @@ static constexpr int SortOffset_DataValue = 100;
 //  'data-checked' may need a value attribute already set.
 static constexpr int SortOffset_DataChecked = 110;
 
+// Returns true for types whose variants can be compared directly to determine if their string representation changed.
+static bool IsComparableValue(Variant::Type type)
+{
+	switch (type)
+	{
+	case Variant::BOOL:
+	case Variant::INT:
+	case Variant::INT64:
+	case Variant::UINT:
+	case Variant::UINT64:
+	case Variant::FLOAT:
+	case Variant::DOUBLE:
+	case Variant::STRING: return true;
+	default: break;
+	}
+	return false;
+}
+
+static bool IsNumericValue(Variant::Type type)
+{
+	return type != Variant::STRING && type != Variant::BOOL && IsComparableValue(type);
+}
+
 DataViewCommon::DataViewCommon(Element* element, String override_modifier, int sort_offset) :
 	DataView(element, sort_offset), modifier(std::move(override_modifier))
 {}
@@ -191,6 +219,21 @@ bool DataViewStyle::Update(DataModel& model)
 
 	if (element && GetExpression().Run(expr_interface, variant))
 	{
+		// Numbers can be set directly as properties which accept plain numbers, without converting them to and from strings.
+		const PropertyId id = StyleSheetSpecification::GetPropertyId(property_name);
+		Property property;
+		if (id != PropertyId::Invalid && IsNumericValue(variant.GetType()) &&
+			StyleSheetSpecification::ParseNumericProperty(property, id, variant.Get<float>(), Unit::NUMBER))
+		{
+			const Property* p = element->GetLocalProperty(id);
+			if (!p || *p != property)
+			{
+				element->SetProperty(id, property);
+				result = true;
+			}
+			return result;
+		}
+
 		const String value = variant.Get<String>();
 		const Property* p = element->GetLocalProperty(property_name);
 		if (!p || p->Get<String>() != value)
@@ -363,25 +406,118 @@ bool DataViewText::Initialize(DataModel& model, Element* element, const String&
 	if (data_entries.empty())
 		return false;
 
+	text_is_whitespace = std::all_of(text.begin(), text.end(), &StringUtilities::IsWhitespace);
+
 	return true;
 }
 
+static void FormatInteger(uint64_t magnitude, bool negative, String& out_value)
+{
+	char buffer[24];
+	char* const end = buffer + sizeof(buffer);
+	char* begin = end;
+	do
+	{
+		*--begin = char('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude != 0);
+
+	if (negative)
+		*--begin = '-';
+
+	out_value.assign(begin, end);
+}
+
+static void FormatInteger(int64_t value, String& out_value)
+{
+	const uint64_t magnitude = (value < 0 ? uint64_t(0) - uint64_t(value) : uint64_t(value));
+	FormatInteger(magnitude, value < 0, out_value);
+}
+
+static void FormatFloatingPoint(double value, String& out_value)
+{
+	// Integral values are common for counters, format them without going through printf. Negative zero is excluded since it keeps its sign.
+	constexpr double max_integral = 1e15;
+	if (value > -max_integral && value < max_integral && value == double(int64_t(value)) && !(value == 0.0 && std::signbit(value)))
+	{
+		FormatInteger(int64_t(value), out_value);
+		return;
+	}
+
+	// Otherwise, produce the same result as the float to string type converter, without intermediate allocations.
+	char buffer[32];
+	const int result = snprintf(buffer, sizeof(buffer), "%.3f", value);
+	size_t length = (result < 0 ? 0 : Math::Min(size_t(result), sizeof(buffer) - 1));
+	for (size_t i = length; i-- > 0;)
+	{
+		if (buffer[i] == '.')
+		{
+			length = i;
+			break;
+		}
+		else if (buffer[i] == '0')
+			length = i;
+		else
+			break;
+	}
+
+	out_value.assign(buffer, length);
+}
+
+// Converts the variant to a string, with a fast path for numbers writing directly into the existing string buffer.
+static void FormatValue(const Variant& variant, String& out_value)
+{
+	// clang-format off
+	switch (variant.GetType())
+	{
+	case Variant::INT:    FormatInteger(int64_t(variant.GetReference<int>()), out_value);                  break;
+	case Variant::INT64:  FormatInteger(variant.GetReference<int64_t>(), out_value);                       break;
+	case Variant::UINT:   FormatInteger(uint64_t(variant.GetReference<unsigned int>()), false, out_value); break;
+	case Variant::UINT64: FormatInteger(variant.GetReference<uint64_t>(), false, out_value);                break;
+	case Variant::FLOAT:  FormatFloatingPoint(variant.GetReference<float>(), out_value);                    break;
+	case Variant::DOUBLE: FormatFloatingPoint(variant.GetReference<double>(), out_value);                   break;
+	default:
+		out_value.clear();
+		variant.GetInto(out_value);
+		break;
+	}
+	// clang-format on
+}
+
 bool DataViewText::Update(DataModel& model)
 {
 	bool entries_modified = false;
+	bool all_numeric = true;
 	{
 		Element* element = GetElement();
 		DataExpressionInterface expression_interface(&model, element);
 
+		Variant variant;
 		for (DataEntry& entry : data_entries)
 		{
 			RMLUI_ASSERT(entry.data_expression);
-			Variant variant;
-			bool result = entry.data_expression->Run(expression_interface, variant);
-			const String value = variant.Get<String>();
-			if (result && entry.value != value)
+			const bool result = entry.data_expression->Run(expression_interface, variant);
+			const Variant::Type type = variant.GetType();
+			all_numeric &= IsNumericValue(type);
+
+			if (!result)
+				continue;
+
+			// Compare the raw value first, so that we can skip the string conversion for unchanged values.
+			const bool comparable = IsComparableValue(type);
+			if (comparable && variant == entry.variant)
+				continue;
+
+			FormatValue(variant, value_buffer);
+
+			if (comparable)
+				entry.variant = std::move(variant);
+			else
+				entry.variant.Clear();
+
+			if (entry.value != value_buffer)
 			{
-				entry.value = value;
+				std::swap(entry.value, value_buffer);
 				entries_modified = true;
 			}
 		}
@@ -391,12 +527,21 @@ bool DataViewText::Update(DataModel& model)
 	{
 		if (Element* element = GetElement())
 		{
-			String new_text = BuildText();
-			String text;
-			if (SystemInterface* system_interface = GetSystemInterface())
-				system_interface->TranslateString(text, new_text);
+			BuildText(text_buffer);
+
+			const bool translate = !(all_numeric && text_is_whitespace && !model.GetTranslateNumericText());
+			SystemInterface* system_interface = GetSystemInterface();
 
-			rmlui_static_cast<ElementText*>(element)->SetText(text);
+			if (translate && system_interface)
+			{
+				translated_buffer.clear();
+				system_interface->TranslateString(translated_buffer, text_buffer);
+				rmlui_static_cast<ElementText*>(element)->SetText(translated_buffer);
+			}
+			else
+			{
+				rmlui_static_cast<ElementText*>(element)->SetText(text_buffer);
+			}
 		}
 		else
 		{
@@ -428,28 +573,26 @@ void DataViewText::Release()
 	delete this;
 }
 
-String DataViewText::BuildText() const
+void DataViewText::BuildText(String& out_text) const
 {
 	size_t reserve_size = text.size();
 
 	for (const DataEntry& entry : data_entries)
 		reserve_size += entry.value.size();
 
-	String result;
-	result.reserve(reserve_size);
+	out_text.clear();
+	out_text.reserve(reserve_size);
 
 	size_t previous_index = 0;
 	for (const DataEntry& entry : data_entries)
 	{
-		result += text.substr(previous_index, entry.index - previous_index);
-		result += entry.value;
+		out_text.append(text, previous_index, entry.index - previous_index);
+		out_text += entry.value;
 		previous_index = entry.index;
 	}
 
 	if (previous_index < text.size())
-		result += text.substr(previous_index);
-
-	return result;
+		out_text.append(text, previous_index, String::npos);
 }
 
 DataViewFor::DataViewFor(Element* element) : DataView(element, 0) {}
@@ -138,16 +138,26 @@ protected:
 	void Release() override;
 
 private:
-	String BuildText() const;
+	void BuildText(String& out_text) const;
 
 	struct DataEntry {
 		size_t index = 0; // Index into 'text'
 		DataExpressionPtr data_expression;
+		// The last result of the expression if it is a number, boolean, or string. Used to skip formatting of unchanged values.
+		Variant variant;
 		String value;
 	};
 
 	String text;
 	Vector<DataEntry> data_entries;
+
+	// True if the text outside the data expressions consists only of whitespace.
+	bool text_is_whitespace = false;
+
+	// Scratch buffers reused between updates.
+	String value_buffer;
+	String text_buffer;
+	String translated_buffer;
 };
 
 class DataViewFor final : public DataView {
@@ -28,8 +28,15 @@
 
 #include "DocumentHeader.h"
 #include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/StyleSheetContainer.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/URL.h"
+#include "StyleSheetFactory.h"
+#include "Template.h"
+#include "TemplateCache.h"
 #include "XMLParseTools.h"
 
 namespace Rml {
@@ -66,4 +73,68 @@ void DocumentHeader::MergeResources(ResourceList& target, const ResourceList& so
 	target.insert(target.end(), source.begin(), source.end());
 }
 
+DocumentHeader DocumentHeader::MergeTemplates() const
+{
+	// Construct a new header and copy the template details across
+	DocumentHeader header;
+	header.MergePaths(header.template_resources, template_resources, source);
+
+	// Merge in any templates, note a merge may cause more templates to merge
+	for (size_t i = 0; i < header.template_resources.size(); i++)
+	{
+		Template* merge_template = TemplateCache::LoadTemplate(URL(header.template_resources[i]).GetURL());
+
+		if (merge_template)
+			header.MergeHeader(*merge_template->GetHeader());
+		else
+			Log::Message(Log::LT_WARNING, "Template %s not found", header.template_resources[i].c_str());
+	}
+
+	// Merge the document's header last, as it is the most overriding.
+	header.MergeHeader(*this);
+
+	return header;
+}
+
+SharedPtr<StyleSheetContainer> DocumentHeader::LoadStyleSheetContainer() const
+{
+	SharedPtr<StyleSheetContainer> new_style_sheet;
+
+	// Combine any inline sheets.
+	for (const DocumentHeader::Resource& sheet : rcss)
+	{
+		if (sheet.is_inline)
+		{
+			auto inline_sheet = MakeShared<StyleSheetContainer>();
+			auto stream = MakeUnique<StreamMemory>((const byte*)sheet.content.c_str(), sheet.content.size());
+			stream->SetSourceURL(sheet.path);
+
+			if (inline_sheet->LoadStyleSheetContainer(stream.get(), sheet.line))
+			{
+				if (new_style_sheet)
+					new_style_sheet->MergeStyleSheetContainer(*inline_sheet);
+				else
+					new_style_sheet = std::move(inline_sheet);
+			}
+
+			stream.reset();
+		}
+		else
+		{
+			const StyleSheetContainer* sub_sheet = StyleSheetFactory::GetStyleSheetContainer(sheet.path);
+			if (sub_sheet)
+			{
+				if (new_style_sheet)
+					new_style_sheet->MergeStyleSheetContainer(*sub_sheet);
+				else
+					new_style_sheet = sub_sheet->CombineStyleSheetContainer(StyleSheetContainer());
+			}
+			else
+				Log::Message(Log::LT_ERROR, "Failed to load style sheet %s.", sheet.path.c_str());
+		}
+	}
+
+	return new_style_sheet;
+}
+
 } // namespace Rml
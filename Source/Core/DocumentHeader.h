@@ -33,6 +33,8 @@
 
 namespace Rml {
 
+class StyleSheetContainer;
+
 using LineNumberList = Vector<int>;
 
 /**
@@ -74,6 +76,13 @@ public:
 
 	/// Merges resources
 	void MergeResources(ResourceList& target, const ResourceList& source);
+
+	/// Returns a new header with the headers of all linked templates merged in, followed by this header as it is the most overriding.
+	DocumentHeader MergeTemplates() const;
+
+	/// Loads and combines all the style sheets of this header in order.
+	/// @return The combined style sheets, or nullptr if the header has none.
+	SharedPtr<StyleSheetContainer> LoadStyleSheetContainer() const;
 };
 
 } // namespace Rml
@@ -42,6 +42,7 @@
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include "AtomTable.h"
 #include "Clock.h"
 #include "ComputeProperty.h"
 #include "DataModel.h"
@@ -52,6 +53,7 @@
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
+#include "FrameProfilerRecorder.h"
 #include "Layout/LayoutEngine.h"
 #include "PluginRegistry.h"
 #include "Pool.h"
@@ -92,22 +94,34 @@ static float GetScrollOffsetDelta(ScrollAlignment alignment, float begin_offset,
 
 // Meta objects for element collected in a single struct to reduce memory allocations
 struct ElementMeta {
-	ElementMeta(Element* el) : event_dispatcher(el), style(el), background_border(), effects(el), scroll(el), computed_values(el) {}
-	SmallUnorderedMap<EventId, EventListener*> attribute_event_listeners;
+	ElementMeta(Element* el) : event_dispatcher(el), style(el), background_border(), scroll(el), computed_values(el) {}
 	EventDispatcher event_dispatcher;
 	ElementStyle style;
 	ElementBackgroundBorder background_border;
-	ElementEffects effects;
 	ElementScroll scroll;
 	Style::ComputedValues computed_values;
 };
 
+// Meta objects only used by some elements, allocated on first use to keep the per-element footprint small
+struct ElementColdMeta {
+	ElementColdMeta(Element* el) : effects(el) {}
+	struct PositionedBox {
+		Box box;
+		Vector2f offset;
+	};
+	SmallUnorderedMap<EventId, EventListener*> attribute_event_listeners;
+	ElementEffects effects;
+	Vector<PositionedBox> additional_boxes;
+};
+
 static Pool<ElementMeta> element_meta_chunk_pool(200, true);
+static Pool<ElementColdMeta> element_cold_meta_chunk_pool(50, true);
 
 Element::Element(const String& tag) :
 	local_stacking_context(false), local_stacking_context_forced(false), stacking_context_dirty(false), computed_values_are_default_initialized(true),
-	visible(true), offset_fixed(false), absolute_offset_dirty(true), dirty_definition(false), dirty_child_definitions(false), dirty_animation(false),
-	dirty_transition(false), dirty_transform(false), dirty_perspective(false), tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0),
+	visible(true), offset_fixed(false), absolute_offset_dirty(true), dirty_definition(false), dirty_child_definitions(false),
+	dirty_own_definition(false), dirty_animation(false), dirty_transition(false), dirty_transform(false), dirty_perspective(false),
+	tag(AtomTable::Intern(tag)), id_atom(Atom::Empty), id_atom_table_size(0), relative_offset_base(0, 0), relative_offset_position(0, 0),
 	absolute_offset(0, 0), scroll_offset(0, 0)
 {
 	RMLUI_ASSERT(tag == StringUtilities::ToLower(tag));
@@ -126,6 +140,7 @@ Element::Element(const String& tag) :
 	z_index = 0;
 
 	meta = element_meta_chunk_pool.AllocateAndConstruct(this);
+	cold_meta = nullptr;
 	data_model = nullptr;
 }
 
@@ -148,6 +163,8 @@ Element::~Element()
 	children.clear();
 	num_non_dom_children = 0;
 
+	if (cold_meta)
+		element_cold_meta_chunk_pool.DestroyAndDeallocate(cold_meta);
 	element_meta_chunk_pool.DestroyAndDeallocate(meta);
 }
 
@@ -177,7 +194,8 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 		UpdateProperties(dp_ratio, vp_dimensions);
 	}
 
-	meta->effects.InstanceEffects();
+	if (cold_meta)
+		cold_meta->effects.InstanceEffects();
 
 	for (size_t i = 0; i < children.size(); i++)
 		children[i]->Update(dp_ratio, vp_dimensions);
@@ -195,6 +213,8 @@ void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimension
 
 	if (meta->style.AnyPropertiesDirty())
 	{
+		FrameProfilerRecorder::Count(FrameCounter::ElementsUpdated);
+
 		const ComputedValues* parent_values = parent ? &parent->GetComputedValues() : nullptr;
 		const ComputedValues* document_values = owner_document ? &owner_document->GetComputedValues() : nullptr;
 
@@ -233,13 +253,16 @@ void Element::Render()
 	// Apply our transform
 	ElementUtilities::ApplyTransform(*this);
 
-	meta->effects.RenderEffects(RenderStage::Enter);
+	ElementEffects* effects = (cold_meta ? &cold_meta->effects : nullptr);
+	if (effects)
+		effects->RenderEffects(RenderStage::Enter);
 
 	// Set up the clipping region for this element.
 	if (ElementUtilities::SetClippingRegion(this))
 	{
 		meta->background_border.Render(this);
-		meta->effects.RenderEffects(RenderStage::Decoration);
+		if (effects)
+			effects->RenderEffects(RenderStage::Decoration);
 
 		{
 			RMLUI_ZoneScopedNC("OnRender", 0x228B22);
@@ -252,7 +275,8 @@ void Element::Render()
 	for (Element* element : stacking_context)
 		element->Render();
 
-	meta->effects.RenderEffects(RenderStage::Exit);
+	if (effects)
+		effects->RenderEffects(RenderStage::Exit);
 }
 
 ElementPtr Element::Clone() const
@@ -295,7 +319,10 @@ ElementPtr Element::Clone() const
 void Element::SetClass(const String& class_name, bool activate)
 {
 	if (meta->style.SetClass(class_name, activate))
-		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+	{
+		const StyleSheet* style_sheet = GetStyleSheet();
+		DirtyDefinition(style_sheet ? style_sheet->GetClassInvalidation(class_name) : StyleSheetInvalidation::All);
+	}
 }
 
 bool Element::IsClassSet(const String& class_name) const
@@ -323,13 +350,13 @@ const StyleSheet* Element::GetStyleSheet() const
 String Element::GetAddress(bool include_pseudo_classes, bool include_parents) const
 {
 	// Add the tag name onto the address.
-	String address(tag);
+	String address(GetTagName());
 
 	// Add the ID if we have one.
 	if (!id.empty())
 	{
 		address += "#";
-		address += id;
+		address += GetId();
 	}
 
 	String classes = meta->style.GetClassNames();
@@ -346,7 +373,7 @@ String Element::GetAddress(bool include_pseudo_classes, bool include_parents) co
 		for (auto& pseudo_class : pseudo_classes)
 		{
 			address += ":";
-			address += pseudo_class.first;
+			address += AtomTable::GetString(pseudo_class.first);
 		}
 	}
 
@@ -443,28 +470,32 @@ void Element::SetScrollableOverflowRectangle(Vector2f _scrollable_overflow_recta
 
 void Element::SetBox(const Box& box)
 {
-	if (box != main_box || additional_boxes.size() > 0)
+	if (box != main_box || (cold_meta && !cold_meta->additional_boxes.empty()))
 	{
 		main_box = box;
-		additional_boxes.clear();
+		if (cold_meta)
+		{
+			cold_meta->additional_boxes.clear();
+			cold_meta->effects.DirtyEffectsData();
+		}
 
 		OnResize();
 
 		meta->background_border.DirtyBackground();
 		meta->background_border.DirtyBorder();
-		meta->effects.DirtyEffectsData();
 	}
 }
 
 void Element::AddBox(const Box& box, Vector2f offset)
 {
-	additional_boxes.emplace_back(PositionedBox{box, offset});
+	ElementColdMeta& cold = GetColdMeta();
+	cold.additional_boxes.push_back(ElementColdMeta::PositionedBox{box, offset});
 
 	OnResize();
 
 	meta->background_border.DirtyBackground();
 	meta->background_border.DirtyBorder();
-	meta->effects.DirtyEffectsData();
+	cold.effects.DirtyEffectsData();
 }
 
 const Box& Element::GetBox()
@@ -480,17 +511,17 @@ const Box& Element::GetBox(int index, Vector2f& offset)
 		return main_box;
 
 	const int additional_box_index = index - 1;
-	if (additional_box_index >= (int)additional_boxes.size())
+	if (!cold_meta || additional_box_index >= (int)cold_meta->additional_boxes.size())
 		return main_box;
 
-	offset = additional_boxes[additional_box_index].offset;
+	offset = cold_meta->additional_boxes[additional_box_index].offset;
 
-	return additional_boxes[additional_box_index].box;
+	return cold_meta->additional_boxes[additional_box_index].box;
 }
 
 int Element::GetNumBoxes()
 {
-	return 1 + (int)additional_boxes.size();
+	return 1 + (cold_meta ? (int)cold_meta->additional_boxes.size() : 0);
 }
 
 float Element::GetBaseline() const
@@ -558,13 +589,13 @@ FontFaceHandle Element::GetFontFaceHandle() const
 bool Element::SetProperty(const String& name, const String& value)
 {
 	// The name may be a shorthand giving us multiple underlying properties
-	PropertyDictionary properties;
-	if (!StyleSheetSpecification::ParsePropertyDeclaration(properties, name, value))
+	const PropertyDictionary* properties = StyleSheetSpecification::ParsePropertyDeclarationCached(name, value);
+	if (!properties)
 	{
 		Log::Message(Log::LT_WARNING, "Syntax error parsing inline property declaration '%s: %s;'.", name.c_str(), value.c_str());
 		return false;
 	}
-	for (auto& property : properties.GetProperties())
+	for (auto& property : properties->GetProperties())
 	{
 		if (!meta->style.SetProperty(property.first, property.second))
 			return false;
@@ -736,8 +767,9 @@ void Element::SetPseudoClass(const String& pseudo_class, bool activate)
 {
 	if (meta->style.SetPseudoClass(pseudo_class, activate, false))
 	{
-		// Include siblings in case of RCSS presence of sibling combinators '+', '~'.
-		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+		// Only the elements which may be affected by the pseudo-class are dirtied, such as siblings in case of sibling combinators '+', '~'.
+		const StyleSheet* style_sheet = GetStyleSheet();
+		DirtyDefinition(style_sheet ? style_sheet->GetPseudoClassInvalidation(pseudo_class) : StyleSheetInvalidation::All);
 		OnPseudoClassChange(pseudo_class, activate);
 	}
 }
@@ -765,7 +797,7 @@ StringList Element::GetActivePseudoClasses() const
 	names.reserve(pseudo_classes.size());
 	for (auto& pseudo_class : pseudo_classes)
 	{
-		names.push_back(pseudo_class.first);
+		names.push_back(AtomTable::GetString(pseudo_class.first));
 	}
 
 	return names;
@@ -853,7 +885,7 @@ int Element::GetNumAttributes() const
 
 const String& Element::GetTagName() const
 {
-	return tag;
+	return AtomTable::GetString(tag);
 }
 
 const String& Element::GetId() const
@@ -1624,6 +1656,8 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 		if (attribute == "id")
 		{
 			id = value.Get<String>();
+			id_atom_table_size = AtomTable::GetSize();
+			id_atom = AtomTable::Find(id);
 		}
 		else if (attribute == "class")
 		{
@@ -1640,7 +1674,7 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 		{
 			static constexpr bool IN_CAPTURE_PHASE = false;
 
-			auto& attribute_event_listeners = meta->attribute_event_listeners;
+			auto& attribute_event_listeners = GetColdMeta().attribute_event_listeners;
 			auto& event_dispatcher = meta->event_dispatcher;
 			const auto event_id = EventSpecificationInterface::GetIdOrInsert(attribute.substr(2));
 			const auto remove_event_listener_if_exists = [&attribute_event_listeners, &event_dispatcher, event_id]() {
@@ -1707,8 +1741,21 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 	}
 
 	// Any change to the attributes may affect which styles apply to the current element, in particular due to attribute selectors, ID selectors, and
-	// class selectors. This can further affect all siblings or descendants due to sibling or descendant combinators.
-	DirtyDefinition(DirtyNodes::SelfAndSiblings);
+	// class selectors. This can further affect all siblings or descendants due to sibling or descendant combinators. Changes to the id or class
+	// names are considered to affect all of these, while other attributes only affect the elements given by the style sheet's invalidation sets.
+	const StyleSheet* style_sheet = GetStyleSheet();
+	StyleSheetInvalidation invalidation = StyleSheetInvalidation::None;
+	for (const auto& element_attribute : changed_attributes)
+	{
+		const String& attribute = element_attribute.first;
+		if (!style_sheet || attribute == "id" || attribute == "class")
+		{
+			invalidation = StyleSheetInvalidation::All;
+			break;
+		}
+		invalidation = invalidation | style_sheet->GetAttributeInvalidation(attribute);
+	}
+	DirtyDefinition(invalidation);
 }
 
 void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
@@ -1838,18 +1885,23 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		meta->background_border.DirtyBorder();
 	}
 
-	// Dirty the effects if they've changed.
-	if (border_radius_changed || filter_or_mask_changed || changed_properties.Contains(PropertyId::Decorator))
+	// Dirty the effects if they've changed. The effects are only allocated once the element actually uses any of them.
+	if (filter_or_mask_changed || changed_properties.Contains(PropertyId::Decorator))
+	{
+		const ComputedValues& computed = meta->computed_values;
+		if (cold_meta || computed.has_decorator() || computed.has_mask_image() || computed.has_filter() || computed.has_backdrop_filter())
+			GetColdMeta().effects.DirtyEffects();
+	}
+	else if (border_radius_changed && cold_meta)
 	{
-		meta->effects.DirtyEffects();
+		cold_meta->effects.DirtyEffects();
 	}
 
 	// Dirty the effects data when their visual looks may have changed.
-	if (border_radius_changed ||                            //
-		changed_properties.Contains(PropertyId::Opacity) || //
-		changed_properties.Contains(PropertyId::ImageColor))
+	if (cold_meta &&
+		(border_radius_changed || changed_properties.Contains(PropertyId::Opacity) || changed_properties.Contains(PropertyId::ImageColor)))
 	{
-		meta->effects.DirtyEffectsData();
+		cold_meta->effects.DirtyEffectsData();
 	}
 
 	// Check for `perspective' and `perspective-origin' changes
@@ -1960,7 +2012,7 @@ void Element::GetRML(String& content)
 	// First we start the open tag, add the attributes then close the open tag.
 	// Then comes the children in order, then we add our close tag.
 	content += "<";
-	content += tag;
+	content += GetTagName();
 
 	for (auto& pair : attributes)
 	{
@@ -1984,7 +2036,7 @@ void Element::GetRML(String& content)
 		GetInnerRML(content);
 
 		content += "</";
-		content += tag;
+		content += GetTagName();
 		content += ">";
 	}
 	else
@@ -2047,6 +2099,10 @@ void Element::SetParent(Element* _parent)
 	// Assumes we are already detached from the hierarchy or we are detaching now.
 	RMLUI_ASSERT(!parent || !_parent);
 
+	// The sibling positions change in the parent we are added to or removed from.
+	if (Element* changed_parent = (_parent ? _parent : parent))
+		changed_parent->meta->style.DirtyChildPositions();
+
 	parent = _parent;
 
 	if (parent)
@@ -2374,16 +2430,29 @@ void Element::DirtyDefinition(DirtyNodes dirty_nodes)
 	}
 }
 
+void Element::DirtyDefinition(StyleSheetInvalidation invalidation)
+{
+	if ((invalidation & StyleSheetInvalidation::Siblings) != StyleSheetInvalidation::None)
+		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+	else if ((invalidation & StyleSheetInvalidation::Descendants) != StyleSheetInvalidation::None)
+		DirtyDefinition(DirtyNodes::Self);
+	else if ((invalidation & StyleSheetInvalidation::Self) != StyleSheetInvalidation::None)
+		dirty_own_definition = true;
+}
+
 void Element::UpdateDefinition()
 {
-	if (dirty_definition)
+	if (dirty_definition || dirty_own_definition)
 	{
-		dirty_definition = false;
-
 		// Dirty definition implies all our descendent elements. Anything that can change the definition of this element can also change the
 		// definition of any descendants due to the presence of RCSS descendant or child combinators. In principle this also applies to sibling
-		// combinators, but those are handled during the DirtyDefinition call.
-		dirty_child_definitions = true;
+		// combinators, but those are handled during the DirtyDefinition call. Changes known to only affect this element, as determined by the
+		// style sheet's invalidation sets, leave the descendants alone.
+		if (dirty_definition)
+			dirty_child_definitions = true;
+
+		dirty_definition = false;
+		dirty_own_definition = false;
 
 		GetStyle()->UpdateDefinition();
 	}
@@ -2863,7 +2932,8 @@ void Element::UpdateTransformState()
 
 void Element::OnStyleSheetChangeRecursive()
 {
-	meta->effects.DirtyEffects();
+	if (cold_meta)
+		cold_meta->effects.DirtyEffects();
 
 	OnStyleSheetChange();
 
@@ -2873,9 +2943,25 @@ void Element::OnStyleSheetChangeRecursive()
 		GetChild(i)->OnStyleSheetChangeRecursive();
 }
 
+Atom Element::GetIdAtom() const
+{
+	// The id can only become known to the table when new atoms are added, such as by a style sheet loaded after the id was set.
+	if (id_atom == Atom::Invalid)
+	{
+		const size_t table_size = AtomTable::GetSize();
+		if (table_size != id_atom_table_size)
+		{
+			id_atom_table_size = table_size;
+			id_atom = AtomTable::Find(id);
+		}
+	}
+	return id_atom;
+}
+
 void Element::OnDpRatioChangeRecursive()
 {
-	meta->effects.DirtyEffects();
+	if (cold_meta)
+		cold_meta->effects.DirtyEffects();
 	GetStyle()->DirtyPropertiesWithUnits(Unit::DP_SCALABLE_LENGTH);
 
 	OnDpRatioChange();
@@ -2897,4 +2983,26 @@ void Element::DirtyFontFaceRecursive()
 		GetChild(i)->DirtyFontFaceRecursive();
 }
 
+ElementColdMeta& Element::GetColdMeta() const
+{
+	if (!cold_meta)
+		cold_meta = element_cold_meta_chunk_pool.AllocateAndConstruct(const_cast<Element*>(this));
+	return *cold_meta;
+}
+
+void Element::AddMemoryUsage(ElementMemoryUsage& usage) const
+{
+	usage.num_elements += 1;
+	usage.element_bytes += sizeof(Element) + sizeof(ElementMeta);
+
+	if (cold_meta)
+	{
+		usage.num_elements_with_cold_meta += 1;
+		usage.cold_meta_bytes += sizeof(ElementColdMeta) + cold_meta->additional_boxes.capacity() * sizeof(ElementColdMeta::PositionedBox);
+	}
+
+	usage.container_bytes += children.capacity() * sizeof(ElementPtr) + stacking_context.capacity() * sizeof(Element*) +
+		animations.capacity() * sizeof(ElementAnimation) + attributes.size() * (sizeof(String) + sizeof(Variant));
+}
+
 } // namespace Rml
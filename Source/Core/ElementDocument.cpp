@@ -31,17 +31,14 @@
 #include "../../Include/RmlUi/Core/ElementText.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
-#include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetContainer.h"
 #include "DocumentHeader.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
+#include "FrameProfilerRecorder.h"
 #include "Layout/LayoutEngine.h"
 #include "StreamFile.h"
-#include "StyleSheetFactory.h"
-#include "Template.h"
-#include "TemplateCache.h"
 #include "XMLParseTools.h"
 #include <limits.h>
 
@@ -194,64 +191,17 @@ void ElementDocument::ProcessHeader(const DocumentHeader* document_header)
 	// Store the source address that we came from
 	source_url = document_header->source;
 
-	// Construct a new header and copy the template details across
-	DocumentHeader header;
-	header.MergePaths(header.template_resources, document_header->template_resources, document_header->source);
-
-	// Merge in any templates, note a merge may cause more templates to merge
-	for (size_t i = 0; i < header.template_resources.size(); i++)
-	{
-		Template* merge_template = TemplateCache::LoadTemplate(URL(header.template_resources[i]).GetURL());
-
-		if (merge_template)
-			header.MergeHeader(*merge_template->GetHeader());
-		else
-			Log::Message(Log::LT_WARNING, "Template %s not found", header.template_resources[i].c_str());
-	}
-
-	// Merge the document's header last, as it is the most overriding.
-	header.MergeHeader(*document_header);
+	// Merge in the headers of any templates used by the document.
+	const DocumentHeader header = document_header->MergeTemplates();
 
 	// Set the title to the document title.
 	title = document_header->title;
 
 	// If a style-sheet (or sheets) has been specified for this element, then we load them and set the combined sheet
-	// on the element; all of its children will inherit it by default.
-	SharedPtr<StyleSheetContainer> new_style_sheet;
-
-	// Combine any inline sheets.
-	for (const DocumentHeader::Resource& rcss : header.rcss)
-	{
-		if (rcss.is_inline)
-		{
-			auto inline_sheet = MakeShared<StyleSheetContainer>();
-			auto stream = MakeUnique<StreamMemory>((const byte*)rcss.content.c_str(), rcss.content.size());
-			stream->SetSourceURL(rcss.path);
-
-			if (inline_sheet->LoadStyleSheetContainer(stream.get(), rcss.line))
-			{
-				if (new_style_sheet)
-					new_style_sheet->MergeStyleSheetContainer(*inline_sheet);
-				else
-					new_style_sheet = std::move(inline_sheet);
-			}
-
-			stream.reset();
-		}
-		else
-		{
-			const StyleSheetContainer* sub_sheet = StyleSheetFactory::GetStyleSheetContainer(rcss.path);
-			if (sub_sheet)
-			{
-				if (new_style_sheet)
-					new_style_sheet->MergeStyleSheetContainer(*sub_sheet);
-				else
-					new_style_sheet = sub_sheet->CombineStyleSheetContainer(StyleSheetContainer());
-			}
-			else
-				Log::Message(Log::LT_ERROR, "Failed to load style sheet %s.", rcss.path.c_str());
-		}
-	}
+	// on the element; all of its children will inherit it by default. Prepared documents have already loaded their sheets.
+	SharedPtr<StyleSheetContainer> new_style_sheet = std::move(prepared_style_sheet_container);
+	if (!new_style_sheet)
+		new_style_sheet = header.LoadStyleSheetContainer();
 
 	// If a style sheet is available, set it on the document.
 	if (new_style_sheet)
@@ -522,6 +472,8 @@ void ElementDocument::UpdateLayout()
 	{
 		RMLUI_ZoneScoped;
 		RMLUI_ZoneText(source_url.c_str(), source_url.size());
+		FrameProfilerScope profiler_scope(FrameTimer::Layout);
+		FrameProfilerRecorder::Count(FrameCounter::Layouts);
 
 		Vector2f containing_block(0, 0);
 		if (GetParentNode() != nullptr)
@@ -135,6 +135,11 @@ float ElementScroll::GetScrollbarSize(Orientation orientation)
 	return scrollbars[orientation].size;
 }
 
+bool ElementScroll::IsScrollbarEnabled(Orientation orientation) const
+{
+	return scrollbars[orientation].enabled;
+}
+
 void ElementScroll::FormatScrollbars()
 {
 	const Box& element_box = element->GetBox();
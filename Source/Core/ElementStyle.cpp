@@ -45,6 +45,7 @@
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
 #include "ComputeProperty.h"
 #include "ElementDefinition.h"
+#include "FrameProfilerRecorder.h"
 #include "PropertiesIterator.h"
 #include <algorithm>
 
@@ -64,6 +65,62 @@ ElementStyle::ElementStyle(Element* _element)
 	element = _element;
 }
 
+const SiblingPosition& ElementStyle::GetSiblingPosition() const
+{
+	const Element* parent = element->GetParentNode();
+	RMLUI_ASSERT(parent);
+
+	const ElementStyle* parent_style = parent->GetStyle();
+	if (parent_style->dirty_child_positions)
+		parent_style->UpdateChildPositions();
+
+	return sibling_position;
+}
+
+void ElementStyle::UpdateChildPositions() const
+{
+	RMLUI_ZoneScoped;
+
+	// Using a thread-local static to avoid allocations, the number of children found so far for each tag.
+	static thread_local SmallUnorderedMap<Atom, int> num_of_type;
+	num_of_type.clear();
+
+	static const Atom text_atom = AtomTable::Intern("#text");
+
+	const int num_dom_children = element->GetNumChildren();
+	int num_children = 0;
+	for (int i = 0; i < num_dom_children; i++)
+	{
+		ElementStyle* child_style = element->GetChild(i)->GetStyle();
+		const Atom tag = child_style->GetTagAtom();
+		if (tag == text_atom)
+		{
+			child_style->sibling_position = {};
+			continue;
+		}
+
+		num_children += 1;
+		child_style->sibling_position.child_index = num_children;
+		child_style->sibling_position.of_type_index = ++num_of_type[tag];
+	}
+
+	// The totals are only known after all the children have been counted.
+	for (int i = 0; i < num_dom_children; i++)
+	{
+		ElementStyle* child_style = element->GetChild(i)->GetStyle();
+		if (child_style->sibling_position.child_index > 0)
+		{
+			child_style->sibling_position.num_children = num_children;
+			child_style->sibling_position.num_of_type = num_of_type[child_style->GetTagAtom()];
+		}
+	}
+
+	for (int i = num_dom_children; i < element->GetNumChildren(true); i++)
+		element->GetChild(i)->GetStyle()->sibling_position = {};
+
+	dirty_child_positions = false;
+}
+
 const Property* ElementStyle::GetLocalProperty(PropertyId id, const PropertyDictionary& inline_properties, const ElementDefinition* definition)
 {
 	// Check for overriding local properties.
@@ -175,6 +232,7 @@ void ElementStyle::UpdateDefinition()
 
 	if (const StyleSheet* style_sheet = element->GetStyleSheet())
 	{
+		FrameProfilerRecorder::Count(FrameCounter::DefinitionLookups);
 		new_definition = style_sheet->GetElementDefinition(element);
 	}
 
@@ -218,13 +276,13 @@ bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, boo
 
 	if (activate)
 	{
-		PseudoClassState& state = pseudo_classes[pseudo_class];
+		PseudoClassState& state = pseudo_classes[AtomTable::Intern(pseudo_class)];
 		changed = (state == PseudoClassState::Clear);
 		state = (state | (override_class ? PseudoClassState::Override : PseudoClassState::Set));
 	}
 	else
 	{
-		auto it = pseudo_classes.find(pseudo_class);
+		auto it = pseudo_classes.find(AtomTable::Find(pseudo_class));
 		if (it != pseudo_classes.end())
 		{
 			PseudoClassState& state = it->second;
@@ -242,12 +300,7 @@ bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, boo
 
 bool ElementStyle::IsPseudoClassSet(const String& pseudo_class) const
 {
-	return (pseudo_classes.count(pseudo_class) == 1);
-}
-
-const PseudoClassMap& ElementStyle::GetActivePseudoClasses() const
-{
-	return pseudo_classes;
+	return IsPseudoClassSet(AtomTable::Find(pseudo_class));
 }
 
 bool ElementStyle::SetClass(const String& class_name, bool activate)
@@ -272,6 +325,9 @@ bool ElementStyle::SetClass(const String& class_name, bool activate)
 		}
 	}
 
+	if (changed)
+		UpdateClassAtoms();
+
 	return changed;
 }
 
@@ -280,10 +336,17 @@ bool ElementStyle::IsClassSet(const String& class_name) const
 	return std::find(classes.begin(), classes.end(), class_name) != classes.end();
 }
 
+bool ElementStyle::IsClassSet(Atom class_name) const
+{
+	const AtomList& atoms = GetClassNameList();
+	return std::find(atoms.begin(), atoms.end(), class_name) != atoms.end();
+}
+
 void ElementStyle::SetClassNames(const String& class_names)
 {
 	classes.clear();
 	StringUtilities::ExpandString(classes, class_names, ' ');
+	UpdateClassAtoms();
 }
 
 String ElementStyle::GetClassNames() const
@@ -301,9 +364,25 @@ String ElementStyle::GetClassNames() const
 	return class_names;
 }
 
-const StringList& ElementStyle::GetClassNameList() const
+const AtomList& ElementStyle::GetClassNameList() const
 {
-	return classes;
+	// Classes can only become known to the table when new atoms are added, such as by a style sheet loaded after the classes were set.
+	if (class_atoms.size() != classes.size() && AtomTable::GetSize() != class_atoms_table_size)
+		UpdateClassAtoms();
+
+	return class_atoms;
+}
+
+void ElementStyle::UpdateClassAtoms() const
+{
+	class_atoms_table_size = AtomTable::GetSize();
+	class_atoms.clear();
+	for (const String& class_name : classes)
+	{
+		const Atom atom = AtomTable::Find(class_name);
+		if (atom != Atom::Invalid)
+			class_atoms.push_back(atom);
+	}
 }
 
 bool ElementStyle::SetProperty(PropertyId id, const Property& property)
@@ -30,9 +30,12 @@
 #define RMLUI_CORE_ELEMENTSTYLE_H
 
 #include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AtomTable.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -41,7 +44,21 @@ class PropertiesIterator;
 enum class RelativeTarget;
 
 enum class PseudoClassState : uint8_t { Clear = 0, Set = 1, Override = 2 };
-using PseudoClassMap = SmallUnorderedMap<String, PseudoClassState>;
+using PseudoClassMap = SmallUnorderedMap<Atom, PseudoClassState>;
+
+/**
+    Position of an element among the children of its parent, used for matching tree-structural selectors such as ':nth-child()'.
+
+    Only element children in the DOM are positioned, that is, text elements and non-DOM children are skipped. Indices are one-based, an index of
+    zero means the element is not positioned.
+ */
+struct SiblingPosition {
+	int child_index = 0;
+	int num_children = 0;
+	// The index and count among the siblings sharing the same tag as the element.
+	int of_type_index = 0;
+	int num_of_type = 0;
+};
 
 /**
     Manages an element's style and property information.
@@ -68,8 +85,10 @@ public:
 	/// @param[in] pseudo_class The name of the pseudo-class to check for.
 	/// @return True if the pseudo-class is set on the element, false if not.
 	bool IsPseudoClassSet(const String& pseudo_class) const;
+	/// Checks if a specific pseudo-class has been set on the element, given its interned name.
+	bool IsPseudoClassSet(Atom pseudo_class) const { return pseudo_classes.count(pseudo_class) == 1; }
 	/// Gets a list of the current active pseudo classes
-	const PseudoClassMap& GetActivePseudoClasses() const;
+	const PseudoClassMap& GetActivePseudoClasses() const { return pseudo_classes; }
 
 	/// Sets or removes a class on the element.
 	/// @param[in] class_name The name of the class to add or remove from the class list.
@@ -80,14 +99,27 @@ public:
 	/// @param[in] class_name The name of the class to check for.
 	/// @return True if the class is set on the element, false otherwise.
 	bool IsClassSet(const String& class_name) const;
+	/// Checks if a class is set on the element, given its interned name.
+	bool IsClassSet(Atom class_name) const;
 	/// Specifies the entire list of classes for this element. This will replace any others specified.
 	/// @param[in] class_names The list of class names to set on the style, separated by spaces.
 	void SetClassNames(const String& class_names);
 	/// Return the active class list.
 	/// @return A string containing all the classes on the element, separated by spaces.
 	String GetClassNames() const;
-	/// Return the active class list.
-	const StringList& GetClassNameList() const;
+	/// Return the active classes known to the atom table, which are the only classes that can be matched by selectors.
+	const AtomList& GetClassNameList() const;
+
+	/// Returns the interned tag name and id of the element, used for fast selector matching.
+	Atom GetTagAtom() const { return element->tag; }
+	Atom GetIdAtom() const { return element->GetIdAtom(); }
+
+	/// Returns the position of the element among its siblings. The positions of all the siblings are updated at once when the children of the
+	/// parent have changed, making repeated lookups constant time.
+	/// @note The element must have a parent.
+	const SiblingPosition& GetSiblingPosition() const;
+	/// Marks the positions of the element's children as changed, to be updated on the next lookup.
+	void DirtyChildPositions() { dirty_child_positions = true; }
 
 	/// Sets a local property override on the element to a pre-parsed value.
 	/// @param[in] name The name of the new property.
@@ -146,10 +178,15 @@ public:
 private:
 	// Sets a list of properties as dirty.
 	void DirtyProperties(const PropertyIdSet& properties);
+	// Looks up the atoms of the element's classes.
+	void UpdateClassAtoms() const;
 
 	static const Property* GetLocalProperty(PropertyId id, const PropertyDictionary& inline_properties, const ElementDefinition* definition);
 	static const Property* GetProperty(PropertyId id, const Element* element, const PropertyDictionary& inline_properties,
 		const ElementDefinition* definition);
+	// Updates the sibling positions of all the children of the element.
+	void UpdateChildPositions() const;
+
 	static void TransitionPropertyChanges(Element* element, PropertyIdSet& properties, const PropertyDictionary& inline_properties,
 		const ElementDefinition* old_definition, const ElementDefinition* new_definition);
 
@@ -158,6 +195,10 @@ private:
 
 	// The list of classes applicable to this object.
 	StringList classes;
+	// The classes found in the atom table for selector matching, along with the size of the table at the time of lookup. Classes are looked up
+	// rather than interned, so that classes set at runtime do not grow the atom table.
+	mutable AtomList class_atoms;
+	mutable size_t class_atoms_table_size = 0;
 	// This element's current pseudo-classes.
 	PseudoClassMap pseudo_classes;
 
@@ -167,6 +208,10 @@ private:
 	SharedPtr<const ElementDefinition> definition;
 
 	PropertyIdSet dirty_properties;
+
+	// The cached position among our siblings, valid while the child positions of the parent are not dirty.
+	mutable SiblingPosition sibling_position;
+	mutable bool dirty_child_positions = true;
 };
 
 } // namespace Rml
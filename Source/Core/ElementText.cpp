@@ -42,6 +42,7 @@
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
 #include "TransformState.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -465,8 +466,10 @@ void ElementText::GenerateGeometry(RenderManager& render_manager, const FontFace
 			lines[i].position, colour, opacity, text_shaping_context, mesh_list);
 	}
 
-	// Apply the new geometry and textures.
-	geometry.resize(mesh_list.size());
+	// Apply the new geometry and textures. The font engine may leave some meshes empty, such as for unused texture pages, these are skipped.
+	const auto it_meshes_end =
+		std::remove_if(mesh_list.begin(), mesh_list.end(), [](const TexturedMesh& textured_mesh) { return textured_mesh.mesh.indices.empty(); });
+	geometry.resize(it_meshes_end - mesh_list.begin());
 	for (size_t i = 0; i < geometry.size(); i++)
 	{
 		geometry[i].geometry = render_manager.MakeGeometry(std::move(mesh_list[i].mesh));
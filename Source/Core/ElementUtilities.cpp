@@ -546,4 +546,26 @@ bool ElementUtilities::ApplyStructuralDataViews(Element* element, const String&
 	return ApplyDataViewsControllersInternal(element, true, inner_rml);
 }
 
+ElementMemoryUsage ElementUtilities::GetMemoryUsage(Element* element)
+{
+	ElementMemoryUsage usage;
+	if (!element)
+		return usage;
+
+	ElementList search_queue = {element};
+	while (!search_queue.empty())
+	{
+		Element* current = search_queue.back();
+		search_queue.pop_back();
+
+		current->AddMemoryUsage(usage);
+
+		const int num_children = current->GetNumChildren(true);
+		for (int i = 0; i < num_children; i++)
+			search_queue.push_back(current->GetChild(i));
+	}
+
+	return usage;
+}
+
 } // namespace Rml
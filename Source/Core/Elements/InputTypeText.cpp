@@ -30,7 +30,6 @@
 #include "../../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../../Include/RmlUi/Core/Elements/ElementFormControlInput.h"
 #include "../../../Include/RmlUi/Core/PropertyIdSet.h"
-#include "../../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "WidgetTextInputSingleLine.h"
 #include "WidgetTextInputSingleLinePassword.h"
 
@@ -93,18 +92,7 @@ bool InputTypeText::OnAttributeChange(const ElementAttributes& changed_attribute
 
 void InputTypeText::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
-	// Some inherited properties require text formatting update, mainly font and line-height properties.
-	const PropertyIdSet changed_inherited_layout_properties = changed_properties &
-		(StyleSheetSpecification::GetRegisteredInheritedProperties() & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
-
-	if (!changed_inherited_layout_properties.Empty())
-		widget->ForceFormattingOnNextLayout();
-
-	if (changed_properties.Contains(PropertyId::Color) || changed_properties.Contains(PropertyId::BackgroundColor))
-		widget->UpdateSelectionColours();
-
-	if (changed_properties.Contains(PropertyId::CaretColor))
-		widget->GenerateCursor();
+	widget->OnPropertyChange(changed_properties);
 }
 
 void InputTypeText::ProcessDefaultAction(Event& /*event*/) {}
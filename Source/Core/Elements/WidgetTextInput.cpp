@@ -39,7 +39,9 @@
 #include "../../../Include/RmlUi/Core/Input.h"
 #include "../../../Include/RmlUi/Core/Math.h"
 #include "../../../Include/RmlUi/Core/MeshUtilities.h"
+#include "../../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../../Include/RmlUi/Core/SystemInterface.h"
 #include "../Clock.h"
 #include "ElementTextSelection.h"
@@ -158,6 +160,12 @@ WidgetTextInput::WidgetTextInput(ElementFormControl* _parent) :
 
 	max_length = -1;
 
+	lines_layout_width = -1.f;
+	pending_edit = {};
+	has_pending_edit = false;
+	geometry_lines_begin = 0;
+	geometry_lines_end = 0;
+
 	selection_anchor_index = 0;
 	selection_begin_index = 0;
 	selection_length = 0;
@@ -207,6 +215,23 @@ void WidgetTextInput::SetValue(String value)
 		TransformValue(value);
 		RMLUI_ASSERTMSG(value.size() == initial_size, "TransformValue must not change the text length.");
 
+		// Record the range of the edit, so that only the lines affected by it need to be reflowed.
+		const String& previous_value = GetValue();
+		if (has_pending_edit)
+		{
+			lines_layout_width = -1.f;
+		}
+		else if (previous_value != value)
+		{
+			const size_t common_size = Math::Min(previous_value.size(), value.size());
+			const size_t prefix = size_t(std::mismatch(value.begin(), value.begin() + common_size, previous_value.begin()).first - value.begin());
+			const size_t suffix = size_t(
+				std::mismatch(value.rbegin(), value.rbegin() + (common_size - prefix), previous_value.rbegin()).first - value.rbegin());
+
+			pending_edit = TextEdit{int(prefix), int(previous_value.size() - suffix), int(value.size() - suffix)};
+			has_pending_edit = true;
+		}
+
 		text_element->SetText(value);
 
 		FormatElement();
@@ -353,8 +378,31 @@ void WidgetTextInput::OnResize()
 	ForceFormattingOnNextLayout();
 }
 
+void WidgetTextInput::OnPropertyChange(const PropertyIdSet& changed_properties)
+{
+	// Some inherited properties require text formatting update, mainly font, alignment, and spacing properties. Font effects do not affect
+	// the layout, but we format from scratch anyway so that the lines are never reflowed with a stale state.
+	const PropertyIdSet changed_inherited_layout_properties = changed_properties &
+		(StyleSheetSpecification::GetRegisteredInheritedProperties() & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
+
+	if (!changed_inherited_layout_properties.Empty() || changed_properties.Contains(PropertyId::FontEffect))
+		ForceFormattingOnNextLayout();
+
+	if (changed_properties.Contains(PropertyId::Color) || changed_properties.Contains(PropertyId::BackgroundColor))
+		UpdateSelectionColours();
+
+	if (changed_properties.Contains(PropertyId::CaretColor))
+		GenerateCursor();
+}
+
 void WidgetTextInput::OnRender()
 {
+	// Only the lines around the visible area have their geometry generated, regenerate it when scrolled outside this range.
+	int visible_lines_begin = 0, visible_lines_end = 0;
+	GetVisibleLineRange(visible_lines_begin, visible_lines_end);
+	if (visible_lines_begin < geometry_lines_begin || visible_lines_end > geometry_lines_end)
+		GenerateLineGeometry();
+
 	ElementUtilities::SetClippingRegion(text_element);
 
 	Vector2f text_translation = parent->GetAbsoluteOffset() - Vector2f(parent->GetScrollLeft(), parent->GetScrollTop());
@@ -1038,6 +1086,28 @@ void WidgetTextInput::FormatElement()
 	const Overflow y_overflow_property = parent->GetComputedValues().overflow_y();
 	const bool word_wrap = (parent->GetComputedValues().white_space() == WhiteSpace::Prewrap);
 
+	// If the lines are already laid out for the current width, such as after editing the text, we first try to keep the current scrollbars so
+	// that the lines can be reflowed incrementally. Only if the new content does not match the scrollbars do we need to format from scratch.
+	if (CanReflowLines())
+	{
+		const bool horizontal_enabled = scroll->IsScrollbarEnabled(ElementScroll::HORIZONTAL);
+		const bool vertical_enabled = scroll->IsScrollbarEnabled(ElementScroll::VERTICAL);
+
+		const Vector2f content_area = FormatText();
+
+		const bool horizontal_needed = (x_overflow_property == Overflow::Scroll ||
+			(!word_wrap && x_overflow_property == Overflow::Auto && content_area.x > parent->GetClientWidth()));
+		const bool vertical_needed =
+			(y_overflow_property == Overflow::Scroll || (y_overflow_property == Overflow::Auto && content_area.y > parent->GetClientHeight()));
+
+		if (horizontal_needed == horizontal_enabled && vertical_needed == vertical_enabled)
+		{
+			parent->SetScrollableOverflowRectangle(content_area);
+			scroll->FormatScrollbars();
+			return;
+		}
+	}
+
 	if (x_overflow_property == Overflow::Scroll)
 		scroll->EnableScrollbar(ElementScroll::HORIZONTAL, width);
 	else
@@ -1078,190 +1148,291 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 
 	const FontFaceHandle font_handle = parent->GetFontFaceHandle();
 	if (!font_handle)
+	{
+		lines_layout_width = -1.f;
+		has_pending_edit = false;
 		return content_area;
-
-	// Clear the old lines, and all the lines in the text elements.
-	lines.clear();
-	text_element->ClearLines();
-	selected_text_element->ClearLines();
+	}
 
 	// Determine the line-height of the text element.
 	const float line_height = parent->GetLineHeight();
 	const float font_baseline = GetFontEngineInterface()->GetFontMetrics(font_handle).ascent;
-	// When the selection contains endlines we expand the selection area by this width.
-	const int endline_selection_width = int(0.4f * parent->GetComputedValues().font_size());
 
 	const float client_width = parent->GetClientWidth();
-	int line_begin = 0;
-	Vector2f line_position(0, font_baseline);
-	bool last_line = false;
+	const float maximum_line_width = client_width - cursor_size.x;
 
-	auto text_align = GetElement()->GetComputedValues().text_align();
+	if (client_width <= 0.f)
+	{
+		lines.assign(1, Line{});
+		lines_layout_width = -1.f;
+	}
+	else if (CanReflowLines())
+	{
+		if (has_pending_edit)
+			ReflowLines(maximum_line_width);
+	}
+	else
+	{
+		lines.clear();
 
-	struct Segment {
-		Vector2f position;
-		int width;
-		String content;
-		bool selected;
-		int line_index;
-	};
+		int line_begin = 0;
+		float line_position_y = font_baseline;
+		bool last_line = false;
+
+		// Keep generating lines until all the text content is placed.
+		do
+		{
+			Line line = {};
+			last_line = LayoutLine(line, line_begin, maximum_line_width);
+
+			line_begin += line.size;
+			line_position_y += line_height;
 
-	Vector<Segment> segments;
+			lines.push_back(line);
 
-	// Keep generating lines until all the text content is placed.
-	do
+		} while (!last_line && line_position_y - font_baseline <= height_constraint);
+
+		// If we aborted early due to the height constraint, the lines need to be laid out from scratch the next time.
+		lines_layout_width = (last_line ? maximum_line_width : -1.f);
+	}
+
+	has_pending_edit = false;
+
+	// Grow the content area width-wise to the longest line, and push the height out for each line.
+	if (client_width > 0.f)
 	{
-		if (client_width <= 0.f)
+		float line_position_y = font_baseline;
+		for (const Line& line : lines)
 		{
-			lines.push_back(Line{});
-			break;
+			content_area.x = Math::Max(content_area.x, line.width + cursor_size.x);
+			line_position_y += line_height;
 		}
+		content_area.y = line_position_y - font_baseline;
+	}
 
-		Line line = {};
-		line.value_offset = line_begin;
-		float line_width;
-		String line_content;
+	// Clamp the cursor to a valid range.
+	absolute_cursor_index = Math::Min(absolute_cursor_index, (int)GetValue().size());
 
-		// Generate the next line.
-		last_line = text_element->GenerateLine(line_content, line.size, line_width, line_begin, client_width - cursor_size.x, 0, false, false, false);
+	GenerateLineGeometry();
 
-		// If this line terminates in a soft-return (word wrap), then the line may be leaving a space or two behind as an orphan. If so, we must
-		// append the orphan onto the line even though it will push the line outside of the input field's bounds.
-		String orphan;
-		if (!last_line && (line_content.empty() || line_content.back() != '\n'))
+	return content_area;
+}
+
+bool WidgetTextInput::CanReflowLines() const
+{
+	return lines_layout_width >= 0.f && !lines.empty() && lines_layout_width == parent->GetClientWidth() - cursor_size.x;
+}
+
+bool WidgetTextInput::LayoutLine(Line& line, int line_begin, float maximum_line_width) const
+{
+	line = {};
+	line.value_offset = line_begin;
+	String line_content;
+
+	const bool last_line = text_element->GenerateLine(line_content, line.size, line.width, line_begin, maximum_line_width, 0, false, false, false);
+
+	// If this line terminates in a soft-return (word wrap), then the line may be leaving a space or two behind as an orphan. If so, we must
+	// append the orphan onto the line even though it will push the line outside of the input field's bounds.
+	String orphan;
+	if (!last_line && (line_content.empty() || line_content.back() != '\n'))
+	{
+		const String& text = GetValue();
+		for (int i = 1; i >= 0; --i)
 		{
-			const String& text = GetValue();
-			for (int i = 1; i >= 0; --i)
+			int index = line_begin + line.size + i;
+			if (index >= (int)text.size())
+				continue;
+
+			if (text[index] != ' ')
 			{
-				int index = line_begin + line.size + i;
-				if (index >= (int)text.size())
-					continue;
-
-				if (text[index] != ' ')
-				{
-					orphan.clear();
-					continue;
-				}
-
-				int next_index = index + 1;
-				if (!orphan.empty() || next_index >= (int)text.size() || text[next_index] != ' ')
-					orphan += ' ';
+				orphan.clear();
+				continue;
 			}
-		}
 
-		if (!orphan.empty())
-		{
-			line_content += orphan;
-			line.size += (int)orphan.size();
-			line_width += ElementUtilities::GetStringWidth(text_element, orphan);
+			int next_index = index + 1;
+			if (!orphan.empty() || next_index >= (int)text.size() || text[next_index] != ' ')
+				orphan += ' ';
 		}
+	}
+
+	if (!orphan.empty())
+	{
+		line_content += orphan;
+		line.size += (int)orphan.size();
+		line.width += ElementUtilities::GetStringWidth(text_element, orphan);
+	}
+
+	// visually remove trailing space if right aligned
+	if (!last_line && parent->GetComputedValues().text_align() == Style::TextAlign::Right && !line_content.empty() && line_content.back() == ' ')
+	{
+		line_content.pop_back();
+		line.width -= ElementUtilities::GetStringWidth(text_element, " ");
+	}
+
+	// Check if the editable length needs to be truncated to dodge a trailing endline.
+	line.editable_length = (int)line_content.size();
+	if (!line_content.empty() && line_content.back() == '\n')
+		line.editable_length -= 1;
+
+	return last_line;
+}
 
-		// visually remove trailing space if right aligned
-		if (!last_line && text_align == Style::TextAlign::Right && !line_content.empty() && line_content.back() == ' ')
+void WidgetTextInput::ReflowLines(float maximum_line_width)
+{
+	RMLUI_ASSERT(has_pending_edit && !lines.empty());
+
+	const String& value = GetValue();
+	const TextEdit& edit = pending_edit;
+	const int offset_delta = edit.new_end - edit.old_end;
+
+	auto EndsWithEndline = [&value](const Line& line) { return line.size > 0 && value[size_t(line.value_offset + line.size - 1)] == '\n'; };
+
+	// Word wrapping may pull text back onto earlier lines of the same paragraph, thus start reflowing at the beginning of the paragraph
+	// containing the edit. Lines before it only consist of text in front of the edit, and are not affected.
+	auto it_edit = std::upper_bound(lines.begin(), lines.end(), edit.begin, [](int offset, const Line& line) { return offset < line.value_offset; });
+	int first_line = Math::Max(int(it_edit - lines.begin()) - 1, 0);
+	while (first_line > 0 && !EndsWithEndline(lines[first_line - 1]))
+		first_line -= 1;
+
+	LineList reflowed_lines;
+	int resume_line = (int)lines.size();
+	int line_begin = lines[first_line].value_offset;
+	bool last_line = false;
+
+	while (!last_line)
+	{
+		Line line = {};
+		last_line = LayoutLine(line, line_begin, maximum_line_width);
+		line_begin += line.size;
+		reflowed_lines.push_back(line);
+
+		// Once we reach a hard line break after the edit, the following lines are the same as before, only offset by the size of the edit.
+		if (!last_line && line_begin > edit.new_end && value[size_t(line_begin - 1)] == '\n')
 		{
-			line_content.pop_back();
-			line_width -= ElementUtilities::GetStringWidth(text_element, " ");
+			const int previous_offset = line_begin - offset_delta;
+			auto it_resume = std::lower_bound(lines.begin() + first_line, lines.end(), previous_offset,
+				[](const Line& line, int offset) { return line.value_offset < offset; });
+
+			if (it_resume != lines.end() && it_resume->value_offset == previous_offset)
+			{
+				resume_line = int(it_resume - lines.begin());
+				break;
+			}
 		}
+	}
+
+	lines.erase(lines.begin() + first_line, lines.begin() + resume_line);
+	lines.insert(lines.begin() + first_line, reflowed_lines.begin(), reflowed_lines.end());
+
+	for (size_t i = size_t(first_line) + reflowed_lines.size(); i < lines.size(); i++)
+		lines[i].value_offset += offset_delta;
+}
+
+void WidgetTextInput::GetVisibleLineRange(int& out_begin, int& out_end) const
+{
+	const int num_lines = (int)lines.size();
+	const float line_height = parent->GetLineHeight();
+	if (line_height <= 0.f)
+	{
+		out_begin = 0;
+		out_end = num_lines;
+		return;
+	}
+
+	const float scroll_top = parent->GetScrollTop();
+	const int first_visible_line = int(scroll_top / line_height);
+	const int last_visible_line = int((scroll_top + parent->GetClientHeight()) / line_height) + 1;
+	const int page_size = last_visible_line - first_visible_line;
+
+	out_begin = Math::Clamp(first_visible_line - page_size, 0, num_lines);
+	out_end = Math::Clamp(last_visible_line + page_size, out_begin, num_lines);
+}
 
-		// Now that we have the string of characters appearing on the new line, we split it into
-		// three parts; the unselected text appearing before any selected text on the line, the
-		// selected text on the line, and any unselected text after the selection.
+void WidgetTextInput::GenerateLineGeometry()
+{
+	// Clear all the lines in the text elements, and the selection background geometry.
+	text_element->ClearLines();
+	selected_text_element->ClearLines();
+	Mesh selection_mesh = selection_geometry.Release(Geometry::ReleaseMode::ClearMesh);
+
+	GetVisibleLineRange(geometry_lines_begin, geometry_lines_end);
+
+	const FontFaceHandle font_handle = parent->GetFontFaceHandle();
+	if (!font_handle)
+		return;
+
+	const float line_height = parent->GetLineHeight();
+	const float font_baseline = GetFontEngineInterface()->GetFontMetrics(font_handle).ascent;
+	// When the selection contains endlines we expand the selection area by this width.
+	const int endline_selection_width = int(0.4f * parent->GetComputedValues().font_size());
+
+	const String& value = GetValue();
+
+	// Return the extra kerning that would result in joining two strings.
+	auto GetKerningBetween = [this](const String& left, const String& right) -> float {
+		if (left.empty() || right.empty())
+			return 0.0f;
+		// We could join the whole string, and compare the result of the joined width to the individual widths of each string. Instead, we take
+		// the two neighboring characters from each string and compare the string width with and without kerning, which should be much faster.
+		const Character left_back = StringUtilities::ToCharacter(StringUtilities::SeekBackwardUTF8(&left.back(), &left.front()));
+		const String right_front_u8 =
+			right.substr(0, size_t(StringUtilities::SeekForwardUTF8(right.c_str() + 1, right.c_str() + right.size()) - right.c_str()));
+		const int width_kerning = ElementUtilities::GetStringWidth(text_element, right_front_u8, left_back);
+		const int width_no_kerning = ElementUtilities::GetStringWidth(text_element, right_front_u8, Character::Null);
+		return float(width_kerning - width_no_kerning);
+	};
+
+	Vector2f line_position(0, font_baseline + float(geometry_lines_begin) * line_height);
+
+	for (int line_index = geometry_lines_begin; line_index < geometry_lines_end; line_index++)
+	{
+		const Line& line = lines[line_index];
+
+		// The line content includes any trailing endline, but not a trailing space which was visually removed from right-aligned lines.
+		const bool ends_with_endline = (line.editable_length < line.size && value[size_t(line.value_offset + line.size - 1)] == '\n');
+		const String line_content = value.substr((size_t)line.value_offset, size_t(ends_with_endline ? line.size : line.editable_length));
+
+		// Now that we have the string of characters appearing on the line, we split it into three parts; the unselected text appearing before
+		// any selected text on the line, the selected text on the line, and any unselected text after the selection.
 		String pre_selection, selection, post_selection;
-		GetLineSelection(pre_selection, selection, post_selection, line_content, line_begin);
+		GetLineSelection(pre_selection, selection, post_selection, line_content, line.value_offset);
+
+		line_position.x = GetAlignmentSpecificTextOffset(value.data() + line.value_offset, line_index);
 
-		// The pre-selected text is placed, if there is any (if the selection starts on or before
-		// the beginning of this line, then this will be empty).
+		// The pre-selected text is placed, if there is any (if the selection starts on or before the beginning of this line, then this will be
+		// empty).
 		if (!pre_selection.empty())
 		{
-			const int width = ElementUtilities::GetStringWidth(text_element, pre_selection);
-			segments.push_back({line_position, width, pre_selection, false, (int)lines.size()});
-			line_position.x += width;
+			text_element->AddLine(line_position, pre_selection);
+			line_position.x += ElementUtilities::GetStringWidth(text_element, pre_selection);
 		}
 
-		// Return the extra kerning that would result in joining two strings.
-		auto GetKerningBetween = [this](const String& left, const String& right) -> float {
-			if (left.empty() || right.empty())
-				return 0.0f;
-			// We could join the whole string, and compare the result of the joined width to the individual widths of each string. Instead, we take
-			// the two neighboring characters from each string and compare the string width with and without kerning, which should be much faster.
-			const Character left_back = StringUtilities::ToCharacter(StringUtilities::SeekBackwardUTF8(&left.back(), &left.front()));
-			const String right_front_u8 =
-				right.substr(0, size_t(StringUtilities::SeekForwardUTF8(right.c_str() + 1, right.c_str() + right.size()) - right.c_str()));
-			const int width_kerning = ElementUtilities::GetStringWidth(text_element, right_front_u8, left_back);
-			const int width_no_kerning = ElementUtilities::GetStringWidth(text_element, right_front_u8, Character::Null);
-			return float(width_kerning - width_no_kerning);
-		};
-
-		// Check if the editable length needs to be truncated to dodge a trailing endline.
-		line.editable_length = (int)line_content.size();
-		if (!line_content.empty() && line_content.back() == '\n')
-			line.editable_length -= 1;
-
-		// If there is any selected text on this line, place it in the selected text element and
-		// generate the geometry for its background.
+		// If there is any selected text on this line, place it in the selected text element and generate the geometry for its background.
 		if (!selection.empty())
 		{
 			line_position.x += GetKerningBetween(pre_selection, selection);
 			const int selection_width = ElementUtilities::GetStringWidth(selected_text_element, selection);
-			segments.push_back({line_position, selection_width, selection, true, (int)lines.size()});
+
+			const bool selection_contains_endline = (selection_begin_index + selection_length > line.value_offset + line.editable_length);
+			const Vector2f selection_size(float(selection_width + (selection_contains_endline ? endline_selection_width : 0)), line_height);
+
+			MeshUtilities::GenerateQuad(selection_mesh, line_position - Vector2f(0, font_baseline), selection_size, selection_colour);
+			selected_text_element->AddLine(line_position, selection);
 
 			line_position.x += selection_width;
 		}
 
-		// If there is any unselected text after the selection on this line, place it in the
-		// standard text element after the selected text.
+		// If there is any unselected text after the selection on this line, place it in the standard text element after the selected text.
 		if (!post_selection.empty())
 		{
 			line_position.x += GetKerningBetween(selection, post_selection);
-			const int width = ElementUtilities::GetStringWidth(text_element, post_selection);
-			segments.push_back({line_position, width, post_selection, false, (int)lines.size()});
+			text_element->AddLine(line_position, post_selection);
 		}
 
-		// Update variables for the next line.
-		line_begin += line.size;
-		line_position.x = 0;
 		line_position.y += line_height;
-
-		// Grow the content area width-wise if this line is the longest so far, and push the height out.
-		content_area.x = Math::Max(content_area.x, line_width + cursor_size.x);
-		content_area.y = line_position.y - font_baseline;
-
-		// Finally, push the new line into our array of lines.
-		lines.push_back(std::move(line));
-
-	} while (!last_line && content_area.y <= height_constraint);
-
-	// Clamp the cursor to a valid range.
-	absolute_cursor_index = Math::Min(absolute_cursor_index, (int)GetValue().size());
-
-	// Clear the selection background geometry, and get the vertices and indices so the new geometry can be generated.
-	Mesh selection_mesh = selection_geometry.Release(Geometry::ReleaseMode::ClearMesh);
-
-	// Transform segments according to text alignment
-	for (auto& it : segments)
-	{
-		auto const& line = lines[it.line_index];
-		const char* p_begin = GetValue().data() + line.value_offset;
-		float offset = GetAlignmentSpecificTextOffset(p_begin, it.line_index);
-
-		it.position.x += offset;
-
-		if (it.selected)
-		{
-			const bool selection_contains_endline = (selection_begin_index + selection_length > line_begin + lines[it.line_index].editable_length);
-			const Vector2f selection_size(float(it.width + (selection_contains_endline ? endline_selection_width : 0)), line_height);
-
-			MeshUtilities::GenerateQuad(selection_mesh, it.position - Vector2f(0, font_baseline), selection_size, selection_colour);
-
-			selected_text_element->AddLine(it.position, it.content);
-		}
-		else
-			text_element->AddLine(it.position, it.content);
 	}
 
 	selection_geometry = parent->GetRenderManager()->MakeGeometry(std::move(selection_mesh));
-
-	return content_area;
 }
 
 void WidgetTextInput::GenerateCursor()
@@ -1285,6 +1456,7 @@ void WidgetTextInput::GenerateCursor()
 void WidgetTextInput::ForceFormattingOnNextLayout()
 {
 	force_formatting_on_next_layout = true;
+	lines_layout_width = -1.f;
 }
 
 void WidgetTextInput::UpdateCursorPosition(bool update_ideal_cursor_position)
@@ -91,6 +91,8 @@ public:
 	void OnLayout();
 	/// Called when the parent element's size changes.
 	void OnResize();
+	/// Called when properties on the parent element change.
+	void OnPropertyChange(const PropertyIdSet& changed_properties);
 
 protected:
 	enum class CursorMovement { Begin = -4, BeginLine = -3, PreviousWord = -2, Left = -1, Right = 1, NextWord = 2, EndLine = 3, End = 4 };
@@ -128,6 +130,25 @@ protected:
 	void DispatchChangeEvent(bool linebreak = false);
 
 private:
+	struct Line {
+		// Offset into the text field's value.
+		int value_offset;
+		// The size of the contents of the line (including the trailing endline, if that terminated the line).
+		int size;
+		// The length of the editable characters on the line (excluding any trailing endline).
+		int editable_length;
+		// The width of the line's contents.
+		float width;
+	};
+
+	// Byte range of a text edit since the last formatting. The edit replaced the range [begin, old_end) of the previous value with the
+	// range [begin, new_end) of the current value.
+	struct TextEdit {
+		int begin;
+		int old_end;
+		int new_end;
+	};
+
 	/// Returns the displayed value of the text field.
 	/// @note For password fields this would only return the displayed asterisks '****', while the attribute value below contains the underlying text.
 	const String& GetValue() const;
@@ -179,6 +200,20 @@ private:
 	/// @param[in] height_constraint Abort formatting when the formatted size grows larger than this height.
 	/// @return The content area of the element.
 	Vector2f FormatText(float height_constraint = FLT_MAX);
+	/// Returns true if the current lines were laid out for the current width of the text field, and can be reflowed incrementally.
+	bool CanReflowLines() const;
+	/// Lays out a single line of text.
+	/// @param[out] line The resulting line.
+	/// @param[in] line_begin The byte offset into the text field's value where the line starts.
+	/// @param[in] maximum_line_width The available width of the line.
+	/// @return True if this is the last line of the text field.
+	bool LayoutLine(Line& line, int line_begin, float maximum_line_width) const;
+	/// Reflows only the lines affected by the pending text edit, starting from the paragraph containing the edit.
+	void ReflowLines(float maximum_line_width);
+	/// Returns the range of lines visible in the text field, including a margin of one page in each direction.
+	void GetVisibleLineRange(int& out_begin, int& out_end) const;
+	/// Generates the text and selection geometry of the visible lines.
+	void GenerateLineGeometry();
 
 	/// Updates the position to render the cursor.
 	/// @param[in] update_ideal_cursor_position Generally should be true on horizontal movement and false on vertical movement.
@@ -206,15 +241,6 @@ private:
 	/// @param[in] line_begin The absolute index at the beginning of the line.
 	void GetLineSelection(String& pre_selection, String& selection, String& post_selection, const String& line, int line_begin) const;
 
-	struct Line {
-		// Offset into the text field's value.
-		int value_offset;
-		// The size of the contents of the line (including the trailing endline, if that terminated the line).
-		int size;
-		// The length of the editable characters on the line (excluding any trailing endline).
-		int editable_length;
-	};
-
 	ElementFormControl* parent;
 
 	ElementText* text_element;
@@ -225,6 +251,16 @@ private:
 	using LineList = Vector<Line>;
 	LineList lines;
 
+	// The maximum line width the lines were laid out for, or negative if they need to be laid out from scratch.
+	float lines_layout_width;
+	// The edit to the value since the lines were laid out, only valid if 'has_pending_edit' is set.
+	TextEdit pending_edit;
+	bool has_pending_edit;
+
+	// The range of lines that text and selection geometry is currently generated for.
+	int geometry_lines_begin;
+	int geometry_lines_end;
+
 	// Length in number of characters.
 	int max_length;
 
@@ -28,19 +28,26 @@
 
 #include "EventSpecification.h"
 #include "../../Include/RmlUi/Core/ID.h"
+#include <deque>
+#include <mutex>
 
 namespace Rml {
 
-// An EventId is an index into the specifications vector.
-static Vector<EventSpecification> specifications = {{EventId::Invalid, "invalid", false, false, DefaultActionPhase::None}};
+// An EventId is an index into the specifications list. A deque is used so that references remain valid as new types are inserted.
+static std::deque<EventSpecification> specifications = {{EventId::Invalid, "invalid", false, false, DefaultActionPhase::None}};
 
 // Reverse lookup map from event type to id.
 static UnorderedMap<String, EventId> type_lookup;
 
+// New event types may be inserted while contexts are updated on different threads.
+static std::mutex specifications_mutex;
+
 namespace EventSpecificationInterface {
 
 	void Initialize()
 	{
+		std::lock_guard<std::mutex> lock(specifications_mutex);
+
 		// Must be specified in the same order as in EventId
 		specifications = {
 			//      id                 type      interruptible  bubbles     default_action
@@ -138,10 +145,12 @@ namespace EventSpecificationInterface {
 
 	const EventSpecification& Get(EventId id)
 	{
+		std::lock_guard<std::mutex> lock(specifications_mutex);
 		return GetMutable(id);
 	}
 
-	const EventSpecification& GetOrInsert(const String& event_type)
+	// Get event specification for the given type, inserting a new entry with default values if not found.
+	static EventSpecification& GetOrInsertDefault(const String& event_type)
 	{
 		// Default values for new event types defined as follows:
 		constexpr bool interruptible = true;
@@ -151,17 +160,25 @@ namespace EventSpecificationInterface {
 		return GetOrInsert(event_type, interruptible, bubbles, default_action_phase);
 	}
 
+	const EventSpecification& GetOrInsert(const String& event_type)
+	{
+		std::lock_guard<std::mutex> lock(specifications_mutex);
+		return GetOrInsertDefault(event_type);
+	}
+
 	EventId GetIdOrInsert(const String& event_type)
 	{
+		std::lock_guard<std::mutex> lock(specifications_mutex);
 		auto it = type_lookup.find(event_type);
 		if (it != type_lookup.end())
 			return it->second;
 
-		return GetOrInsert(event_type).id;
+		return GetOrInsertDefault(event_type).id;
 	}
 
 	EventId InsertOrReplaceCustom(const String& event_type, bool interruptible, bool bubbles, DefaultActionPhase default_action_phase)
 	{
+		std::lock_guard<std::mutex> lock(specifications_mutex);
 		const size_t size_before = specifications.size();
 		EventSpecification& specification = GetOrInsert(event_type, interruptible, bubbles, default_action_phase);
 		bool got_existing_entry = (size_before == specifications.size());
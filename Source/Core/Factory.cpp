@@ -41,10 +41,12 @@
 #include "../../Include/RmlUi/Core/Elements/ElementProgress.h"
 #include "../../Include/RmlUi/Core/Elements/ElementTabSet.h"
 #include "../../Include/RmlUi/Core/EventListenerInstancer.h"
+#include "../../Include/RmlUi/Core/PreparedDocument.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetContainer.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "ContextActivity.h"
 #include "ContextInstancerDefault.h"
 #include "DataControllerDefault.h"
 #include "DataViewDefault.h"
@@ -55,6 +57,7 @@
 #include "DecoratorTiledHorizontal.h"
 #include "DecoratorTiledImage.h"
 #include "DecoratorTiledVertical.h"
+#include "DocumentHeader.h"
 #include "ElementHandle.h"
 #include "Elements/ElementImage.h"
 #include "Elements/ElementLabel.h"
@@ -339,6 +342,7 @@ void Factory::Shutdown()
 
 void Factory::RegisterContextInstancer(ContextInstancer* instancer)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	context_instancer = instancer;
 }
 
@@ -352,6 +356,7 @@ ContextPtr Factory::InstanceContext(const String& name, RenderManager* render_ma
 
 void Factory::RegisterElementInstancer(const String& name, ElementInstancer* instancer)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	element_instancers[StringUtilities::ToLower(name)] = instancer;
 }
 
@@ -484,11 +489,9 @@ bool Factory::InstanceElementStream(Element* parent, Stream* stream)
 	return true;
 }
 
-ElementPtr Factory::InstanceDocumentStream(Context* context, Stream* stream, const String& document_base_tag)
+static ElementDocument* InstanceDocumentElement(ElementPtr& element, const String& document_base_tag)
 {
-	RMLUI_ZoneScoped;
-
-	ElementPtr element = Factory::InstanceElement(nullptr, document_base_tag, document_base_tag, XMLAttributes());
+	element = Factory::InstanceElement(nullptr, document_base_tag, document_base_tag, XMLAttributes());
 	if (!element)
 	{
 		Log::Message(Log::LT_ERROR, "Failed to instance document, instancer returned nullptr.");
@@ -503,6 +506,18 @@ ElementPtr Factory::InstanceDocumentStream(Context* context, Stream* stream, con
 		return nullptr;
 	}
 
+	return document;
+}
+
+ElementPtr Factory::InstanceDocumentStream(Context* context, Stream* stream, const String& document_base_tag)
+{
+	RMLUI_ZoneScoped;
+
+	ElementPtr element;
+	ElementDocument* document = InstanceDocumentElement(element, document_base_tag);
+	if (!document)
+		return nullptr;
+
 	document->context = context;
 
 	XMLParser parser(element.get());
@@ -511,8 +526,64 @@ ElementPtr Factory::InstanceDocumentStream(Context* context, Stream* stream, con
 	return element;
 }
 
+UniquePtr<PreparedDocument> Factory::PrepareDocumentStream(Stream* stream)
+{
+	RMLUI_ZoneScoped;
+
+	UniquePtr<PreparedDocument> prepared_document(new PreparedDocument);
+	prepared_document->source_url = stream->GetSourceURL();
+
+	// Parse the whole document up front, so that loading the document only has to submit the parsed nodes to the node handlers.
+	XMLParser document_parser(nullptr);
+	document_parser.ParseNodes(stream, prepared_document->nodes);
+
+	// Handle only the header nodes, no elements are instanced without a root element.
+	const XMLParsedNodeList& nodes = prepared_document->nodes;
+	auto IsHeadNode = [](const XMLParsedNode& node, XMLParsedNode::Type type) {
+		return node.type == type && StringUtilities::ToLower(node.value) == "head";
+	};
+	const auto head_begin = std::find_if(nodes.begin(), nodes.end(), [&](const XMLParsedNode& node) {
+		return IsHeadNode(node, XMLParsedNode::Type::ElementStart);
+	});
+	const auto head_end = std::find_if(head_begin, nodes.end(), [&](const XMLParsedNode& node) {
+		return IsHeadNode(node, XMLParsedNode::Type::ElementEnd);
+	});
+	if (head_end != nodes.end())
+	{
+		XMLParser parser(nullptr);
+		parser.HandleNodes(Span<const XMLParsedNode>(&*head_begin, size_t(head_end - head_begin) + 1), prepared_document->source_url);
+
+		// Load the style sheets of the document and its templates, the expensive part of processing the header.
+		prepared_document->style_sheet_container = parser.GetDocumentHeader()->MergeTemplates().LoadStyleSheetContainer();
+	}
+
+	return prepared_document;
+}
+
+ElementPtr Factory::InstanceDocument(Context* context, const PreparedDocument& prepared_document, const String& document_base_tag)
+{
+	RMLUI_ZoneScoped;
+
+	ElementPtr element;
+	ElementDocument* document = InstanceDocumentElement(element, document_base_tag);
+	if (!document)
+		return nullptr;
+
+	document->context = context;
+
+	// Give the document its own container of the shared style sheets, as the container is compiled separately for each document.
+	if (prepared_document.style_sheet_container)
+		document->prepared_style_sheet_container = prepared_document.style_sheet_container->CombineStyleSheetContainer(StyleSheetContainer());
+
+	XMLParser parser(element.get());
+	parser.HandleNodes(prepared_document.nodes, prepared_document.source_url);
+
+	return element;
+}
+
 void Factory::RegisterDecoratorInstancer(const String& name, DecoratorInstancer* instancer)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	RMLUI_ASSERT(instancer);
 	decorator_instancers[StringUtilities::ToLower(name)] = instancer;
 }
@@ -528,6 +599,7 @@ DecoratorInstancer* Factory::GetDecoratorInstancer(const String& name)
 
 void Factory::RegisterFilterInstancer(const String& name, FilterInstancer* instancer)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	RMLUI_ASSERT(instancer);
 	filter_instancers[StringUtilities::ToLower(name)] = instancer;
 }
@@ -543,6 +615,7 @@ FilterInstancer* Factory::GetFilterInstancer(const String& name)
 
 void Factory::RegisterFontEffectInstancer(const String& name, FontEffectInstancer* instancer)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	RMLUI_ASSERT(instancer);
 	font_effect_instancers[StringUtilities::ToLower(name)] = instancer;
 }
@@ -591,6 +664,7 @@ void Factory::ClearTemplateCache()
 
 void Factory::RegisterEventInstancer(EventInstancer* instancer)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	event_instancer = instancer;
 }
 
@@ -604,6 +678,7 @@ EventPtr Factory::InstanceEvent(Element* target, EventId id, const String& type,
 
 void Factory::RegisterEventListenerInstancer(EventListenerInstancer* instancer)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	event_listener_instancer = instancer;
 }
 
@@ -618,6 +693,7 @@ EventListener* Factory::InstanceEventListener(const String& value, Element* elem
 
 void Factory::RegisterDataViewInstancer(DataViewInstancer* instancer, const String& name, bool is_structural_view)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	bool inserted = false;
 	if (is_structural_view)
 	{
@@ -636,6 +712,7 @@ void Factory::RegisterDataViewInstancer(DataViewInstancer* instancer, const Stri
 
 void Factory::RegisterDataControllerInstancer(DataControllerInstancer* instancer, const String& name)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	bool inserted = data_controller_instancers.emplace(name, instancer).second;
 	if (!inserted)
 		Log::Message(Log::LT_WARNING, "Could not register data controller instancer '%s'. The given name is already registered.", name.c_str());
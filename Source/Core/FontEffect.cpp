@@ -92,4 +92,15 @@ void FontEffect::FillColorValuesFromAlpha(byte* destination, Vector2i dimensions
 	}
 }
 
+bool FontEffect::DilateGlyphFromDistanceField(byte* destination, Vector2i dimensions, int stride, ColorFormat color_format, const FontGlyph& glyph,
+	Vector2i glyph_offset, int width)
+{
+	// Distances up to half a pixel beyond the dilated edge are needed for anti-aliasing.
+	if (glyph.GetMaxEdgeDistance() < float(width) + 1.f)
+		return false;
+
+	glyph.GenerateCoverage(destination, dimensions, stride, color_format, glyph_offset, float(width));
+	return true;
+}
+
 } // namespace Rml
@@ -132,8 +132,12 @@ void FontEffectGlow::GenerateGlyphTexture(byte* destination_data, const Vector2i
 	DynamicArray<byte, GlobalStackAllocator<byte>> outline_output(buf_size);
 	DynamicArray<byte, GlobalStackAllocator<byte>> blur_x_output(buf_size);
 
-	filter_outline.Run(outline_output.data(), buf_dimensions, buf_stride, ColorFormat::A8, glyph.bitmap_data, glyph.bitmap_dimensions,
-		Vector2i(combined_width), glyph.color_format);
+	if (!DilateGlyphFromDistanceField(outline_output.data(), buf_dimensions, buf_stride, ColorFormat::A8, glyph, Vector2i(combined_width),
+			width_outline))
+	{
+		filter_outline.Run(outline_output.data(), buf_dimensions, buf_stride, ColorFormat::A8, glyph.bitmap_data, glyph.bitmap_dimensions,
+			Vector2i(combined_width), glyph.color_format);
+	}
 
 	filter_blur_x.Run(blur_x_output.data(), buf_dimensions, buf_stride, ColorFormat::A8, outline_output.data(), buf_dimensions, Vector2i(0),
 		ColorFormat::A8);
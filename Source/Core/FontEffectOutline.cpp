@@ -91,8 +91,12 @@ bool FontEffectOutline::GetGlyphMetrics(Vector2i& origin, Vector2i& dimensions,
 void FontEffectOutline::GenerateGlyphTexture(byte* destination_data, const Vector2i destination_dimensions, int destination_stride,
 	const FontGlyph& glyph) const
 {
-	filter.Run(destination_data, destination_dimensions, destination_stride, ColorFormat::RGBA8, glyph.bitmap_data, glyph.bitmap_dimensions,
-		Vector2i(width), glyph.color_format);
+	if (!DilateGlyphFromDistanceField(destination_data, destination_dimensions, destination_stride, ColorFormat::RGBA8, glyph, Vector2i(width),
+			width))
+	{
+		filter.Run(destination_data, destination_dimensions, destination_stride, ColorFormat::RGBA8, glyph.bitmap_data, glyph.bitmap_dimensions,
+			Vector2i(width), glyph.color_format);
+	}
 
 	FillColorValuesFromAlpha(destination_data, destination_dimensions, destination_stride);
 }
@@ -29,44 +29,52 @@
 #include "FontEngineInterfaceDefault.h"
 #include "FontFaceHandleDefault.h"
 #include "FontProvider.h"
+#include <mutex>
 
 namespace Rml {
 
 void FontEngineInterfaceDefault::Initialize()
 {
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
 	FontProvider::Initialise();
 }
 
 void FontEngineInterfaceDefault::Shutdown()
 {
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
 	FontProvider::Shutdown();
 }
 
 bool FontEngineInterfaceDefault::LoadFontFace(const String& file_name, bool fallback_face, Style::FontWeight weight)
 {
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
 	return FontProvider::LoadFontFace(file_name, fallback_face, weight);
 }
 
 bool FontEngineInterfaceDefault::LoadFontFace(Span<const byte> data, const String& font_family, Style::FontStyle style, Style::FontWeight weight,
 	bool fallback_face)
 {
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
 	return FontProvider::LoadFontFace(data, font_family, style, weight, fallback_face);
 }
 
 FontFaceHandle FontEngineInterfaceDefault::GetFontFaceHandle(const String& family, Style::FontStyle style, Style::FontWeight weight, int size)
 {
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
 	auto handle = FontProvider::GetFontFaceHandle(family, style, weight, size);
 	return reinterpret_cast<FontFaceHandle>(handle);
 }
 
 FontEffectsHandle FontEngineInterfaceDefault::PrepareFontEffects(FontFaceHandle handle, const FontEffectList& font_effects)
 {
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
 	return (FontEffectsHandle)handle_default->GenerateLayerConfiguration(font_effects);
 }
 
 const FontMetrics& FontEngineInterfaceDefault::GetFontMetrics(FontFaceHandle handle)
 {
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
 	return handle_default->GetFontMetrics();
 }
@@ -74,6 +82,7 @@ const FontMetrics& FontEngineInterfaceDefault::GetFontMetrics(FontFaceHandle han
 int FontEngineInterfaceDefault::GetStringWidth(FontFaceHandle handle, const String& string, const TextShapingContext& text_shaping_context,
 	Character prior_character)
 {
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
 	return handle_default->GetStringWidth(string, text_shaping_context.letter_spacing, prior_character);
 }
@@ -82,6 +91,7 @@ int FontEngineInterfaceDefault::GenerateString(RenderManager& render_manager, Fo
 	const String& string, const Vector2f& position, ColourbPremultiplied colour, float opacity, const TextShapingContext& text_shaping_context,
 	TexturedMeshList& mesh_list)
 {
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
 	return handle_default->GenerateString(render_manager, mesh_list, string, position, colour, opacity, text_shaping_context.letter_spacing,
 		(int)font_effects_handle);
@@ -89,13 +99,37 @@ int FontEngineInterfaceDefault::GenerateString(RenderManager& render_manager, Fo
 
 int FontEngineInterfaceDefault::GetVersion(FontFaceHandle handle)
 {
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
 	return handle_default->GetVersion();
 }
 
+void FontEngineInterfaceDefault::PrepareRender()
+{
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
+	FontProvider::GetGlyphAtlas().Tick();
+	FontProvider::Tick();
+
+	// No handle is generating text before rendering, enforce the memory budget here in case text was only measured since the last time.
+	FontProvider::EnforceMemoryBudget(nullptr);
+}
+
 void FontEngineInterfaceDefault::ReleaseFontResources()
 {
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
 	FontProvider::ReleaseFontResources();
 }
 
+void FontEngineInterfaceDefault::SetMemoryBudget(size_t bytes)
+{
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
+	FontProvider::SetMemoryBudget(bytes);
+}
+
+FontEngineStatistics FontEngineInterfaceDefault::GetStatistics()
+{
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
+	return FontProvider::GetStatistics();
+}
+
 } // namespace Rml
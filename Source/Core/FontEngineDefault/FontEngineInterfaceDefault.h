@@ -70,8 +70,17 @@ public:
 	/// Returns the current version of the font face.
 	int GetVersion(FontFaceHandle handle) override;
 
+	/// Advances the usage clock of the glyph atlas.
+	void PrepareRender() override;
+
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	void ReleaseFontResources() override;
+
+	/// Sets the memory budget for the resources of font face handles, releasing the least recently used ones when exceeded.
+	void SetMemoryBudget(size_t bytes) override;
+
+	/// Returns statistics of the font face handles and their memory usage.
+	FontEngineStatistics GetStatistics() override;
 };
 
 } // namespace Rml
@@ -29,10 +29,14 @@
 #include "FontFace.h"
 #include "../../../Include/RmlUi/Core/Log.h"
 #include "FontFaceHandleDefault.h"
+#include "FontProvider.h"
 #include "FreeTypeInterface.h"
 
 namespace Rml {
 
+// The font size at which distance fields are rendered.
+static constexpr int distance_field_size = 64;
+
 FontFace::FontFace(FontFaceHandleFreetype _face, Style::FontStyle _style, Style::FontWeight _weight)
 {
 	style = _style;
@@ -69,9 +73,13 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 		return nullptr;
 	}
 
+	// Large sizes may render their glyphs from distance fields shared between all sizes, instead of rasterizing them for each size.
+	const int distance_field_threshold = FontProvider::GetDistanceFieldThreshold();
+	const bool use_distance_fields = (distance_field_threshold > 0 && size >= distance_field_threshold && FreeType::SupportsDistanceFields(face));
+
 	// Construct and initialise the new handle.
 	auto handle = MakeUnique<FontFaceHandleDefault>();
-	if (!handle->Initialize(face, size, load_default_glyphs))
+	if (!handle->Initialize(face, size, load_default_glyphs, use_distance_fields ? this : nullptr))
 	{
 		handles[size] = nullptr;
 		return nullptr;
@@ -85,9 +93,47 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 	return result;
 }
 
+const FontGlyphDistanceField* FontFace::GetDistanceField(Character character)
+{
+	auto it = distance_fields.find(character);
+	if (it != distance_fields.end())
+		return it->second.get();
+
+	// Also store failed attempts, to avoid retrying them.
+	UniquePtr<FontGlyphDistanceField>& distance_field = distance_fields[character];
+	distance_fields_memory_usage += sizeof(DistanceFieldMap::value_type);
+	if (face)
+	{
+		distance_field = MakeUnique<FontGlyphDistanceField>();
+		if (FreeType::BuildGlyphDistanceField(face, distance_field_size, character, *distance_field))
+			distance_fields_memory_usage += sizeof(FontGlyphDistanceField) + size_t(distance_field->dimensions.x * distance_field->dimensions.y);
+		else
+			distance_field.reset();
+	}
+
+	return distance_field.get();
+}
+
+float FontFace::GetDistanceFieldScale(int size) const
+{
+	return float(size) / float(distance_field_size);
+}
+
+size_t FontFace::GetDistanceFieldMemoryUsage() const
+{
+	return distance_fields_memory_usage;
+}
+
+void FontFace::ReleaseDistanceFields()
+{
+	DistanceFieldMap().swap(distance_fields);
+	distance_fields_memory_usage = 0;
+}
+
 void FontFace::ReleaseFontResources()
 {
 	HandleMap().swap(handles);
+	ReleaseDistanceFields();
 }
 
 } // namespace Rml
@@ -54,6 +54,18 @@ public:
 	/// @return The font handle.
 	FontFaceHandleDefault* GetHandle(int size, bool load_default_glyphs);
 
+	/// Returns the signed distance field of the given character, rendering it on first use. Distance fields are shared between all sizes.
+	/// @param[in] character The character to return the distance field of.
+	/// @return The distance field, or nullptr if the character has nothing to render.
+	const FontGlyphDistanceField* GetDistanceField(Character character);
+	/// Returns the number of glyph pixels per distance field pixel at the given size.
+	float GetDistanceFieldScale(int size) const;
+	/// Returns the estimated memory used by our distance fields, in bytes.
+	size_t GetDistanceFieldMemoryUsage() const;
+	/// Releases our distance fields, they are rendered again on next use.
+	/// @note No glyphs may refer to the distance fields, thus all handles using them must have released their resources.
+	void ReleaseDistanceFields();
+
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	void ReleaseFontResources();
 
@@ -61,6 +73,11 @@ private:
 	Style::FontStyle style;
 	Style::FontWeight weight;
 
+	// Declared before the handles, as their glyphs may refer to the distance fields.
+	using DistanceFieldMap = UnorderedMap<Character, UniquePtr<FontGlyphDistanceField>>;
+	DistanceFieldMap distance_fields;
+	size_t distance_fields_memory_usage = 0;
+
 	// Key is font size
 	using HandleMap = UnorderedMap<int, UniquePtr<FontFaceHandleDefault>>;
 	HandleMap handles;
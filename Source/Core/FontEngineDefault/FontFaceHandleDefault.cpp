@@ -29,12 +29,12 @@
 #include "FontFaceHandleDefault.h"
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
-#include "../TextureLayout.h"
+#include "FontFace.h"
 #include "FontFaceLayer.h"
 #include "FontProvider.h"
 #include "FreeTypeInterface.h"
 #include <algorithm>
-#include <numeric>
+#include <string.h>
 
 namespace Rml {
 
@@ -52,19 +52,26 @@ FontFaceHandleDefault::~FontFaceHandleDefault()
 {
 	glyphs.clear();
 	layers.clear();
+	FontProvider::GetGlyphAtlas().ReleaseOwner(this);
+	FontProvider::UnregisterHandle(this);
 }
 
-bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs)
+bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_size, bool _load_default_glyphs, FontFace* _distance_field_face)
 {
 	ft_face = face;
+	load_default_glyphs = _load_default_glyphs;
+	distance_field_face = _distance_field_face;
 
 	RMLUI_ASSERTMSG(layer_configurations.empty(), "Initialize must only be called once.");
 
-	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics, load_default_glyphs))
+	has_kerning = FreeType::HasKerning(ft_face);
+
+	if (!LoadResources(font_size))
 		return false;
 
-	has_kerning = FreeType::HasKerning(ft_face);
-	FillKerningPairCache();
+	last_used = FontProvider::GetHandleUseStamp();
+	FontProvider::CountHandleUse(false);
+	FontProvider::RegisterHandle(this);
 
 	// Generate the default layer and layer configuration.
 	base_layer = GetOrCreateLayer(nullptr);
@@ -73,6 +80,98 @@ bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_siz
 	return true;
 }
 
+bool FontFaceHandleDefault::LoadResources(int font_size)
+{
+	RMLUI_ASSERT(glyphs.empty() && kerning_pair_cache.empty());
+
+	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics, load_default_glyphs, !distance_field_face))
+		return false;
+
+	if (distance_field_face)
+	{
+		for (auto& pair : glyphs)
+			RenderGlyphFromDistanceField(pair.first, pair.second);
+	}
+
+	FillKerningPairCache();
+
+	is_loaded = true;
+	FontProvider::OnResourcesAdded();
+	return true;
+}
+
+void FontFaceHandleDefault::MarkUsed()
+{
+	last_used = FontProvider::GetHandleUseStamp();
+	FontProvider::CountHandleUse(is_loaded);
+
+	if (!is_loaded && LoadResources(metrics.size))
+	{
+		// The layers were emptied when our resources were released, add all the glyphs back to them.
+		is_layers_dirty = true;
+	}
+}
+
+void FontFaceHandleDefault::ReleaseResources()
+{
+	if (!is_loaded)
+		return;
+
+	FontGlyphMap().swap(glyphs);
+	KerningPairs().swap(kerning_pair_cache);
+	used_distance_field_faces.clear();
+
+	for (auto& pair : layers)
+		pair.layer->ReleaseCharacters();
+
+	FontProvider::GetGlyphAtlas().ReleaseOwner(this);
+
+	is_loaded = false;
+	is_layers_dirty = false;
+
+	// Any geometry generated with our glyphs refers to released atlas regions.
+	++version;
+}
+
+bool FontFaceHandleDefault::IsLoaded() const
+{
+	return is_loaded;
+}
+
+size_t FontFaceHandleDefault::GetMemoryUsage() const
+{
+	size_t result = glyphs.size() * sizeof(FontGlyphMap::value_type) + kerning_pair_cache.size() * sizeof(KerningPairs::value_type);
+
+	for (const auto& pair : glyphs)
+	{
+		const FontGlyph& glyph = pair.second;
+		if (glyph.bitmap_owned_data)
+			result += size_t(glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1));
+	}
+
+	for (const auto& pair : layers)
+		result += pair.layer->GetMemoryUsage();
+
+	result += FontProvider::GetGlyphAtlas().GetOwnerMemoryUsage(this);
+
+	return result;
+}
+
+uint64_t FontFaceHandleDefault::GetLastUsed() const
+{
+	return last_used;
+}
+
+FontFace* FontFaceHandleDefault::GetDistanceFieldFace() const
+{
+	return distance_field_face;
+}
+
+bool FontFaceHandleDefault::UsesDistanceFieldsOf(const FontFace* face) const
+{
+	return std::find(used_distance_field_faces.begin(), used_distance_field_faces.end(), face) != used_distance_field_faces.end();
+}
+
 const FontMetrics& FontFaceHandleDefault::GetFontMetrics() const
 {
 	return metrics;
@@ -87,6 +186,8 @@ int FontFaceHandleDefault::GetStringWidth(const String& string, float letter_spa
 {
 	RMLUI_ZoneScoped;
 
+	MarkUsed();
+
 	int width = 0;
 	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
 	{
@@ -106,6 +207,9 @@ int FontFaceHandleDefault::GetStringWidth(const String& string, float letter_spa
 		prior_character = character;
 	}
 
+	// New glyphs may have been loaded, release other handles as needed now that we are done with them.
+	FontProvider::EnforceMemoryBudget(this);
+
 	return Math::Max(width, 0);
 }
 
@@ -114,6 +218,8 @@ int FontFaceHandleDefault::GenerateLayerConfiguration(const FontEffectList& font
 	if (font_effects.empty())
 		return 0;
 
+	MarkUsed();
+
 	// Check each existing configuration for a match with this arrangement of effects.
 	int configuration_index = 1;
 	for (; configuration_index < (int)layer_configurations.size(); ++configuration_index)
@@ -172,26 +278,6 @@ int FontFaceHandleDefault::GenerateLayerConfiguration(const FontEffectList& font
 	return (int)(layer_configurations.size() - 1);
 }
 
-bool FontFaceHandleDefault::GenerateLayerTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect,
-	int texture_id, int handle_version) const
-{
-	if (handle_version != version)
-	{
-		RMLUI_ERRORMSG("While generating font layer texture: Handle version mismatch in texture vs font-face.");
-		return false;
-	}
-
-	auto it = std::find_if(layers.begin(), layers.end(), [font_effect](const EffectLayerPair& pair) { return pair.font_effect == font_effect; });
-
-	if (it == layers.end())
-	{
-		RMLUI_ERRORMSG("While generating font layer texture: Layer id not found.");
-		return false;
-	}
-
-	return it->layer->GenerateTexture(texture_data, texture_dimensions, texture_id, glyphs);
-}
-
 int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, TexturedMeshList& mesh_list, const String& string, const Vector2f position,
 	const ColourbPremultiplied colour, const float opacity, const float letter_spacing, const int layer_configuration_index)
 {
@@ -201,16 +287,60 @@ int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, Texture
 	RMLUI_ASSERT(layer_configuration_index >= 0);
 	RMLUI_ASSERT(layer_configuration_index < (int)layer_configurations.size());
 
+	MarkUsed();
+
+	FontGlyphAtlas& atlas = FontProvider::GetGlyphAtlas();
+
 	UpdateLayersOnDirty();
 
 	// Fetch the requested configuration and generate the geometry for each one.
 	const LayerConfiguration& layer_configuration = layer_configurations[layer_configuration_index];
 
-	// Each texture represents one geometry.
-	const int num_geometries = std::accumulate(layer_configuration.begin(), layer_configuration.end(), 0,
-		[](int sum, const FontFaceLayer* layer) { return sum + layer->GetNumTextures(); });
+	// Make sure all the characters are available in the glyph atlas before generating any geometry, as adding new glyphs may clear atlas
+	// pages.
+	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
+	{
+		Character character = *it_string;
 
-	mesh_list.resize(num_geometries);
+		const FontGlyph* glyph = GetOrAppendGlyph(character);
+		if (!glyph)
+			continue;
+
+		for (FontFaceLayer* layer : layer_configuration)
+			layer->UseCharacter(this, character, *glyph);
+	}
+
+	// Each layer renders to one mesh for every page in the atlas, meshes without any glyphs are left empty. The mesh list is shared between all
+	// the lines of a text element. If pages were added since the previous lines, move their meshes to the new layout.
+	const int num_layers = (int)layer_configuration.size();
+	const int num_pages = atlas.GetNumPageSlots();
+	if ((int)mesh_list.size() != num_layers * num_pages)
+	{
+		const int previous_num_pages = (int)mesh_list.size() / num_layers;
+		TexturedMeshList previous_mesh_list = std::move(mesh_list);
+
+		mesh_list.clear();
+		mesh_list.resize(num_layers * num_pages);
+
+		const int num_pages_to_move = Math::Min(previous_num_pages, num_pages);
+		for (int layer_index = 0; layer_index < num_layers; layer_index++)
+		{
+			for (int page_index = 0; page_index < num_pages_to_move; page_index++)
+				mesh_list[layer_index * num_pages + page_index] = std::move(previous_mesh_list[layer_index * previous_num_pages + page_index]);
+		}
+	}
+
+	// Previous lines may have placed glyphs on pages that have since been cleared and possibly reused, such geometry can no longer be
+	// rendered. It is dropped here, the text will be regenerated after the version change.
+	for (int i = 0; i < (int)mesh_list.size(); i++)
+	{
+		TexturedMesh& textured_mesh = mesh_list[i];
+		if (!textured_mesh.mesh.indices.empty() && textured_mesh.texture_generation != atlas.GetPageGeneration(i % num_pages))
+		{
+			textured_mesh.mesh.indices.clear();
+			textured_mesh.mesh.vertices.clear();
+		}
+	}
 
 	for (size_t layer_index = 0; layer_index < layer_configuration.size(); ++layer_index)
 	{
@@ -222,22 +352,9 @@ int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, Texture
 		else
 			layer_colour = layer->GetColour(opacity);
 
-		const int num_textures = layer->GetNumTextures();
-		if (num_textures == 0)
-			continue;
-
-		RMLUI_ASSERT(geometry_index + num_textures <= (int)mesh_list.size());
-
 		line_width = 0;
 		Character prior_character = Character::Null;
 
-		// Set the mesh and textures to the geometries.
-		for (int tex_index = 0; tex_index < num_textures; ++tex_index)
-			mesh_list[geometry_index + tex_index].texture = layer->GetTexture(render_manager, tex_index);
-
-		mesh_list[geometry_index].mesh.indices.reserve(string.size() * 6);
-		mesh_list[geometry_index].mesh.vertices.reserve(string.size() * 4);
-
 		for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
 		{
 			Character character = *it_string;
@@ -261,9 +378,23 @@ int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, Texture
 			prior_character = character;
 		}
 
-		geometry_index += num_textures;
+		// Set the textures of the meshes, and the page generation they were generated for. The textures are retrieved again even for meshes
+		// of previous lines, so that they are uploaded again when new glyphs were added to their pages.
+		for (int page_index = 0; page_index < num_pages; page_index++)
+		{
+			TexturedMesh& textured_mesh = mesh_list[geometry_index + page_index];
+			if (textured_mesh.mesh.indices.empty())
+				continue;
+
+			textured_mesh.texture = atlas.GetTexture(render_manager, page_index);
+			textured_mesh.texture_generation = atlas.GetPageGeneration(page_index);
+		}
+
+		geometry_index += num_pages;
 	}
 
+	FontProvider::EnforceMemoryBudget(this);
+
 	return Math::Max(line_width, 0);
 }
 
@@ -271,11 +402,10 @@ bool FontFaceHandleDefault::UpdateLayersOnDirty()
 {
 	bool result = false;
 
-	// If we are dirty, regenerate all the layers and increment the version
+	// If we are dirty, add the new glyphs to all the layers. The version is incremented by the glyph atlas if any of our pages are cleared.
 	if (is_layers_dirty && base_layer)
 	{
 		is_layers_dirty = false;
-		++version;
 
 		// Regenerate all the layers.
 		// Note: The layer regeneration needs to happen in the order in which the layers were created,
@@ -291,17 +421,67 @@ bool FontFaceHandleDefault::UpdateLayersOnDirty()
 	return result;
 }
 
-int FontFaceHandleDefault::GetVersion() const
+int FontFaceHandleDefault::GetVersion()
 {
+	last_used = FontProvider::GetHandleUseStamp();
 	return version;
 }
 
+void FontFaceHandleDefault::OnGlyphAtlasPageChanged()
+{
+	++version;
+}
+
 bool FontFaceHandleDefault::AppendGlyph(Character character)
 {
-	bool result = FreeType::AppendGlyph(ft_face, metrics.size, character, glyphs);
+	bool result = FreeType::AppendGlyph(ft_face, metrics.size, character, glyphs, !distance_field_face);
+
+	if (result && distance_field_face)
+	{
+		auto it = glyphs.find(character);
+		if (it != glyphs.end())
+			RenderGlyphFromDistanceField(character, it->second);
+	}
+
 	return result;
 }
 
+void FontFaceHandleDefault::RenderGlyphFromDistanceField(Character character, FontGlyph& glyph)
+{
+	// Glyphs with existing bitmaps, such as the replacement character, are kept as they are.
+	if (glyph.bitmap_data)
+		return;
+
+	const FontGlyphDistanceField* distance_field = distance_field_face->GetDistanceField(character);
+	if (!distance_field)
+		return;
+
+	const float scale = distance_field_face->GetDistanceFieldScale(metrics.size);
+	glyph.distance_field = distance_field;
+	glyph.distance_field_scale = scale;
+
+	if (!UsesDistanceFieldsOf(distance_field_face))
+		used_distance_field_faces.push_back(distance_field_face);
+
+	// Cover the scaled glyph with a margin for anti-aliasing, leaving out the spread around it.
+	const Vector2f field_min = Vector2f(distance_field->origin) + Vector2f(distance_field->spread);
+	const Vector2f field_max = Vector2f(distance_field->origin + distance_field->dimensions) - Vector2f(distance_field->spread);
+	const Vector2i bitmap_min = Vector2i(Math::RoundDownToInteger(field_min.x * scale), Math::RoundDownToInteger(field_min.y * scale)) - Vector2i(1);
+	const Vector2i bitmap_max = Vector2i(Math::RoundUpToInteger(field_max.x * scale), Math::RoundUpToInteger(field_max.y * scale)) + Vector2i(1);
+
+	glyph.bearing = Vector2i(bitmap_min.x, -bitmap_min.y);
+	glyph.bitmap_dimensions = Math::Max(bitmap_max - bitmap_min, Vector2i(0));
+	glyph.color_format = ColorFormat::A8;
+
+	const int num_pixels = glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y;
+	if (num_pixels == 0)
+		return;
+
+	glyph.bitmap_owned_data.reset(new byte[num_pixels]);
+	glyph.bitmap_data = glyph.bitmap_owned_data.get();
+	glyph.GenerateCoverage(glyph.bitmap_owned_data.get(), glyph.bitmap_dimensions, glyph.bitmap_dimensions.x, ColorFormat::A8, Vector2i(0), 0.f);
+}
+
 void FontFaceHandleDefault::FillKerningPairCache()
 {
 	if (!has_kerning)
@@ -373,6 +553,7 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 			}
 
 			is_layers_dirty = true;
+			FontProvider::OnResourcesAdded();
 		}
 		else if (look_in_fallback_fonts)
 		{
@@ -383,14 +564,33 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 				if (!fallback_face || fallback_face == this)
 					continue;
 
+				fallback_face->MarkUsed();
 				const FontGlyph* glyph = fallback_face->GetOrAppendGlyph(character, false);
 				if (glyph)
 				{
-					// Insert the new glyph into our own set of glyphs
-					auto pair = glyphs.emplace(character, glyph->WeakCopy());
+					// Insert the new glyph into our own set of glyphs. Its bitmap is copied, as the resources of the fallback face may be
+					// released independently of ours.
+					FontGlyph glyph_copy = glyph->WeakCopy();
+					if (glyph->bitmap_data)
+					{
+						const size_t num_bytes = size_t(glyph->bitmap_dimensions.x * glyph->bitmap_dimensions.y *
+							(glyph->color_format == ColorFormat::RGBA8 ? 4 : 1));
+						glyph_copy.bitmap_owned_data.reset(new byte[num_bytes]);
+						memcpy(glyph_copy.bitmap_owned_data.get(), glyph->bitmap_data, num_bytes);
+						glyph_copy.bitmap_data = glyph_copy.bitmap_owned_data.get();
+					}
+
+					auto pair = glyphs.emplace(character, std::move(glyph_copy));
 					it_glyph = pair.first;
 					if (pair.second)
+					{
+						// The copied glyph may refer to the distance field of the fallback face.
+						if (glyph->distance_field && !UsesDistanceFieldsOf(fallback_face->distance_field_face))
+							used_distance_field_faces.push_back(fallback_face->distance_field_face);
+
 						is_layers_dirty = true;
+						FontProvider::OnResourcesAdded();
+					}
 					break;
 				}
 			}
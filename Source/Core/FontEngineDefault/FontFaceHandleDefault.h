@@ -39,6 +39,7 @@
 
 namespace Rml {
 
+class FontFace;
 class FontFaceLayer;
 
 /**
@@ -50,7 +51,8 @@ public:
 	FontFaceHandleDefault();
 	~FontFaceHandleDefault();
 
-	bool Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs);
+	/// @param[in] distance_field_face The face to render glyphs from distance fields of, or nullptr to rasterize glyphs directly at our size.
+	bool Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs, FontFace* distance_field_face = nullptr);
 
 	const FontMetrics& GetFontMetrics() const;
 
@@ -67,14 +69,6 @@ public:
 	/// @param[in] font_effects The list of font effects to generate the configuration for.
 	/// @return The index to use when generating geometry using this configuration.
 	int GenerateLayerConfiguration(const FontEffectList& font_effects);
-	/// Generates the texture data for a layer (for the texture database).
-	/// @param[out] texture_data The generated texture data.
-	/// @param[out] texture_dimensions The dimensions of the texture.
-	/// @param[in] font_effect The font effect used for the layer.
-	/// @param[in] texture_id The index of the texture within the layer to generate.
-	/// @param[in] handle_version The version of the handle data. Function returns false if out of date.
-	bool GenerateLayerTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect, int texture_id,
-		int handle_version) const;
 
 	/// Generates the geometry required to render a single line of text.
 	/// @param[in] render_manager The render manager responsible for rendering the string.
@@ -89,13 +83,42 @@ public:
 	int GenerateString(RenderManager& render_manager, TexturedMeshList& mesh_list, const String& string, Vector2f position,
 		ColourbPremultiplied colour, float opacity, float letter_spacing, int layer_configuration);
 
-	/// Version is changed whenever the layers are dirtied, requiring regeneration of string geometry.
-	int GetVersion() const;
+	/// Version is changed whenever the glyph atlas pages used by the layers are cleared, or our resources are released, requiring regeneration
+	/// of string geometry. Also marks the handle as used, so that handles of text still being rendered are the last to be released.
+	int GetVersion();
+
+	/// Called by the glyph atlas when a page holding any of our glyphs is cleared.
+	void OnGlyphAtlasPageChanged();
+
+	/// Releases our glyphs, kerning cache, and glyph atlas regions. The handle and its layer configurations remain valid, the resources are
+	/// loaded again the next time the handle is used.
+	void ReleaseResources();
+
+	/// Returns true if our resources are currently loaded.
+	bool IsLoaded() const;
+	/// Returns the estimated memory used by our resources, including our share of the glyph atlas pages, in bytes.
+	size_t GetMemoryUsage() const;
+	/// Returns the stamp of our latest use.
+	uint64_t GetLastUsed() const;
+
+	/// Returns the face we render glyphs from distance fields of, or nullptr if we rasterize glyphs directly.
+	FontFace* GetDistanceFieldFace() const;
+	/// Returns true if any of our glyphs, including those copied from fallback faces, refer to the distance fields of the given face.
+	bool UsesDistanceFieldsOf(const FontFace* face) const;
 
 private:
+	// Generate our glyphs and kerning cache.
+	bool LoadResources(int font_size);
+
+	// Mark the handle as being used, and reload our resources if they have been released.
+	void MarkUsed();
+
 	// Build and append glyph to 'glyphs'
 	bool AppendGlyph(Character character);
 
+	// Generate the bitmap of a glyph from its distance field.
+	void RenderGlyphFromDistanceField(Character character, FontGlyph& glyph);
+
 	// Build a kerning cache for common characters.
 	void FillKerningPairCache();
 
@@ -142,7 +165,10 @@ private:
 
 	bool has_kerning = false;
 	bool is_layers_dirty = false;
+	bool is_loaded = false;
+	bool load_default_glyphs = false;
 	int version = 0;
+	uint64_t last_used = 0;
 
 	// All configurations currently in use on this handle. New configurations will be generated as required.
 	LayerConfigurationList layer_configurations;
@@ -150,6 +176,10 @@ private:
 	FontMetrics metrics;
 
 	FontFaceHandleFreetype ft_face;
+	FontFace* distance_field_face = nullptr;
+
+	// The faces whose distance fields our glyphs refer to, which must be kept until our resources are released.
+	Vector<const FontFace*> used_distance_field_faces;
 };
 
 } // namespace Rml
@@ -27,10 +27,9 @@
  */
 
 #include "FontFaceLayer.h"
-#include "../../../Include/RmlUi/Core/RenderManager.h"
 #include "FontFaceHandleDefault.h"
+#include "FontProvider.h"
 #include <string.h>
-#include <type_traits>
 
 namespace Rml {
 
@@ -43,228 +42,155 @@ FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colou
 
 FontFaceLayer::~FontFaceLayer() {}
 
-bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone, bool clone_glyph_origins)
+bool FontFaceLayer::Generate(FontFaceHandleDefault* handle, FontFaceLayer* _clone, bool _clone_glyph_origins)
 {
-	// Clear the old layout if it exists.
-	{
-		// @performance: We could be much smarter about this, e.g. such as adding new glyphs to the existing texture layout and textures.
-		// Right now we re-generate the whole thing, including textures.
-		texture_layout = TextureLayout{};
+	// Our characters are only kept when regenerating from the same source, new characters are added below. Regions in the glyph atlas are
+	// owned by the handle, and released together with it.
+	if (_clone != clone || _clone_glyph_origins != clone_glyph_origins)
 		character_boxes.clear();
-		textures_owned.clear();
-		textures_ptr = &textures_owned;
-	}
+
+	clone = _clone;
+	clone_glyph_origins = _clone_glyph_origins;
 
 	const FontGlyphMap& glyphs = handle->GetGlyphs();
+	character_boxes.reserve(glyphs.size());
 
-	// Generate the new layout.
-	if (clone)
+	for (auto& pair : glyphs)
 	{
-		// Clone the geometry and textures from the clone layer.
-		character_boxes = clone->character_boxes;
+		if (character_boxes.find(pair.first) == character_boxes.end())
+			UseCharacter(handle, pair.first, pair.second);
+	}
 
-		// Point our textures to the cloned layer's textures.
-		textures_ptr = clone->textures_ptr;
+	return true;
+}
 
-		// Request the effect (if we have one) and adjust the origins as appropriate.
-		if (effect && !clone_glyph_origins)
-		{
-			for (auto& pair : glyphs)
-			{
-				Character character = pair.first;
-				const FontGlyph& glyph = pair.second;
-
-				auto it = character_boxes.find(character);
-				if (it == character_boxes.end())
-				{
-					// This can happen if the layers have been dirtied in FontHandleDefault. We will
-					// probably be regenerated soon, just skip the character for now.
-					continue;
-				}
-
-				TextureBox& box = it->second;
-
-				Vector2i glyph_origin = Vector2i(box.origin);
-				Vector2i glyph_dimensions = Vector2i(box.dimensions);
-
-				if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
-					box.origin = Vector2f(glyph_origin);
-				else
-					box.texture_index = -1;
-			}
-		}
-	}
-	else
+bool FontFaceLayer::UseCharacter(FontFaceHandleDefault* handle, Character character, const FontGlyph& glyph)
+{
+	auto it = character_boxes.find(character);
+
+	if (clone)
 	{
-		// Initialise the texture layout for the glyphs.
-		character_boxes.reserve(glyphs.size());
-		for (auto& pair : glyphs)
-		{
-			Character character = pair.first;
-			const FontGlyph& glyph = pair.second;
+		if (!clone->UseCharacter(handle, character, glyph))
+			return false;
 
-			Vector2i glyph_origin(0, 0);
-			Vector2i glyph_dimensions = glyph.bitmap_dimensions;
+		auto it_clone = clone->character_boxes.find(character);
+		RMLUI_ASSERT(it_clone != clone->character_boxes.end());
 
-			// Adjust glyph origin / dimensions for the font effect.
-			if (effect)
-			{
-				if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
-					continue;
-			}
+		// Our character is still valid as long as it refers to the same region as the cloned character.
+		if (it == character_boxes.end() || it->second.entry != it_clone->second.entry)
+			CloneCharacter(character, it_clone->second, glyph);
 
-			TextureBox box;
-			box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
-			box.dimensions = Vector2f(glyph_dimensions);
+		return true;
+	}
 
-			RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
+	if (it != character_boxes.end())
+	{
+		const FontGlyphAtlas::Entry entry = it->second.entry;
+		if (entry.page_index < 0 || FontProvider::GetGlyphAtlas().Use(entry))
+			return true;
 
-			character_boxes[character] = box;
+		// The character's page has been cleared, but it is evidently still in use. Don't clear any other pages to make room for it.
+		return AddCharacter(handle, character, glyph, false);
+	}
 
-			// Add the character's dimensions into the texture layout engine.
-			texture_layout.AddRectangle((int)character, glyph_dimensions);
-		}
+	return AddCharacter(handle, character, glyph, true);
+}
 
-		constexpr int max_texture_dimensions = 1024;
+bool FontFaceLayer::AddCharacter(FontFaceHandleDefault* handle, Character character, const FontGlyph& glyph, bool allow_page_reuse)
+{
+	Vector2i glyph_origin(0, 0);
+	Vector2i glyph_dimensions = glyph.bitmap_dimensions;
 
-		// Generate the texture layout; this will position the glyph rectangles efficiently and
-		// allocate the texture data ready for writing.
-		if (!texture_layout.GenerateLayout(max_texture_dimensions))
+	// Adjust glyph origin / dimensions for the font effect.
+	if (effect)
+	{
+		if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
 			return false;
+	}
 
-		// Iterate over each rectangle in the layout, copying the glyph data into the rectangle as
-		// appropriate and generating geometry.
-		for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
-		{
-			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-			const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
-			Character character = (Character)rectangle.GetId();
-			RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
-			TextureBox& box = character_boxes[character];
-
-			// Set the character's texture index.
-			box.texture_index = rectangle.GetTextureIndex();
-
-			// Generate the character's texture coordinates.
-			box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
-			box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
-			box.texcoords[1].x = float(rectangle.GetPosition().x + rectangle.GetDimensions().x) / float(texture.GetDimensions().x);
-			box.texcoords[1].y = float(rectangle.GetPosition().y + rectangle.GetDimensions().y) / float(texture.GetDimensions().y);
-		}
+	TextureBox box;
+	box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
+	box.dimensions = Vector2f(glyph_dimensions);
 
-		const FontEffect* effect_ptr = effect.get();
-		const int handle_version = handle->GetVersion();
+	RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
 
-		// Generate the textures.
-		for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
-		{
-			const int texture_id = i;
-
-			CallbackTextureFunction texture_callback = [handle, effect_ptr, texture_id, handle_version](
-														   const CallbackTextureInterface& texture_interface) -> bool {
-				Vector2i dimensions;
-				Vector<byte> data;
-				if (!handle->GenerateLayerTexture(data, dimensions, effect_ptr, texture_id, handle_version) || data.empty())
-					return false;
-				if (!texture_interface.GenerateTexture(data, dimensions))
-					return false;
-				return true;
-			};
-
-			static_assert(std::is_nothrow_move_constructible<CallbackTextureSource>::value,
-				"CallbackTextureSource must be nothrow move constructible so that it can be placed in the vector below.");
-
-			textures_owned.emplace_back(std::move(texture_callback));
-		}
+	// Empty glyphs don't need any space in the atlas, they are not rendered.
+	if (glyph_dimensions.x == 0 || glyph_dimensions.y == 0)
+	{
+		character_boxes[character] = box;
+		return true;
 	}
 
-	return true;
-}
+	// Glyphs are copied as they are, while font effects generate colored textures.
+	const ColorFormat color_format = (effect ? ColorFormat::RGBA8 : glyph.color_format);
 
-bool FontFaceLayer::GenerateTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs)
-{
-	if (texture_id < 0 || texture_id > texture_layout.GetNumTextures())
+	FontGlyphAtlas::Region region;
+	if (!FontProvider::GetGlyphAtlas().Allocate(handle, glyph_dimensions, color_format, allow_page_reuse, region))
 		return false;
 
-	// Generate the texture data.
-	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture();
-	texture_dimensions = texture_layout.GetTexture(texture_id).GetDimensions();
+	box.entry = region.entry;
+	box.texcoords[0] = region.texcoords[0];
+	box.texcoords[1] = region.texcoords[1];
 
-	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
+	if (effect == nullptr)
 	{
-		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-		Character character = (Character)rectangle.GetId();
-		RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
-
-		TextureBox& box = character_boxes[character];
-
-		if (box.texture_index != texture_id)
-			continue;
-
-		auto it = glyphs.find((Character)rectangle.GetId());
-		if (it == glyphs.end())
-			continue;
-
-		const FontGlyph& glyph = it->second;
-
-		if (effect == nullptr)
+		// Copy the glyph's bitmap data into its allocated region, which has the same color format.
+		if (glyph.bitmap_data)
 		{
-			// Copy the glyph's bitmap data into its allocated texture.
-			if (glyph.bitmap_data)
+			byte* destination = region.data;
+			const byte* source = glyph.bitmap_data;
+			const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+
+			for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
 			{
-				byte* destination = rectangle.GetTextureData();
-				const byte* source = glyph.bitmap_data;
-				const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
-
-				for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
-				{
-					switch (glyph.color_format)
-					{
-					case ColorFormat::A8:
-					{
-						// We use premultiplied alpha, so copy the alpha into all four channels.
-						for (int k = 0; k < num_bytes_per_line; ++k)
-							for (int c = 0; c < 4; ++c)
-								destination[k * 4 + c] = source[k];
-					}
-					break;
-					case ColorFormat::RGBA8:
-					{
-						memcpy(destination, source, num_bytes_per_line);
-					}
-					break;
-					}
-
-					destination += rectangle.GetTextureStride();
-					source += num_bytes_per_line;
-				}
+				memcpy(destination, source, num_bytes_per_line);
+				destination += region.stride;
+				source += num_bytes_per_line;
 			}
 		}
-		else
-		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(box.dimensions), rectangle.GetTextureStride(), glyph);
-		}
+	}
+	else
+	{
+		effect->GenerateGlyphTexture(region.data, glyph_dimensions, region.stride, glyph);
 	}
 
+	character_boxes[character] = box;
+
 	return true;
 }
 
-const FontEffect* FontFaceLayer::GetFontEffect() const
+void FontFaceLayer::CloneCharacter(Character character, const TextureBox& clone_box, const FontGlyph& glyph)
 {
-	return effect.get();
+	TextureBox box = clone_box;
+
+	// Request the effect (if we have one) and adjust the origins as appropriate.
+	if (effect && !clone_glyph_origins)
+	{
+		Vector2i glyph_origin = Vector2i(box.origin);
+		Vector2i glyph_dimensions = Vector2i(box.dimensions);
+
+		if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+			box.origin = Vector2f(glyph_origin);
+		else
+			box.entry = FontGlyphAtlas::Entry{};
+	}
+
+	character_boxes[character] = box;
 }
 
-Texture FontFaceLayer::GetTexture(RenderManager& render_manager, int index)
+void FontFaceLayer::ReleaseCharacters()
 {
-	RMLUI_ASSERT(index >= 0);
-	RMLUI_ASSERT(index < GetNumTextures());
+	CharacterMap().swap(character_boxes);
+}
 
-	return (*textures_ptr)[index].GetTexture(render_manager);
+size_t FontFaceLayer::GetMemoryUsage() const
+{
+	return character_boxes.size() * sizeof(CharacterMap::value_type);
 }
 
-int FontFaceLayer::GetNumTextures() const
+const FontEffect* FontFaceLayer::GetFontEffect() const
 {
-	return (int)textures_ptr->size();
+	return effect.get();
 }
 
 ColourbPremultiplied FontFaceLayer::GetColour(float opacity) const
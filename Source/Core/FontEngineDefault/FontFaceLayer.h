@@ -29,21 +29,24 @@
 #ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTFACELAYER_H
 #define RMLUI_CORE_FONTENGINEDEFAULT_FONTFACELAYER_H
 
-#include "../../../Include/RmlUi/Core/CallbackTexture.h"
 #include "../../../Include/RmlUi/Core/FontGlyph.h"
-#include "../../../Include/RmlUi/Core/Geometry.h"
+#include "../../../Include/RmlUi/Core/Mesh.h"
 #include "../../../Include/RmlUi/Core/MeshUtilities.h"
-#include "../TextureLayout.h"
+#include "FontGlyphAtlas.h"
 
 namespace Rml {
 
 class FontEffect;
 class FontFaceHandleDefault;
+class RenderManager;
 
 /**
     A textured layer stored as part of a font face handle. Each handle will have at least a base
     layer for the standard font. Further layers can be added to allow rendering of text effects.
 
+    The glyphs of the layer are rendered into the shared glyph atlas. Layers of effects which don't
+    need unique textures refer to the glyphs of the layer they are cloned from.
+
     @author Peter Curry
  */
 
@@ -52,22 +55,23 @@ public:
 	FontFaceLayer(const SharedPtr<const FontEffect>& _effect);
 	~FontFaceLayer();
 
-	/// Generates or re-generates the character and texture data for the layer.
+	/// Generates or re-generates the character data for the layer, adding any glyphs of the handle not yet part of the layer.
 	/// @param[in] handle The handle generating this layer.
 	/// @param[in] clone The layer to optionally clone geometry and texture data from.
 	/// @param[in] clone_glyph_origins True to keep the character origins from the cloned layer, false to generate new ones.
 	/// @return True if the layer was generated successfully, false if not.
-	bool Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
+	bool Generate(FontFaceHandleDefault* handle, FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
 
-	/// Generates the texture data for a layer (for the texture database).
-	/// @param[out] texture_data The generated texture data.
-	/// @param[out] texture_dimensions The dimensions of the texture.
-	/// @param[in] texture_id The index of the texture within the layer to generate.
-	/// @param[in] glyphs The glyphs required by the font face handle.
-	bool GenerateTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs);
+	/// Ensures that the character is ready to be rendered from the glyph atlas, rendering it again if its atlas page has been cleared.
+	/// All the characters of a string should be used before generating its geometry, as using a character may clear atlas pages.
+	/// @param[in] handle The handle owning this layer.
+	/// @param[in] character The character to use.
+	/// @param[in] glyph The glyph of the character.
+	/// @return True if the character can be rendered by this layer.
+	bool UseCharacter(FontFaceHandleDefault* handle, Character character, const FontGlyph& glyph);
 
 	/// Generates the geometry required to render a single character.
-	/// @param[out] mesh_list An array of meshes this layer will write to. It must be at least as big as the number of textures in this layer.
+	/// @param[out] mesh_list An array of meshes this layer will write to, one for each page of the glyph atlas.
 	/// @param[in] character_code The character to generate geometry for.
 	/// @param[in] position The position of the baseline.
 	/// @param[in] colour The colour of the string.
@@ -80,22 +84,23 @@ public:
 
 		const TextureBox& box = it->second;
 
-		if (box.texture_index < 0)
+		if (box.entry.page_index < 0)
 			return;
 
 		// Generate the geometry for the character.
-		Mesh& mesh = mesh_list[box.texture_index].mesh;
+		Mesh& mesh = mesh_list[box.entry.page_index].mesh;
 		MeshUtilities::GenerateQuad(mesh, (position + box.origin).Round(), box.dimensions, colour, box.texcoords[0], box.texcoords[1]);
 	}
 
+	/// Removes all characters from the layer, their atlas regions must be released separately by the handle.
+	void ReleaseCharacters();
+
+	/// Returns the memory used by the layer's characters, in bytes. Their atlas regions are accounted for by the glyph atlas.
+	size_t GetMemoryUsage() const;
+
 	/// Returns the effect used to generate the layer.
 	const FontEffect* GetFontEffect() const;
 
-	/// Returns one of the layer's textures.
-	Texture GetTexture(RenderManager& render_manager, int index);
-	/// Returns the number of textures employed by this layer.
-	int GetNumTextures() const;
-
 	/// Returns the layer's colour after applying the given opacity.
 	ColourbPremultiplied GetColour(float opacity) const;
 
@@ -108,19 +113,22 @@ private:
 		// The texture coordinates for the character's geometry.
 		Vector2f texcoords[2];
 
-		// The texture this character renders from.
-		int texture_index = -1;
+		// The atlas region this character renders from, no geometry is generated if it has no page.
+		FontGlyphAtlas::Entry entry;
 	};
 
 	using CharacterMap = UnorderedMap<Character, TextureBox>;
-	using TextureList = Vector<CallbackTextureSource>;
+
+	// Renders the character into a new region of the glyph atlas.
+	bool AddCharacter(FontFaceHandleDefault* handle, Character character, const FontGlyph& glyph, bool allow_page_reuse);
+	// Copies the character from the cloned layer, adjusting its origin for our effect as necessary.
+	void CloneCharacter(Character character, const TextureBox& clone_box, const FontGlyph& glyph);
 
 	SharedPtr<const FontEffect> effect;
 
-	TextureList textures_owned;
-	TextureList* textures_ptr = &textures_owned;
+	FontFaceLayer* clone = nullptr;
+	bool clone_glyph_origins = false;
 
-	TextureLayout texture_layout;
 	CharacterMap character_boxes;
 	Colourb colour;
 };
@@ -0,0 +1,367 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontGlyphAtlas.h"
+#include "../../../Include/RmlUi/Core/Log.h"
+#include "../RenderManagerAccess.h"
+#include "FontFaceHandleDefault.h"
+#include "FontProvider.h"
+#include <algorithm>
+#include <string.h>
+
+namespace Rml {
+
+// Glyphs are bucketed by height, each bucket spanning twice the height of the previous one.
+static constexpr int glyph_bucket_first_height = 16;
+static constexpr int glyph_bucket_count = 5;
+
+// The width and height of the first page of each bucket.
+static constexpr int initial_page_size = 128;
+
+FontGlyphAtlas::FontGlyphAtlas(int max_page_size, int pixel_budget) : max_page_size(max_page_size), pixel_budget(pixel_budget)
+{
+	RMLUI_ASSERT(max_page_size > 0 && pixel_budget > 0);
+}
+
+FontGlyphAtlas::~FontGlyphAtlas()
+{
+	RMLUI_ASSERTMSG(GetNumActivePages() == 0, "All font face handles should be released before the glyph atlas.");
+}
+
+bool FontGlyphAtlas::Allocate(FontFaceHandleDefault* owner, Vector2i dimensions, ColorFormat color_format, bool allow_page_reuse, Region& region)
+{
+	RMLUI_ASSERT(owner && dimensions.x >= 0 && dimensions.y >= 0);
+
+	// Rectangles are placed with a one pixel border in the page.
+	if (dimensions.x + 2 > max_page_size || dimensions.y + 2 > max_page_size)
+		return false;
+
+	const int bucket = GetBucket(dimensions.y);
+
+	for (int i = 0; i < (int)pages.size(); i++)
+	{
+		const Page& page = pages[i];
+		if (page.active && page.bucket == bucket && page.color_format == color_format && AllocateInPage(i, owner, dimensions, region))
+			return true;
+	}
+
+	const Vector2i page_dimensions = GetNewPageDimensions(GetBucketNumPixels(bucket, color_format) + dimensions.x * dimensions.y, dimensions);
+	const int page_index = FindFreePage(page_dimensions, allow_page_reuse);
+	ActivatePage(page_index, bucket, color_format, page_dimensions);
+
+	return AllocateInPage(page_index, owner, dimensions, region);
+}
+
+bool FontGlyphAtlas::Use(Entry entry)
+{
+	if (entry.page_index < 0 || entry.page_index >= (int)pages.size())
+		return false;
+
+	Page& page = pages[entry.page_index];
+	if (!page.active || page.generation != entry.page_generation)
+		return false;
+
+	page.last_used = clock;
+	return true;
+}
+
+void FontGlyphAtlas::ReleaseOwner(FontFaceHandleDefault* owner)
+{
+	for (Page& page : pages)
+	{
+		if (!page.active)
+			continue;
+
+		auto it = std::find_if(page.owners.begin(), page.owners.end(), [owner](const PageOwner& page_owner) { return page_owner.handle == owner; });
+		if (it == page.owners.end())
+			continue;
+
+		page.owners.erase(it);
+		if (page.owners.empty())
+			ClearPage(page);
+	}
+}
+
+void FontGlyphAtlas::Tick()
+{
+	clock += 1;
+}
+
+Texture FontGlyphAtlas::GetTexture(RenderManager& render_manager, int page_index)
+{
+	RMLUI_ASSERT(GetPageGeneration(page_index) >= 0);
+	Page& page = pages[page_index];
+
+	const Texture texture = page.texture.GetTexture(render_manager);
+
+	// New glyphs may have been written to the page since its texture was generated. Then release the generated texture, so that it is
+	// uploaded again with the new glyphs the next time it is rendered. The texture itself remains valid for existing geometry.
+	auto it = page.texture_versions.find(&render_manager);
+	if (it == page.texture_versions.end())
+	{
+		page.texture_versions.emplace(&render_manager, page.data_version);
+	}
+	else if (it->second != page.data_version)
+	{
+		RenderManagerAccess::ReleaseTextureHandle(&render_manager, texture);
+		it->second = page.data_version;
+	}
+
+	return texture;
+}
+
+int FontGlyphAtlas::GetPageGeneration(int page_index) const
+{
+	if (page_index < 0 || page_index >= (int)pages.size() || !pages[page_index].active)
+		return -1;
+	return pages[page_index].generation;
+}
+
+bool FontGlyphAtlas::ClearOversizedPages()
+{
+	bool result = false;
+
+	for (Page& page : pages)
+	{
+		// Pages used during the current or previous tick may have glyphs in geometry currently being generated.
+		if (!page.active || page.last_used + 1 >= clock)
+			continue;
+
+		// Only clear the page if a new page for its bucket would be at most half its size, otherwise we could end up clearing the new page too.
+		const Vector2i new_page_dimensions = GetNewPageDimensions(GetBucketNumPixels(page.bucket, page.color_format), Vector2i(0));
+		if (2 * new_page_dimensions.x * new_page_dimensions.y > page.dimensions.x * page.dimensions.y)
+			continue;
+
+		for (const PageOwner& page_owner : page.owners)
+			page_owner.handle->OnGlyphAtlasPageChanged();
+		ClearPage(page);
+		result = true;
+	}
+
+	return result;
+}
+
+size_t FontGlyphAtlas::GetOwnerMemoryUsage(const FontFaceHandleDefault* owner) const
+{
+	size_t result = 0;
+	for (const Page& page : pages)
+	{
+		if (!page.active)
+			continue;
+
+		auto it = std::find_if(page.owners.begin(), page.owners.end(), [owner](const PageOwner& page_owner) { return page_owner.handle == owner; });
+		if (it == page.owners.end())
+			continue;
+
+		size_t page_num_pixels = 0;
+		for (const PageOwner& page_owner : page.owners)
+			page_num_pixels += size_t(page_owner.num_pixels);
+
+		// Textures are uploaded in RGBA format, once for each render manager they are rendered with.
+		const size_t texture_size = size_t(page.dimensions.x * page.dimensions.y * 4) * page.texture_versions.size();
+		const size_t page_size = page.data.size() + texture_size;
+		if (page_num_pixels > 0)
+			result += page_size * size_t(it->num_pixels) / page_num_pixels;
+		else
+			result += page_size / page.owners.size();
+	}
+	return result;
+}
+
+int FontGlyphAtlas::GetNumPageSlots() const
+{
+	return (int)pages.size();
+}
+
+int FontGlyphAtlas::GetNumActivePages() const
+{
+	return (int)std::count_if(pages.begin(), pages.end(), [](const Page& page) { return page.active; });
+}
+
+int FontGlyphAtlas::GetBucket(int glyph_height)
+{
+	int bucket = 0;
+	for (int bucket_height = glyph_bucket_first_height; glyph_height > bucket_height && bucket < glyph_bucket_count - 1; bucket_height *= 2)
+		bucket += 1;
+	return bucket;
+}
+
+int FontGlyphAtlas::GetBucketNumPixels(int bucket, ColorFormat color_format) const
+{
+	int result = 0;
+	for (const Page& page : pages)
+	{
+		if (!page.active || page.bucket != bucket || page.color_format != color_format)
+			continue;
+
+		for (const PageOwner& page_owner : page.owners)
+			result += page_owner.num_pixels;
+	}
+	return result;
+}
+
+Vector2i FontGlyphAtlas::GetNewPageDimensions(int bucket_num_pixels, Vector2i glyph_dimensions) const
+{
+	// Make room for twice the area of the glyphs in the bucket, alternating between doubling the width and the height.
+	Vector2i page_dimensions(initial_page_size);
+	while (page_dimensions.x * page_dimensions.y < 2 * bucket_num_pixels && page_dimensions.y < max_page_size)
+	{
+		if (page_dimensions.x == page_dimensions.y)
+			page_dimensions.x *= 2;
+		else
+			page_dimensions.y *= 2;
+	}
+
+	while (page_dimensions.x < glyph_dimensions.x + 2)
+		page_dimensions.x *= 2;
+	while (page_dimensions.y < glyph_dimensions.y + 2)
+		page_dimensions.y *= 2;
+
+	return Math::Min(page_dimensions, Vector2i(max_page_size));
+}
+
+bool FontGlyphAtlas::AllocateInPage(int page_index, FontFaceHandleDefault* owner, Vector2i dimensions, Region& region)
+{
+	Page& page = pages[page_index];
+
+	page.layout.AddRectangle(page.layout.GetNumRectangles(), dimensions);
+	if (!page.layout.ExtendLayout())
+	{
+		page.layout.RemoveUnplacedRectangles();
+		return false;
+	}
+
+	// Only a single rectangle was added, and the placed rectangles keep their order, thus the new one is the last one.
+	TextureLayoutRectangle& rectangle = page.layout.GetRectangle(page.layout.GetNumRectangles() - 1);
+	const Vector2i position = rectangle.GetPosition();
+	const int bytes_per_pixel = (page.color_format == ColorFormat::RGBA8 ? 4 : 1);
+
+	region.entry = Entry{page_index, page.generation};
+	region.color_format = page.color_format;
+	region.stride = page.dimensions.x * bytes_per_pixel;
+	region.data = page.data.data() + position.y * region.stride + position.x * bytes_per_pixel;
+	region.texcoords[0] = Vector2f(position) / Vector2f(page.dimensions);
+	region.texcoords[1] = Vector2f(position + dimensions) / Vector2f(page.dimensions);
+
+	page.data_version += 1;
+	page.last_used = clock;
+	auto it = std::find_if(page.owners.begin(), page.owners.end(), [owner](const PageOwner& page_owner) { return page_owner.handle == owner; });
+	if (it == page.owners.end())
+		page.owners.push_back(PageOwner{owner, dimensions.x * dimensions.y});
+	else
+		it->num_pixels += dimensions.x * dimensions.y;
+
+	return true;
+}
+
+int FontGlyphAtlas::FindFreePage(Vector2i dimensions, bool allow_page_reuse)
+{
+	int num_active_pixels = 0;
+	for (const Page& page : pages)
+	{
+		if (page.active)
+			num_active_pixels += page.dimensions.x * page.dimensions.y;
+	}
+
+	while (allow_page_reuse && num_active_pixels + dimensions.x * dimensions.y > pixel_budget)
+	{
+		// Pages used during the current or previous tick may have glyphs in geometry currently being generated.
+		int least_recently_used_index = -1;
+		for (int i = 0; i < (int)pages.size(); i++)
+		{
+			const Page& page = pages[i];
+			if (page.active && page.last_used + 1 < clock &&
+				(least_recently_used_index < 0 || page.last_used < pages[least_recently_used_index].last_used))
+				least_recently_used_index = i;
+		}
+
+		if (least_recently_used_index < 0)
+			break;
+
+		Page& page = pages[least_recently_used_index];
+		num_active_pixels -= page.dimensions.x * page.dimensions.y;
+		for (const PageOwner& page_owner : page.owners)
+			page_owner.handle->OnGlyphAtlasPageChanged();
+		ClearPage(page);
+	}
+
+	for (int i = 0; i < (int)pages.size(); i++)
+	{
+		if (!pages[i].active)
+			return i;
+	}
+
+	pages.emplace_back();
+	return (int)pages.size() - 1;
+}
+
+void FontGlyphAtlas::ActivatePage(int page_index, int bucket, ColorFormat color_format, Vector2i dimensions)
+{
+	Page& page = pages[page_index];
+	RMLUI_ASSERT(!page.active);
+
+	page.active = true;
+	page.bucket = bucket;
+	page.color_format = color_format;
+	page.dimensions = dimensions;
+	page.last_used = clock;
+
+	page.layout = TextureLayout{};
+	page.layout.AddTexture(dimensions);
+	page.data.resize(size_t(dimensions.x * dimensions.y * (color_format == ColorFormat::RGBA8 ? 4 : 1)), 0);
+	FontProvider::OnResourcesAdded();
+
+	page.texture = CallbackTextureSource([this, page_index](const CallbackTextureInterface& texture_interface) -> bool {
+		// Called during rendering, while glyphs may be added to the page from another thread.
+		std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
+		const Page& page = pages[page_index];
+		if (page.color_format == ColorFormat::RGBA8)
+			return texture_interface.GenerateTexture(page.data, page.dimensions);
+
+		// Textures are always submitted as RGBA. We use premultiplied alpha, so copy the coverage into all four channels.
+		Vector<byte> rgba_data(page.data.size() * 4);
+		for (size_t i = 0; i < page.data.size(); i++)
+			memset(&rgba_data[i * 4], page.data[i], 4);
+
+		return texture_interface.GenerateTexture(rgba_data, page.dimensions);
+	});
+}
+
+void FontGlyphAtlas::ClearPage(Page& page)
+{
+	page.active = false;
+	page.generation += 1;
+
+	page.layout = TextureLayout{};
+	Vector<byte>().swap(page.data);
+	page.texture = CallbackTextureSource{};
+	page.texture_versions.clear();
+	page.owners.clear();
+}
+
+} // namespace Rml
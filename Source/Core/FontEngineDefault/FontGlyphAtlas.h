@@ -0,0 +1,176 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTGLYPHATLAS_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTGLYPHATLAS_H
+
+#include "../../../Include/RmlUi/Core/CallbackTexture.h"
+#include "../../../Include/RmlUi/Core/Texture.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+#include "../TextureLayout.h"
+
+namespace Rml {
+
+class FontFaceHandleDefault;
+class RenderManager;
+
+/**
+    The glyph atlas packs the rendered glyphs of all font face handles and their layers into a small number of shared texture pages.
+
+    Each page only holds glyphs within the same height bucket and color format, so that they can be tightly packed into the rows of the page.
+    Pages are sized by demand: the first page of a bucket is small, and each additional page of the bucket has twice the area of the glyphs
+    currently held by the bucket, up to the maximum page size. Glyphs without colors are stored with a single channel, and only expanded to
+    RGBA for the texture.
+
+    Each page keeps its texture for as long as it holds glyphs, new glyphs are added by uploading the page again. Thus, regions remain valid
+    until their page is cleared. When a new page is needed after the pixel budget has been reached, the least recently used pages are cleared
+    and reused. Handles owning glyphs on a cleared page are notified, so that their string geometry can be regenerated.
+
+    The budget is a soft limit. Glyphs rendered again after their page was cleared are placed on new pages instead of clearing further pages,
+    as they are evidently still in use. This avoids a cascade of text regenerations when all the visible glyphs don't fit within the budget.
+ */
+
+class FontGlyphAtlas : NonCopyMoveable {
+public:
+	/// Refers to a glyph region in the atlas. The region remains valid until its page is cleared.
+	struct Entry {
+		int page_index = -1;
+		int page_generation = 0;
+
+		bool operator==(const Entry& other) const { return page_index == other.page_index && page_generation == other.page_generation; }
+		bool operator!=(const Entry& other) const { return !(*this == other); }
+	};
+
+	/// A newly allocated glyph region.
+	struct Region {
+		Entry entry;
+		// The top-left corner of the region in the page's pixel data.
+		byte* data = nullptr;
+		// The stride of the page's pixel data, in bytes.
+		int stride = 0;
+		// The format of the page's pixel data, either a single coverage channel or premultiplied RGBA.
+		ColorFormat color_format = ColorFormat::A8;
+		// The texture coordinates of the region's top-left and bottom-right corners.
+		Vector2f texcoords[2];
+	};
+
+	/// @param[in] max_page_size The maximum width and height of each page, in pixels.
+	/// @param[in] pixel_budget The total number of pixels of all pages, after which the least recently used pages are reused for new glyphs.
+	FontGlyphAtlas(int max_page_size, int pixel_budget);
+	~FontGlyphAtlas();
+
+	/// Allocates a region of the atlas for a glyph. The region is initialized to transparent black, and should be written to by the caller.
+	/// @param[in] owner The handle owning the glyph, it will be notified whenever the region's page is cleared.
+	/// @param[in] dimensions The dimensions of the glyph.
+	/// @param[in] color_format The format of the glyph's pixel data.
+	/// @param[in] allow_page_reuse True to allow clearing the least recently used pages if the budget has been reached, otherwise a new page
+	/// is added when needed.
+	/// @param[out] region The allocated region.
+	/// @return True on success, false if the glyph does not fit in a page.
+	bool Allocate(FontFaceHandleDefault* owner, Vector2i dimensions, ColorFormat color_format, bool allow_page_reuse, Region& region);
+
+	/// Marks the page of the given entry as used, keeping it from being cleared until the tick after next.
+	/// @return True if the entry is still valid, false if its page has been cleared since it was allocated.
+	bool Use(Entry entry);
+
+	/// Releases all regions owned by the given handle. Pages without any remaining owners are freed.
+	void ReleaseOwner(FontFaceHandleDefault* owner);
+
+	/// Advances the usage clock, called once for every render. Pages used since the previous tick are not cleared to make room for new glyphs.
+	/// Neither are pages used during the previous tick, as other contexts may not have finished rendering them when the clock is advanced.
+	void Tick();
+
+	/// Returns the texture of the given page, to be rendered with the given render manager. The texture is uploaded again if glyphs have been
+	/// added since it was last retrieved for the render manager.
+	Texture GetTexture(RenderManager& render_manager, int page_index);
+	/// Returns the generation of the given page, which is changed whenever the page is cleared, or -1 if the page currently holds no glyphs.
+	int GetPageGeneration(int page_index) const;
+
+	/// Clears pages which are much larger than their bucket currently needs, such as after most of their owners were released. Pages used since
+	/// the previous tick are kept. Owners of cleared pages are notified, their glyphs will be placed on new pages sized by the current demand.
+	/// @return True if any pages were cleared.
+	bool ClearOversizedPages();
+
+	/// Returns the memory used by the pages holding glyphs of the given owner, including their pixel data and their textures. The memory of
+	/// each page is divided between its owners by the area of their glyphs.
+	size_t GetOwnerMemoryUsage(const FontFaceHandleDefault* owner) const;
+
+	/// Returns the number of page slots, all page indices are below this number.
+	int GetNumPageSlots() const;
+	/// Returns the number of pages currently holding glyphs.
+	int GetNumActivePages() const;
+
+private:
+	struct PageOwner {
+		FontFaceHandleDefault* handle;
+		// The total area of the owner's glyphs on the page.
+		int num_pixels;
+	};
+
+	struct Page {
+		bool active = false;
+		int generation = 0;
+		int bucket = 0;
+		ColorFormat color_format = ColorFormat::A8;
+		Vector2i dimensions;
+		int last_used = 0;
+		TextureLayout layout;
+		Vector<byte> data;
+		// Incremented whenever glyphs are added to the page, compared against the version last uploaded for each render manager.
+		int data_version = 0;
+		SmallUnorderedMap<RenderManager*, int> texture_versions;
+		CallbackTextureSource texture;
+		Vector<PageOwner> owners;
+	};
+
+	// Returns the height bucket of a glyph, only glyphs of the same bucket are placed on the same page.
+	static int GetBucket(int glyph_height);
+
+	// Returns the total area of the glyphs in the given bucket, counting only the glyphs of current owners.
+	int GetBucketNumPixels(int bucket, ColorFormat color_format) const;
+	// Returns the dimensions of a new page for a bucket with the given glyph area, also fitting the given glyph. Pages left mostly empty by
+	// released owners don't count towards the glyph area, thus they don't cause new pages to grow.
+	Vector2i GetNewPageDimensions(int bucket_num_pixels, Vector2i glyph_dimensions) const;
+
+	bool AllocateInPage(int page_index, FontFaceHandleDefault* owner, Vector2i dimensions, Region& region);
+
+	// Returns the index of a page slot ready to be activated, after clearing the least recently used pages as needed to fit the new page.
+	int FindFreePage(Vector2i dimensions, bool allow_page_reuse);
+
+	void ActivatePage(int page_index, int bucket, ColorFormat color_format, Vector2i dimensions);
+	void ClearPage(Page& page);
+
+	int max_page_size;
+	int pixel_budget;
+	int clock = 1;
+
+	Vector<Page> pages;
+};
+
+} // namespace Rml
+#endif
@@ -34,6 +34,7 @@
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
 #include "../ComputeProperty.h"
 #include "FontFace.h"
+#include "FontFaceHandleDefault.h"
 #include "FontFamily.h"
 #include "FreeTypeInterface.h"
 #include <algorithm>
@@ -42,7 +43,14 @@ namespace Rml {
 
 static FontProvider* g_font_provider = nullptr;
 
-FontProvider::FontProvider()
+// Not stored in the provider, so that they can be set before initialization.
+static int g_distance_field_threshold = 0;
+static size_t g_memory_budget = 0;
+
+static constexpr int glyph_atlas_max_page_size = 1024;
+static constexpr int glyph_atlas_pixel_budget = 8 * 1024 * 1024;
+
+FontProvider::FontProvider() : glyph_atlas(glyph_atlas_max_page_size, glyph_atlas_pixel_budget)
 {
 	RMLUI_ASSERT(!g_font_provider);
 }
@@ -69,6 +77,13 @@ void FontProvider::Shutdown()
 	FreeType::Shutdown();
 }
 
+std::recursive_mutex& FontProvider::GetMutex()
+{
+	// Not stored in the provider, so that it outlives the provider and can be locked during initialization and shutdown.
+	static std::recursive_mutex mutex;
+	return mutex;
+}
+
 FontProvider& FontProvider::Get()
 {
 	RMLUI_ASSERT(g_font_provider);
@@ -85,7 +100,12 @@ FontFaceHandleDefault* FontProvider::GetFontFaceHandle(const String& family, Sty
 	if (it == families.end())
 		return nullptr;
 
-	return it->second->GetFaceHandle(style, weight, size);
+	FontFaceHandleDefault* handle = it->second->GetFaceHandle(style, weight, size);
+
+	// Handles may be added during text generation, such as for fallback fonts, thus the budget is also enforced here where no handle is in use.
+	EnforceMemoryBudget(handle);
+
+	return handle;
 }
 
 int FontProvider::CountFallbackFontFaces()
@@ -110,6 +130,177 @@ void FontProvider::ReleaseFontResources()
 		name_family.second->ReleaseFontResources();
 }
 
+FontGlyphAtlas& FontProvider::GetGlyphAtlas()
+{
+	return Get().glyph_atlas;
+}
+
+void FontProvider::SetDistanceFieldThreshold(int font_size)
+{
+	g_distance_field_threshold = Math::Max(font_size, 0);
+}
+
+int FontProvider::GetDistanceFieldThreshold()
+{
+	return g_distance_field_threshold;
+}
+
+void FontProvider::SetMemoryBudget(size_t bytes)
+{
+	g_memory_budget = bytes;
+	if (g_font_provider)
+		g_font_provider->ReleaseLeastRecentlyUsedHandles(nullptr);
+}
+
+FontEngineStatistics FontProvider::GetStatistics()
+{
+	const FontProvider& provider = Get();
+	FontEngineStatistics result = provider.statistics;
+
+	result.num_handles = (int)provider.handles.size();
+	for (const FontFaceHandleDefault* handle : provider.handles)
+	{
+		if (handle->IsLoaded())
+			result.num_loaded_handles += 1;
+	}
+	result.memory_usage = provider.GetMemoryUsage();
+	result.memory_budget = g_memory_budget;
+
+	return result;
+}
+
+void FontProvider::RegisterHandle(FontFaceHandleDefault* handle)
+{
+	FontProvider& provider = Get();
+	provider.handles.push_back(handle);
+	provider.resources_added = true;
+}
+
+void FontProvider::UnregisterHandle(FontFaceHandleDefault* handle)
+{
+	auto& handles = Get().handles;
+	auto it = std::find(handles.begin(), handles.end(), handle);
+	if (it != handles.end())
+		handles.erase(it);
+}
+
+uint64_t FontProvider::GetHandleUseStamp()
+{
+	FontProvider& provider = Get();
+	provider.handle_use_clock += 1;
+	return provider.handle_use_clock;
+}
+
+void FontProvider::CountHandleUse(bool resources_loaded)
+{
+	FontEngineStatistics& statistics = Get().statistics;
+	if (resources_loaded)
+		statistics.handle_hits += 1;
+	else
+		statistics.handle_misses += 1;
+}
+
+void FontProvider::OnResourcesAdded()
+{
+	Get().resources_added = true;
+}
+
+void FontProvider::EnforceMemoryBudget(FontFaceHandleDefault* handle_in_use)
+{
+	FontProvider& provider = Get();
+	if (provider.resources_added)
+		provider.ReleaseLeastRecentlyUsedHandles(handle_in_use);
+}
+
+void FontProvider::Tick()
+{
+	FontProvider& provider = Get();
+	provider.previous_tick_use_stamp = provider.tick_use_stamp;
+	provider.tick_use_stamp = provider.handle_use_clock;
+	if (provider.retry_memory_budget)
+		provider.resources_added = true;
+}
+
+void FontProvider::ReleaseLeastRecentlyUsedHandles(FontFaceHandleDefault* keep_handle)
+{
+	resources_added = false;
+	retry_memory_budget = false;
+	if (g_memory_budget == 0)
+		return;
+
+	if (GetMemoryUsage() <= g_memory_budget)
+		return;
+
+	// Handles used since the previous tick may have generated geometry which has yet to be rendered.
+	Vector<FontFaceHandleDefault*> candidates;
+	for (FontFaceHandleDefault* handle : handles)
+	{
+		if (handle->IsLoaded() && handle != keep_handle && handle->GetLastUsed() <= previous_tick_use_stamp)
+			candidates.push_back(handle);
+	}
+
+	std::sort(candidates.begin(), candidates.end(),
+		[](const FontFaceHandleDefault* a, const FontFaceHandleDefault* b) { return a->GetLastUsed() < b->GetLastUsed(); });
+
+	// Atlas pages are shared between handles, and only freed when all their owners are released. Thus, the memory usage is measured again
+	// after releasing each handle.
+	for (FontFaceHandleDefault* handle : candidates)
+	{
+		handle->ReleaseResources();
+		statistics.handle_evictions += 1;
+		ReleaseUnusedDistanceFields();
+
+		if (GetMemoryUsage() <= g_memory_budget)
+			return;
+	}
+
+	// The remaining handles may be holding on to pages left mostly empty by the released handles. Their glyphs are placed on new, smaller
+	// pages the next time they are rendered.
+	if (glyph_atlas.ClearOversizedPages() && GetMemoryUsage() <= g_memory_budget)
+		return;
+
+	// Try again at the next tick, when more handles may have fallen out of use.
+	retry_memory_budget = true;
+}
+
+void FontProvider::ReleaseUnusedDistanceFields()
+{
+	for (const FontFaceHandleDefault* handle : handles)
+	{
+		FontFace* face = handle->GetDistanceFieldFace();
+		if (!face || face->GetDistanceFieldMemoryUsage() == 0)
+			continue;
+
+		// Glyphs may also refer to distance fields of other faces, when copied from fallback faces.
+		const bool in_use = std::any_of(handles.begin(), handles.end(),
+			[face](const FontFaceHandleDefault* other) { return other->IsLoaded() && other->UsesDistanceFieldsOf(face); });
+		if (!in_use)
+			face->ReleaseDistanceFields();
+	}
+}
+
+size_t FontProvider::GetMemoryUsage() const
+{
+	size_t memory_usage = 0;
+	Vector<const FontFace*> distance_field_faces;
+
+	for (const FontFaceHandleDefault* handle : handles)
+	{
+		if (handle->IsLoaded())
+			memory_usage += handle->GetMemoryUsage();
+
+		// Distance fields are shared by all handles of a face, and are counted once for each face.
+		const FontFace* face = handle->GetDistanceFieldFace();
+		if (face && std::find(distance_field_faces.begin(), distance_field_faces.end(), face) == distance_field_faces.end())
+		{
+			distance_field_faces.push_back(face);
+			memory_usage += face->GetDistanceFieldMemoryUsage();
+		}
+	}
+
+	return memory_usage;
+}
+
 bool FontProvider::LoadFontFace(const String& file_name, bool fallback_face, Style::FontWeight weight)
 {
 	FileInterface* file_interface = GetFileInterface();
@@ -29,9 +29,12 @@
 #ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTPROVIDER_H
 #define RMLUI_CORE_FONTENGINEDEFAULT_FONTPROVIDER_H
 
+#include "../../../Include/RmlUi/Core/FontEngineInterface.h"
 #include "../../../Include/RmlUi/Core/StyleTypes.h"
 #include "../../../Include/RmlUi/Core/Types.h"
+#include "FontGlyphAtlas.h"
 #include "FontTypes.h"
+#include <mutex>
 
 namespace Rml {
 
@@ -49,6 +52,11 @@ public:
 	static bool Initialise();
 	static void Shutdown();
 
+	/// Returns the lock which must be held while using the provider or any of its font faces and glyphs. Text may be formatted and generated
+	/// by contexts updated on different threads, thus all calls into the font engine are serialized. The lock is recursive, as the textures
+	/// of the glyph atlas may be generated while it is already held.
+	static std::recursive_mutex& GetMutex();
+
 	/// Returns a handle to a font face that can be used to position and render text. This will return the closest match
 	/// it can find, but in the event a font family is requested that does not exist, nullptr will be returned instead of a
 	/// valid handle.
@@ -74,6 +82,37 @@ public:
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	static void ReleaseFontResources();
 
+	/// Returns the glyph atlas shared by all font face handles.
+	static FontGlyphAtlas& GetGlyphAtlas();
+
+	/// Sets the font size from which new font face handles render their glyphs from distance fields, or zero to disable distance fields.
+	static void SetDistanceFieldThreshold(int font_size);
+	static int GetDistanceFieldThreshold();
+
+	/// Sets the memory budget for the resources of font face handles, or zero for no limit. The budget is enforced whenever handles have added
+	/// resources, by releasing the resources of the least recently used handles. Handles used since the previous tick are not released, as
+	/// they are evidently still in use. Distance fields are counted towards the budget, and released with the last handle using them.
+	static void SetMemoryBudget(size_t bytes);
+	/// Returns statistics of the font face handles and their memory usage.
+	static FontEngineStatistics GetStatistics();
+
+	/// Called by font face handles to keep track of them for the memory budget.
+	static void RegisterHandle(FontFaceHandleDefault* handle);
+	static void UnregisterHandle(FontFaceHandleDefault* handle);
+	/// Returns a new stamp for font face handles to order them by their last use.
+	static uint64_t GetHandleUseStamp();
+	/// Called by font face handles when their resources are used, to count the hits and misses.
+	/// @param[in] resources_loaded True if the handle already had its resources loaded, false if they must be generated.
+	static void CountHandleUse(bool resources_loaded);
+	/// Called when font face handles load glyphs, or the glyph atlas adds pages, so that the memory budget is enforced at the next opportunity.
+	static void OnResourcesAdded();
+	/// Enforces the memory budget if resources were added since it was last enforced. Must not be called while any handle other than the given
+	/// one is in the middle of generating text.
+	/// @param[in] handle_in_use A handle which must keep its resources, or nullptr.
+	static void EnforceMemoryBudget(FontFaceHandleDefault* handle_in_use);
+	/// Advances the usage clock of the handles, called once for every render.
+	static void Tick();
+
 private:
 	FontProvider();
 	~FontProvider();
@@ -86,9 +125,30 @@ private:
 	bool AddFace(FontFaceHandleFreetype face, const String& family, Style::FontStyle style, Style::FontWeight weight, bool fallback_face,
 		UniquePtr<byte[]> face_memory);
 
+	// Releases the resources of the least recently used handles until we are within the memory budget. The given handle, and any handles used
+	// since the previous tick, are kept.
+	void ReleaseLeastRecentlyUsedHandles(FontFaceHandleDefault* keep_handle);
+	// Releases the distance fields of faces no longer used by the glyphs of any handle.
+	void ReleaseUnusedDistanceFields();
+	// Returns the estimated memory used by the resources of all handles, including the distance fields of their faces.
+	size_t GetMemoryUsage() const;
+
 	using FontFaceList = Vector<FontFace*>;
 	using FontFamilyMap = UnorderedMap<String, UniquePtr<FontFamily>>;
 
+	// The atlas is declared first, so that it outlives the font face handles owning its glyphs.
+	FontGlyphAtlas glyph_atlas;
+
+	// All handles with loaded resources at some point, declared before the font families so that they can unregister when destroyed.
+	Vector<FontFaceHandleDefault*> handles;
+	bool resources_added = false;
+	bool retry_memory_budget = false;
+	uint64_t handle_use_clock = 0;
+	// The handle use clock at the current and previous tick.
+	uint64_t tick_use_stamp = 0;
+	uint64_t previous_tick_use_stamp = 0;
+	FontEngineStatistics statistics;
+
 	FontFamilyMap font_families;
 	FontFaceList fallback_font_faces;
 
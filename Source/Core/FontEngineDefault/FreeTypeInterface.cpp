@@ -30,6 +30,7 @@
 #include "../../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../../Include/RmlUi/Core/FontMetrics.h"
 #include "../../../Include/RmlUi/Core/Log.h"
+#include "../FrameProfilerRecorder.h"
 #include <algorithm>
 #include <ft2build.h>
 #include <limits.h>
@@ -42,12 +43,17 @@ namespace Rml {
 
 static FT_Library ft_library = nullptr;
 
-static bool BuildGlyph(FT_Face ft_face, Character character, FontGlyphMap& glyphs, float bitmap_scaling_factor);
-static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, float bitmap_scaling_factor, bool load_default_glyphs);
+// The distance in pixels covered by distance fields on each side of the glyph edges.
+static constexpr int distance_field_spread = 16;
+
+static bool BuildGlyph(FT_Face ft_face, Character character, FontGlyphMap& glyphs, float bitmap_scaling_factor, bool render_bitmap);
+static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, float bitmap_scaling_factor, bool load_default_glyphs,
+	bool render_bitmaps);
 static void GenerateMetrics(FT_Face ft_face, FontMetrics& metrics, float bitmap_scaling_factor);
 static bool SetFontSize(FT_Face ft_face, int font_size, float& out_bitmap_scaling_factor);
 static void BitmapDownscale(byte* bitmap_new, int new_width, int new_height, const byte* bitmap_source, int width, int height, int pitch,
 	ColorFormat color_format);
+static void GenerateDistanceField(FontGlyphDistanceField& distance_field, const byte* bitmap_source, int width, int height, int pitch, int spread);
 
 static int ConvertFixed16_16ToInt(int32_t fx)
 {
@@ -189,7 +195,8 @@ void FreeType::GetFaceStyle(FontFaceHandleFreetype in_face, String* font_family,
 	}
 }
 
-bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs)
+bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs,
+	bool render_bitmaps)
 {
 	FT_Face ft_face = (FT_Face)face;
 
@@ -200,7 +207,7 @@ bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size,
 		return false;
 
 	// Construct the initial list of glyphs.
-	BuildGlyphMap(ft_face, font_size, glyphs, bitmap_scaling_factor, load_default_glyphs);
+	BuildGlyphMap(ft_face, font_size, glyphs, bitmap_scaling_factor, load_default_glyphs, render_bitmaps);
 
 	// Generate the metrics for the handle.
 	GenerateMetrics(ft_face, metrics, bitmap_scaling_factor);
@@ -208,7 +215,7 @@ bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size,
 	return true;
 }
 
-bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs)
+bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs, bool render_bitmaps)
 {
 	FT_Face ft_face = (FT_Face)face;
 
@@ -220,12 +227,55 @@ bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character
 	if (!SetFontSize(ft_face, font_size, bitmap_scaling_factor))
 		return false;
 
-	if (!BuildGlyph(ft_face, character, glyphs, bitmap_scaling_factor))
+	if (!BuildGlyph(ft_face, character, glyphs, bitmap_scaling_factor, render_bitmaps))
 		return false;
 
 	return true;
 }
 
+bool FreeType::SupportsDistanceFields(FontFaceHandleFreetype face)
+{
+	FT_Face ft_face = (FT_Face)face;
+
+	// Color glyphs and bitmap strikes cannot be scaled freely.
+	return FT_IS_SCALABLE(ft_face) && !FT_HAS_COLOR(ft_face);
+}
+
+bool FreeType::BuildGlyphDistanceField(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphDistanceField& out_distance_field)
+{
+	FT_Face ft_face = (FT_Face)face;
+
+	float bitmap_scaling_factor = 1.0f;
+	if (!SetFontSize(ft_face, font_size, bitmap_scaling_factor) || bitmap_scaling_factor != 1.0f)
+		return false;
+
+	FT_UInt index = FT_Get_Char_Index(ft_face, (FT_ULong)character);
+	if (index == 0)
+		return false;
+
+	// Glyph metrics are loaded without hinting for distance field glyphs, thus the distance field must also be unhinted.
+	FT_Error error = FT_Load_Glyph(ft_face, index, FT_LOAD_NO_HINTING);
+	if (error != 0)
+		return false;
+
+	// The distance field is generated from the anti-aliased bitmap, which is much faster than FreeType's own distance field renderer.
+	FT_GlyphSlot ft_glyph = ft_face->glyph;
+	error = FT_Render_Glyph(ft_glyph, FT_RENDER_MODE_NORMAL);
+	if (error != 0 || ft_glyph->bitmap.pixel_mode != FT_PIXEL_MODE_GRAY)
+		return false;
+
+	// Glyphs without any area, such as spaces, have nothing to render.
+	const FT_Bitmap& bitmap = ft_glyph->bitmap;
+	if (bitmap.width == 0 || bitmap.rows == 0)
+		return false;
+
+	FrameProfilerRecorder::Count(FrameCounter::GlyphsRasterized);
+	out_distance_field.origin = Vector2i(ft_glyph->bitmap_left, -ft_glyph->bitmap_top) - Vector2i(distance_field_spread);
+	GenerateDistanceField(out_distance_field, bitmap.buffer, (int)bitmap.width, (int)bitmap.rows, bitmap.pitch, distance_field_spread);
+
+	return true;
+}
+
 int FreeType::GetKerning(FontFaceHandleFreetype face, int font_size, Character lhs, Character rhs)
 {
 	FT_Face ft_face = (FT_Face)face;
@@ -260,7 +310,8 @@ bool FreeType::HasKerning(FontFaceHandleFreetype face)
 	return FT_HAS_KERNING(ft_face);
 }
 
-static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const float bitmap_scaling_factor, const bool load_default_glyphs)
+static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const float bitmap_scaling_factor, const bool load_default_glyphs,
+	const bool render_bitmaps)
 {
 	if (load_default_glyphs)
 	{
@@ -271,7 +322,7 @@ static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const
 		FT_ULong code_max = 126;
 
 		for (FT_ULong character_code = code_min; character_code <= code_max; ++character_code)
-			BuildGlyph(ft_face, (Character)character_code, glyphs, bitmap_scaling_factor);
+			BuildGlyph(ft_face, (Character)character_code, glyphs, bitmap_scaling_factor, render_bitmaps);
 	}
 
 	// Add a replacement character for rendering unknown characters.
@@ -303,13 +354,15 @@ static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const
 	}
 }
 
-static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap& glyphs, const float bitmap_scaling_factor)
+static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap& glyphs, const float bitmap_scaling_factor,
+	const bool render_bitmap)
 {
 	FT_UInt index = FT_Get_Char_Index(ft_face, (FT_ULong)character);
 	if (index == 0)
 		return false;
 
-	FT_Error error = FT_Load_Glyph(ft_face, index, FT_LOAD_COLOR);
+	// Glyphs whose bitmaps are provided by other means should not be hinted, so that their metrics scale uniformly with the font size.
+	FT_Error error = FT_Load_Glyph(ft_face, index, render_bitmap ? FT_LOAD_COLOR : FT_LOAD_NO_HINTING);
 	if (error != 0)
 	{
 		Log::Message(Log::LT_WARNING, "Unable to load glyph for character '%u' on the font face '%s %s'; error code: %d.", (unsigned int)character,
@@ -317,7 +370,8 @@ static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap&
 		return false;
 	}
 
-	error = FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_NORMAL);
+	if (render_bitmap)
+		error = FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_NORMAL);
 	if (error != 0)
 	{
 		Log::Message(Log::LT_WARNING, "Unable to render glyph for character '%u' on the font face '%s %s'; error code: %d.", (unsigned int)character,
@@ -349,8 +403,12 @@ static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap&
 	glyph.advance = ft_glyph->metrics.horiAdvance >> 6;
 
 	// Set the glyph's bitmap dimensions.
-	glyph.bitmap_dimensions.x = ft_glyph->bitmap.width;
-	glyph.bitmap_dimensions.y = ft_glyph->bitmap.rows;
+	if (render_bitmap)
+	{
+		FrameProfilerRecorder::Count(FrameCounter::GlyphsRasterized);
+		glyph.bitmap_dimensions.x = ft_glyph->bitmap.width;
+		glyph.bitmap_dimensions.y = ft_glyph->bitmap.rows;
+	}
 
 	// Determine new metrics if we need to scale the bitmap received from FreeType. Only allow bitmap downscaling.
 	const bool scale_bitmap = (bitmap_scaling_factor < 1.f);
@@ -588,4 +646,109 @@ static void BitmapDownscale(byte* bitmap_new, const int new_width, const int new
 	}
 }
 
+// Computes the squared euclidean distance transform along one line of the grid, using the algorithm by Felzenszwalb and Huttenlocher.
+static void DistanceTransformLine(float* grid, int offset, int stride, int length, float* f, int* v, float* z)
+{
+	constexpr float infinity = 1e20f;
+
+	for (int q = 0; q < length; q++)
+		f[q] = grid[offset + q * stride];
+
+	// Find the lower envelope of the parabolas rooted at each grid point.
+	v[0] = 0;
+	z[0] = -infinity;
+	z[1] = infinity;
+
+	for (int q = 1, k = 0; q < length; q++)
+	{
+		// Remove the parabolas hidden by the new one, the first one always remains as its range starts at negative infinity.
+		float s = 0.f;
+		while (true)
+		{
+			const int r = v[k];
+			s = (f[q] - f[r] + float(q * q - r * r)) / float(2 * (q - r));
+			if (s > z[k] || k == 0)
+				break;
+			k -= 1;
+		}
+
+		k += 1;
+		v[k] = q;
+		z[k] = s;
+		z[k + 1] = infinity;
+	}
+
+	for (int q = 0, k = 0; q < length; q++)
+	{
+		while (z[k + 1] < float(q))
+			k += 1;
+
+		const int r = v[k];
+		grid[offset + q * stride] = f[r] + float((q - r) * (q - r));
+	}
+}
+
+static void DistanceTransform(Vector<float>& grid, Vector2i dimensions, Vector<float>& f, Vector<int>& v, Vector<float>& z)
+{
+	for (int x = 0; x < dimensions.x; x++)
+		DistanceTransformLine(grid.data(), x, dimensions.x, dimensions.y, f.data(), v.data(), z.data());
+	for (int y = 0; y < dimensions.y; y++)
+		DistanceTransformLine(grid.data(), y * dimensions.x, 1, dimensions.x, f.data(), v.data(), z.data());
+}
+
+static void GenerateDistanceField(FontGlyphDistanceField& distance_field, const byte* bitmap_source, const int width, const int height,
+	const int pitch, const int spread)
+{
+	// Based on the approach of Mapbox's TinySDF: The coverage of anti-aliased pixels is used to estimate their sub-pixel distance to the edge,
+	// which seeds exact distance transforms towards the inside and outside of the glyph.
+	constexpr float infinity = 1e20f;
+
+	const Vector2i dimensions = Vector2i(width, height) + Vector2i(2 * spread);
+	const int num_pixels = dimensions.x * dimensions.y;
+
+	Vector<float> grid_outside(num_pixels, infinity);
+	Vector<float> grid_inside(num_pixels, 0.f);
+
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			const float coverage = float(bitmap_source[y * pitch + x]) / 255.f;
+			if (coverage <= 0.f)
+				continue;
+
+			const int i = (y + spread) * dimensions.x + (x + spread);
+			if (coverage >= 1.f)
+			{
+				grid_outside[i] = 0.f;
+				grid_inside[i] = infinity;
+			}
+			else
+			{
+				const float d = 0.5f - coverage;
+				grid_outside[i] = (d > 0.f ? d * d : 0.f);
+				grid_inside[i] = (d < 0.f ? d * d : 0.f);
+			}
+		}
+	}
+
+	const int max_length = Math::Max(dimensions.x, dimensions.y);
+	Vector<float> f(max_length);
+	Vector<int> v(max_length);
+	Vector<float> z(max_length + 1);
+
+	DistanceTransform(grid_outside, dimensions, f, v, z);
+	DistanceTransform(grid_inside, dimensions, f, v, z);
+
+	distance_field.dimensions = dimensions;
+	distance_field.spread = float(spread);
+	distance_field.data.reset(new byte[num_pixels]);
+
+	for (int i = 0; i < num_pixels; i++)
+	{
+		const float distance = Math::SquareRoot(grid_inside[i]) - Math::SquareRoot(grid_outside[i]);
+		distance_field.data[i] = byte(Math::Clamp(128.f + distance * (128.f / float(spread)), 0.f, 255.f) + 0.5f);
+	}
+}
+
 } // namespace Rml
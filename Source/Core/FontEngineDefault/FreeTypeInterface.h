@@ -54,10 +54,18 @@ namespace FreeType {
 	void GetFaceStyle(FontFaceHandleFreetype face, String* font_family, Style::FontStyle* style, Style::FontWeight* weight);
 
 	// Initializes a face for a given font size. Glyphs are filled with the ASCII subset, and the font face metrics are set.
-	bool InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs);
+	// Without 'render_bitmaps', only the unhinted glyph metrics are loaded, and the glyph bitmaps must be provided by other means.
+	bool InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs,
+		bool render_bitmaps = true);
 
 	// Build a new glyph representing the given code point and append to 'glyphs'.
-	bool AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs);
+	bool AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs, bool render_bitmaps = true);
+
+	// Returns true if signed distance fields can be rendered for the glyphs of the given face.
+	bool SupportsDistanceFields(FontFaceHandleFreetype face);
+
+	// Renders the signed distance field of the glyph representing the given code point, at the given font size.
+	bool BuildGlyphDistanceField(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphDistanceField& out_distance_field);
 
 	// Returns the kerning between two characters.
 	// 'font_size' value of zero assumes the font size is already set on the face, and skips this step for performance reasons.
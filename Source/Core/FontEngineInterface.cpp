@@ -84,6 +84,15 @@ int FontEngineInterface::GetVersion(FontFaceHandle /*handle*/)
 	return 0;
 }
 
+void FontEngineInterface::PrepareRender() {}
+
 void FontEngineInterface::ReleaseFontResources() {}
 
+void FontEngineInterface::SetMemoryBudget(size_t /*bytes*/) {}
+
+FontEngineStatistics FontEngineInterface::GetStatistics()
+{
+	return FontEngineStatistics();
+}
+
 } // namespace Rml
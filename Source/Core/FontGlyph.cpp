@@ -0,0 +1,126 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../Include/RmlUi/Core/FontGlyph.h"
+#include "../../Include/RmlUi/Core/Math.h"
+
+namespace Rml {
+
+float FontGlyph::GetEdgeDistance(Vector2f position) const
+{
+	RMLUI_ASSERT(distance_field && distance_field->data && distance_field_scale > 0.f);
+	const FontGlyphDistanceField& field = *distance_field;
+
+	// Convert the position to field pixels, where distance values are located at pixel centers.
+	const Vector2f glyph_position = position + Vector2f(float(bearing.x), float(-bearing.y));
+	const Vector2f field_position = glyph_position / distance_field_scale - Vector2f(field.origin) - Vector2f(0.5f);
+
+	const int x0 = Math::RoundDownToInteger(field_position.x);
+	const int y0 = Math::RoundDownToInteger(field_position.y);
+	const float fx = field_position.x - float(x0);
+	const float fy = field_position.y - float(y0);
+
+	// Values outside the field are as far outside the glyph as can be represented.
+	auto GetValue = [&field](int x, int y) -> float {
+		if (x < 0 || y < 0 || x >= field.dimensions.x || y >= field.dimensions.y)
+			return 0.f;
+		return float(field.data[y * field.dimensions.x + x]);
+	};
+
+	const float value_top = Math::Lerp(fx, GetValue(x0, y0), GetValue(x0 + 1, y0));
+	const float value_bottom = Math::Lerp(fx, GetValue(x0, y0 + 1), GetValue(x0 + 1, y0 + 1));
+	const float value = Math::Lerp(fy, value_top, value_bottom);
+
+	const float field_distance = (value - 128.f) * (field.spread / 128.f);
+	return field_distance * distance_field_scale;
+}
+
+float FontGlyph::GetMaxEdgeDistance() const
+{
+	if (!distance_field)
+		return 0.f;
+	return distance_field->spread * distance_field_scale;
+}
+
+void FontGlyph::GenerateCoverage(byte* destination, Vector2i dimensions, int stride, ColorFormat color_format, Vector2i offset,
+	float dilation) const
+{
+	RMLUI_ASSERT(distance_field && distance_field->data && distance_field_scale > 0.f);
+	const FontGlyphDistanceField& field = *distance_field;
+
+	const int num_channels = (color_format == ColorFormat::RGBA8 ? 4 : 1);
+	const int alpha_channel = num_channels - 1;
+
+	// The mapping to field pixels is separable, so the interpolation indices and weights are only calculated once for each column and row.
+	struct Sample {
+		int index;
+		float weight;
+	};
+	auto CalculateSamples = [this](Vector<Sample>& samples, int count, int offset, int bearing, int origin) {
+		samples.resize(count);
+		for (int i = 0; i < count; i++)
+		{
+			const float field_position = (float(i - offset + bearing) + 0.5f) / distance_field_scale - float(origin) - 0.5f;
+			const int index = Math::RoundDownToInteger(field_position);
+			samples[i] = Sample{index, field_position - float(index)};
+		}
+	};
+
+	Vector<Sample> columns, rows;
+	CalculateSamples(columns, dimensions.x, offset.x, bearing.x, field.origin.x);
+	CalculateSamples(rows, dimensions.y, offset.y, -bearing.y, field.origin.y);
+
+	// Values outside the field are as far outside the glyph as can be represented.
+	auto GetValue = [&field](const byte* row, int x) -> float { return (row && x >= 0 && x < field.dimensions.x) ? float(row[x]) : 0.f; };
+	auto GetRow = [&field](int y) -> const byte* { return (y >= 0 && y < field.dimensions.y) ? field.data.get() + y * field.dimensions.x : nullptr; };
+
+	// The coverage is a linear function of the interpolated distance value, with anti-aliasing over a single pixel.
+	const float value_to_distance = field.spread / 128.f * distance_field_scale;
+	const float coverage_offset = dilation + 0.5f - 128.f * value_to_distance;
+
+	for (int y = 0; y < dimensions.y; y++)
+	{
+		const Sample row = rows[y];
+		const byte* row_top = GetRow(row.index);
+		const byte* row_bottom = GetRow(row.index + 1);
+		byte* destination_row = destination + y * stride + alpha_channel;
+
+		for (int x = 0; x < dimensions.x; x++)
+		{
+			const Sample column = columns[x];
+			const float value_top = Math::Lerp(column.weight, GetValue(row_top, column.index), GetValue(row_top, column.index + 1));
+			const float value_bottom = Math::Lerp(column.weight, GetValue(row_bottom, column.index), GetValue(row_bottom, column.index + 1));
+			const float value = Math::Lerp(row.weight, value_top, value_bottom);
+
+			const float coverage = Math::Clamp(value * value_to_distance + coverage_offset, 0.f, 1.f);
+			destination_row[x * num_channels] = byte(coverage * 255.f + 0.5f);
+		}
+	}
+}
+
+} // namespace Rml
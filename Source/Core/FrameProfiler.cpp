@@ -0,0 +1,177 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../Include/RmlUi/Core/FrameProfiler.h"
+#include "FrameProfilerRecorder.h"
+#include <mutex>
+
+namespace Rml {
+
+std::atomic<bool> FrameProfilerRecorder::enabled{false};
+std::atomic<bool> FrameProfilerRecorder::rendered_since_frame_end{false};
+std::atomic<uint64_t> FrameProfilerRecorder::timers[size_t(FrameTimer::Count)] = {};
+std::atomic<uint64_t> FrameProfilerRecorder::counters[size_t(FrameCounter::Count)] = {};
+thread_local uint32_t FrameProfilerRecorder::active_timers = 0;
+
+static_assert(size_t(FrameTimer::Count) <= 32, "Frame timers must fit in the active timers bit mask.");
+
+void FrameProfilerRecorder::SetEnabled(bool enable)
+{
+	if (enable && !IsEnabled())
+	{
+		for (auto& timer : timers)
+			timer.store(0, std::memory_order_relaxed);
+		for (auto& counter : counters)
+			counter.store(0, std::memory_order_relaxed);
+		rendered_since_frame_end.store(false, std::memory_order_relaxed);
+	}
+	enabled.store(enable, std::memory_order_relaxed);
+}
+
+void FrameProfilerRecorder::CollectFrame(FrameProfile& frame)
+{
+	for (size_t i = 0; i < size_t(FrameTimer::Count); i++)
+		frame.timers[i] = double(timers[i].exchange(0, std::memory_order_relaxed)) * 1e-9;
+	for (size_t i = 0; i < size_t(FrameCounter::Count); i++)
+		frame.counters[i] = counters[i].exchange(0, std::memory_order_relaxed);
+}
+
+namespace {
+	struct FrameProfilerData {
+		std::mutex mutex;
+		FrameProfilerRecorder::Clock::time_point frame_start;
+		// Completed frames, used as a ring buffer once full.
+		Vector<FrameProfile> frames;
+		size_t next_frame_index = 0;
+	};
+} // namespace
+
+static FrameProfilerData& GetData()
+{
+	static FrameProfilerData data;
+	return data;
+}
+
+namespace FrameProfiler {
+
+	void SetEnabled(bool enable)
+	{
+		FrameProfilerData& data = GetData();
+		std::lock_guard<std::mutex> lock(data.mutex);
+
+		if (enable && !FrameProfilerRecorder::IsEnabled())
+		{
+			data.frames.clear();
+			data.next_frame_index = 0;
+			data.frame_start = FrameProfilerRecorder::Clock::now();
+		}
+
+		FrameProfilerRecorder::SetEnabled(enable);
+	}
+
+	bool IsEnabled()
+	{
+		return FrameProfilerRecorder::IsEnabled();
+	}
+
+	void EndFrame()
+	{
+		if (!FrameProfilerRecorder::IsEnabled())
+			return;
+
+		FrameProfilerData& data = GetData();
+		std::lock_guard<std::mutex> lock(data.mutex);
+
+		FrameProfile frame;
+		FrameProfilerRecorder::CollectFrame(frame);
+
+		const FrameProfilerRecorder::Clock::time_point now = FrameProfilerRecorder::Clock::now();
+		frame.duration = std::chrono::duration<double>(now - data.frame_start).count();
+		data.frame_start = now;
+
+		if (data.frames.size() < size_t(max_frames))
+		{
+			data.frames.push_back(frame);
+		}
+		else
+		{
+			data.frames[data.next_frame_index] = frame;
+			data.next_frame_index = (data.next_frame_index + 1) % data.frames.size();
+		}
+	}
+
+	Vector<FrameProfile> GetFrames()
+	{
+		FrameProfilerData& data = GetData();
+		std::lock_guard<std::mutex> lock(data.mutex);
+
+		Vector<FrameProfile> result;
+		result.reserve(data.frames.size());
+		result.insert(result.end(), data.frames.begin() + data.next_frame_index, data.frames.end());
+		result.insert(result.end(), data.frames.begin(), data.frames.begin() + data.next_frame_index);
+		return result;
+	}
+
+	void ClearFrames()
+	{
+		FrameProfilerData& data = GetData();
+		std::lock_guard<std::mutex> lock(data.mutex);
+		data.frames.clear();
+		data.next_frame_index = 0;
+	}
+
+	const char* GetName(FrameTimer timer)
+	{
+		switch (timer)
+		{
+		case FrameTimer::DataModelUpdate: return "Data model update";
+		case FrameTimer::StyleUpdate: return "Style update";
+		case FrameTimer::Layout: return "Layout";
+		case FrameTimer::Render: return "Render";
+		case FrameTimer::EventDispatch: return "Event dispatch";
+		case FrameTimer::Count: break;
+		}
+		return "";
+	}
+
+	const char* GetName(FrameCounter counter)
+	{
+		switch (counter)
+		{
+		case FrameCounter::ElementsUpdated: return "Elements updated";
+		case FrameCounter::DefinitionLookups: return "Definition lookups";
+		case FrameCounter::Layouts: return "Layouts";
+		case FrameCounter::DrawCalls: return "Draw calls";
+		case FrameCounter::GlyphsRasterized: return "Glyphs rasterized";
+		case FrameCounter::Count: break;
+		}
+		return "";
+	}
+
+} // namespace FrameProfiler
+} // namespace Rml
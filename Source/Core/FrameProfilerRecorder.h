@@ -0,0 +1,125 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FRAMEPROFILERRECORDER_H
+#define RMLUI_CORE_FRAMEPROFILERRECORDER_H
+
+#include "../../Include/RmlUi/Core/FrameProfiler.h"
+#include <atomic>
+#include <chrono>
+
+namespace Rml {
+
+/**
+    Records the timings and counters of the frame profiler, from the instrumentation points in the library.
+
+    Recording may happen concurrently from multiple threads. All checks are inlined, so that they reduce to a single relaxed load while the
+    profiler is disabled.
+ */
+class FrameProfilerRecorder {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+	/// Adds to the given counter of the current frame.
+	static void Count(FrameCounter counter, uint64_t amount = 1)
+	{
+		if (IsEnabled())
+			counters[size_t(counter)].fetch_add(amount, std::memory_order_relaxed);
+	}
+
+	/// Enables or disables recording, the recorded values are cleared when enabling.
+	static void SetEnabled(bool enable);
+	/// Moves the values recorded during the current frame to the given frame.
+	static void CollectFrame(FrameProfile& frame);
+
+	/// Called at the start of a context update, ends the frame if any context was rendered since the last frame ended.
+	static void OnContextUpdate()
+	{
+		if (IsEnabled() && rendered_since_frame_end.exchange(false, std::memory_order_relaxed))
+			FrameProfiler::EndFrame();
+	}
+	/// Called at the end of a context render.
+	static void OnContextRender()
+	{
+		if (IsEnabled())
+			rendered_since_frame_end.store(true, std::memory_order_relaxed);
+	}
+
+private:
+	static void AddTime(FrameTimer timer, Clock::duration duration)
+	{
+		timers[size_t(timer)].fetch_add(uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()), std::memory_order_relaxed);
+	}
+
+	static std::atomic<bool> enabled;
+	static std::atomic<bool> rendered_since_frame_end;
+	static std::atomic<uint64_t> timers[size_t(FrameTimer::Count)];     // In nanoseconds.
+	static std::atomic<uint64_t> counters[size_t(FrameCounter::Count)];
+	// The timers currently being measured on this thread, as a bit mask, used to avoid counting recursive stages multiple times.
+	static thread_local uint32_t active_timers;
+
+	friend class FrameProfilerScope;
+};
+
+/**
+    Adds the time spent in the current scope to a frame profiler timer, unless the timer is already being measured by an enclosing scope.
+ */
+class FrameProfilerScope {
+public:
+	FrameProfilerScope(FrameTimer timer) : timer(timer)
+	{
+		if (FrameProfilerRecorder::IsEnabled() && !(FrameProfilerRecorder::active_timers & Bit()))
+		{
+			FrameProfilerRecorder::active_timers |= Bit();
+			active = true;
+			start = FrameProfilerRecorder::Clock::now();
+		}
+	}
+	~FrameProfilerScope()
+	{
+		if (active)
+		{
+			FrameProfilerRecorder::AddTime(timer, FrameProfilerRecorder::Clock::now() - start);
+			FrameProfilerRecorder::active_timers &= ~Bit();
+		}
+	}
+	FrameProfilerScope(const FrameProfilerScope&) = delete;
+	FrameProfilerScope& operator=(const FrameProfilerScope&) = delete;
+
+private:
+	uint32_t Bit() const { return 1u << uint32_t(timer); }
+
+	FrameTimer timer;
+	bool active = false;
+	FrameProfilerRecorder::Clock::time_point start;
+};
+
+} // namespace Rml
+#endif
@@ -51,7 +51,7 @@ static void LogUnexpectedFlowElement(Element* element, Style::Display display)
 }
 
 #ifdef RMLUI_DEBUG
-static bool g_debug_dumping_layout_tree = false;
+static thread_local bool g_debug_dumping_layout_tree = false;
 struct DebugDumpLayoutTree {
 	Element* element;
 	BlockContainer* block_box;
@@ -68,12 +68,12 @@ namespace Detail {
     Global stack allocator.
 
     Can very cheaply allocate memory using the global stack allocator. Memory will be allocated from the
-    heap on the very first construction of a global stack allocator, and will persist and be re-used after.
-    Falls back to malloc if there is not enough space left.
+    heap on the very first construction of a global stack allocator on each thread, and will persist and be
+    re-used after. Falls back to malloc if there is not enough space left.
 
     Warning: Using this is dangerous as deallocation must happen in exact reverse order of allocation.
-      Memory is shared between different global stack allocators. Should only be used for highly localized code,
-      where memory is allocated and then quickly thrown away.
+      Memory is shared between different global stack allocators on the same thread. Should only be used for
+      highly localized code, where memory is allocated and then quickly thrown away.
 */
 
 template <typename T>
@@ -28,6 +28,7 @@
 
 #include "PluginRegistry.h"
 #include "../../Include/RmlUi/Core/Plugin.h"
+#include "ContextActivity.h"
 #include <algorithm>
 
 namespace Rml {
@@ -41,6 +42,7 @@ PluginRegistry::PluginRegistry() {}
 
 void PluginRegistry::RegisterPlugin(Plugin* plugin)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	int event_classes = plugin->GetEventClasses();
 
 	if (event_classes & Plugin::EVT_BASIC)
@@ -33,9 +33,16 @@
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Traits.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
 
 namespace Rml {
 
+/**
+    A pool of objects of a single type, allocated in chunks.
+
+    Objects may be allocated and deallocated from multiple threads, the pool itself is locked only while its lists are modified. Objects are
+    constructed and destroyed outside the lock, so that they may in turn allocate from or release into the same pool.
+ */
 template <typename PoolType>
 class Pool {
 private:
@@ -118,9 +125,16 @@ public:
 	inline int GetNumAllocatedObjects() const;
 
 private:
+	// Takes a node from the free list and adds it to the allocated list, or returns nullptr if no node is available.
+	PoolNode* AllocateNode();
+	// Moves the node from the allocated list back to the free list, returns the next allocated node.
+	PoolNode* DeallocateNode(PoolNode* node);
+
 	// Creates a new pool chunk and appends its nodes to the beginning of the free list.
 	void CreateChunk();
 
+	std::mutex mutex;
+
 	int chunk_size;
 	bool grow;
 
@@ -94,6 +94,70 @@ template<typename PoolType>
 template<typename ...Args>
 inline PoolType* Pool<PoolType>::AllocateAndConstruct(Args&&... args)
 {
+	PoolNode* allocated_object = AllocateNode();
+	if (allocated_object == nullptr)
+		return nullptr;
+
+	return new (allocated_object->object) PoolType(std::forward<Args>(args)...);
+}
+
+// Deallocates the object pointed to by the given iterator.
+template < typename PoolType >
+void Pool< PoolType >::DestroyAndDeallocate(Iterator& iterator)
+{
+	PoolNode* object = iterator.node;
+	reinterpret_cast<PoolType*>(object->object)->~PoolType();
+
+	// Increment the iterator, so it points to the next active object.
+	iterator.node = DeallocateNode(object);
+}
+
+// Deallocates the given object.
+template < typename PoolType >
+void Pool< PoolType >::DestroyAndDeallocate(PoolType* object)
+{
+	// This assumes the object has the same address as the node, which will be
+	// true as long as the struct definition does not change.
+	Iterator iterator((PoolNode*) object);
+	DestroyAndDeallocate(iterator);
+}
+
+// Returns the number of objects in the pool.
+template < typename PoolType >
+int Pool< PoolType >::GetSize() const
+{
+	return chunk_size * GetNumChunks();
+}
+
+/// Returns the number of object chunks in the pool.
+template < typename PoolType >
+int Pool< PoolType >::GetNumChunks() const
+{
+	int num_chunks = 0;
+
+	PoolChunk* chunk = pool;
+	while (chunk != nullptr)
+	{
+		++num_chunks;
+		chunk = chunk->next;
+	}
+
+	return num_chunks;
+}
+
+// Returns the number of allocated objects in the pool.
+template < typename PoolType >
+int Pool< PoolType >::GetNumAllocatedObjects() const
+{
+	return num_allocated_objects;
+}
+
+// Takes a node from the free list and adds it to the allocated list.
+template < typename PoolType >
+typename Pool< PoolType >::PoolNode* Pool< PoolType >::AllocateNode()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
 	// We can't allocate a new object if the deallocated list is empty.
 	if (first_free_node == nullptr)
 	{
@@ -140,19 +204,18 @@ inline PoolType* Pool<PoolType>::AllocateAndConstruct(Args&&... args)
 
 	first_allocated_node = allocated_object;
 
-	return new (allocated_object->object) PoolType(std::forward<Args>(args)...);
+	return allocated_object;
 }
 
-// Deallocates the object pointed to by the given iterator.
+// Moves the node from the allocated list back to the free list.
 template < typename PoolType >
-void Pool< PoolType >::DestroyAndDeallocate(Iterator& iterator)
+typename Pool< PoolType >::PoolNode* Pool< PoolType >::DeallocateNode(PoolNode* object)
 {
+	std::lock_guard<std::mutex> lock(mutex);
+
 	// We're about to deallocate an object.
 	--num_allocated_objects;
 
-	PoolNode* object = iterator.node;
-	reinterpret_cast<PoolType*>(object->object)->~PoolType();
-
 	// Get the previous and next pointers now, because they will be overwritten
 	// before we're finished.
 	PoolNode* previous_object = object->previous;
@@ -183,48 +246,7 @@ void Pool< PoolType >::DestroyAndDeallocate(Iterator& iterator)
 
 	first_free_node = object;
 
-	// Increment the iterator, so it points to the next active object.
-	iterator.node = next_object;
-}
-
-// Deallocates the given object.
-template < typename PoolType >
-void Pool< PoolType >::DestroyAndDeallocate(PoolType* object)
-{
-	// This assumes the object has the same address as the node, which will be
-	// true as long as the struct definition does not change.
-	Iterator iterator((PoolNode*) object);
-	DestroyAndDeallocate(iterator);
-}
-
-// Returns the number of objects in the pool.
-template < typename PoolType >
-int Pool< PoolType >::GetSize() const
-{
-	return chunk_size * GetNumChunks();
-}
-
-/// Returns the number of object chunks in the pool.
-template < typename PoolType >
-int Pool< PoolType >::GetNumChunks() const
-{
-	int num_chunks = 0;
-
-	PoolChunk* chunk = pool;
-	while (chunk != nullptr)
-	{
-		++num_chunks;
-		chunk = chunk->next;
-	}
-
-	return num_chunks;
-}
-
-// Returns the number of allocated objects in the pool.
-template < typename PoolType >
-int Pool< PoolType >::GetNumAllocatedObjects() const
-{
-	return num_allocated_objects;
+	return next_object;
 }
 
 // Creates a new pool chunk and appends its nodes to the beginning of the free list.
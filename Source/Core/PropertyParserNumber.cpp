@@ -55,6 +55,35 @@ PropertyParserNumber::PropertyParserNumber(Units units, Unit zero_unit) : units(
 PropertyParserNumber::~PropertyParserNumber() {}
 
 bool PropertyParserNumber::ParseValue(Property& property, const String& value, const ParameterMap& /*parameters*/) const
+{
+	float float_value = 0.f;
+	Unit unit = Unit::UNKNOWN;
+	if (!ParseNumber(float_value, unit, value))
+		return false;
+
+	if (Any(unit & units))
+	{
+		property.value = float_value;
+		property.unit = unit;
+		return true;
+	}
+
+	// Detected unit not allowed.
+	// However, we allow a value of "0" if zero_unit is set and no unit specified (that is, unit is a pure NUMBER).
+	if (unit == Unit::NUMBER)
+	{
+		if (zero_unit != Unit::UNKNOWN && float_value == 0.0f)
+		{
+			property.unit = zero_unit;
+			property.value = Variant(0.0f);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool PropertyParserNumber::ParseNumber(float& number, Unit& unit, const String& value)
 {
 	// Find the beginning of the unit string in 'value'.
 	size_t unit_pos = 0;
@@ -72,7 +101,7 @@ bool PropertyParserNumber::ParseValue(Property& property, const String& value, c
 	String str_unit = StringUtilities::ToLower(value.substr(unit_pos));
 
 	char* str_end = nullptr;
-	float float_value = strtof(str_number.c_str(), &str_end);
+	number = strtof(str_number.c_str(), &str_end);
 	if (str_number.c_str() == str_end)
 	{
 		// Number conversion failed
@@ -86,28 +115,8 @@ bool PropertyParserNumber::ParseValue(Property& property, const String& value, c
 		return false;
 	}
 
-	const Unit unit = it->second;
-
-	if (Any(unit & units))
-	{
-		property.value = float_value;
-		property.unit = unit;
-		return true;
-	}
-
-	// Detected unit not allowed.
-	// However, we allow a value of "0" if zero_unit is set and no unit specified (that is, unit is a pure NUMBER).
-	if (unit == Unit::NUMBER)
-	{
-		if (zero_unit != Unit::UNKNOWN && float_value == 0.0f)
-		{
-			property.unit = zero_unit;
-			property.value = Variant(0.0f);
-			return true;
-		}
-	}
-
-	return false;
+	unit = it->second;
+	return true;
 }
 
 } // namespace Rml
@@ -51,6 +51,13 @@ public:
 	/// @return True if the value was validated successfully, false otherwise.
 	bool ParseValue(Property& property, const String& value, const ParameterMap& parameters) const override;
 
+	/// Splits a number with an optional unit, such as '12.5px', into its numeric value and unit.
+	/// @param[out] number The parsed number.
+	/// @param[out] unit The parsed unit, or Unit::NUMBER if no unit is specified.
+	/// @param[in] value The raw value to parse.
+	/// @return True if the value starts with a number and any unit is known, false otherwise.
+	static bool ParseNumber(float& number, Unit& unit, const String& value);
+
 private:
 	// Stores a bit mask of allowed units.
 	Units units;
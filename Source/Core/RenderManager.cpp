@@ -31,6 +31,7 @@
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "FrameProfilerRecorder.h"
 #include "TextureDatabase.h"
 
 namespace Rml {
@@ -245,6 +246,7 @@ void RenderManager::Render(const Geometry& geometry, Vector2f translation, Textu
 		else if (texture.callback_index != StableVectorIndex::Invalid)
 			texture_handle = texture_database->callback_database.GetHandle(this, render_interface, texture.callback_index);
 
+		FrameProfilerRecorder::Count(FrameCounter::DrawCalls);
 		if (shader)
 			render_interface->RenderShader(shader.resource_handle, geometry_handle, translation, texture_handle);
 		else
@@ -268,6 +270,12 @@ void RenderManager::ReleaseAllTextures()
 	texture_database->file_database.ReleaseAllTextures(render_interface);
 }
 
+void RenderManager::ReleaseTextureHandle(Texture texture)
+{
+	RMLUI_ASSERT(texture.render_manager == this && texture.callback_index != StableVectorIndex::Invalid);
+	texture_database->callback_database.ReleaseTextureHandle(render_interface, texture.callback_index);
+}
+
 void RenderManager::ReleaseAllCompiledGeometry()
 {
 	geometry_list.for_each([this](GeometryData& data) {
@@ -68,4 +68,9 @@ void RenderManagerAccess::ReleaseAllCompiledGeometry(RenderManager* render_manag
 	render_manager->ReleaseAllCompiledGeometry();
 }
 
+void RenderManagerAccess::ReleaseTextureHandle(RenderManager* render_manager, Texture texture)
+{
+	render_manager->ReleaseTextureHandle(texture);
+}
+
 } // namespace Rml
@@ -59,10 +59,13 @@ private:
 	static bool ReleaseTexture(RenderManager* render_manager, const String& texture_source);
 	static void ReleaseAllTextures(RenderManager* render_manager);
 	static void ReleaseAllCompiledGeometry(RenderManager* render_manager);
+	// Releases the texture data of a callback texture, to be generated again by its callback the next time it is rendered.
+	static void ReleaseTextureHandle(RenderManager* render_manager, Texture texture);
 
 	friend class CompiledFilter;
 	friend class CompiledShader;
 	friend class CallbackTexture;
+	friend class FontGlyphAtlas;
 	friend class Geometry;
 	friend class Texture;
 
@@ -68,6 +68,7 @@ void StyleSheet::MergeStyleSheet(const StyleSheet& other_sheet)
 {
 	RMLUI_ZoneScoped;
 
+	RMLUI_ASSERTMSG(!styled_node_index_built, "Style sheet must not be merged into after its node index has been built.");
 	root->MergeHierarchy(other_sheet.root.get(), specificity_offset);
 	specificity_offset += other_sheet.specificity_offset;
 
@@ -93,8 +94,16 @@ void StyleSheet::MergeStyleSheet(const StyleSheet& other_sheet)
 void StyleSheet::BuildNodeIndex()
 {
 	RMLUI_ZoneScoped;
+
+	// Style sheets can be shared between several documents, which may be compiled in parallel. Once built, the index stays read-only.
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	if (styled_node_index_built)
+		return;
+
 	styled_node_index = {};
 	root->BuildIndex(styled_node_index);
+	root->BuildInvalidationIndex(styled_node_index);
+	styled_node_index_built = true;
 }
 
 const NamedDecorator* StyleSheet::GetNamedDecorator(const String& name) const
@@ -113,11 +122,12 @@ const Keyframes* StyleSheet::GetKeyframes(const String& name) const
 	return nullptr;
 }
 
-const DecoratorPtrList& StyleSheet::InstanceDecorators(RenderManager& render_manager, const DecoratorDeclarationList& declaration_list,
+DecoratorPtrList StyleSheet::InstanceDecorators(RenderManager& render_manager, const DecoratorDeclarationList& declaration_list,
 	const PropertySource* source) const
 {
-	RMLUI_ASSERT_NONRECURSIVE; // Since we may return a reference to the below static variable.
-	static DecoratorPtrList non_cached_decorator_list;
+	// Returned by value, since other threads may modify the cache as soon as the lock is released.
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	DecoratorPtrList non_cached_decorator_list;
 
 	// Empty declaration values are used for interpolated values which we don't want to cache.
 	const bool enable_cache = !declaration_list.value.empty();
@@ -138,10 +148,6 @@ const DecoratorPtrList& StyleSheet::InstanceDecorators(RenderManager& render_man
 		if (it_cache != decorator_cache.end())
 			return it_cache->second;
 	}
-	else
-	{
-		non_cached_decorator_list.clear();
-	}
 
 	DecoratorPtrList& decorators = enable_cache ? decorator_cache[key] : non_cached_decorator_list;
 	decorators.reserve(declaration_list.list.size());
@@ -194,12 +200,12 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 {
 	RMLUI_ASSERT_NONRECURSIVE;
 
-	// Using static to avoid allocations. Make sure we don't call this function recursively.
-	static Vector<const StyleSheetNode*> applicable_nodes;
+	// Using a thread-local static to avoid allocations. Make sure we don't call this function recursively.
+	static thread_local Vector<const StyleSheetNode*> applicable_nodes;
 	applicable_nodes.clear();
 
-	auto AddApplicableNodes = [element](const StyleSheetIndex::NodeIndex& node_index, const String& key) {
-		auto it_nodes = node_index.find(Hash<String>()(key));
+	auto AddApplicableNodes = [element](const StyleSheetIndex::NodeIndex& node_index, Atom key) {
+		auto it_nodes = node_index.find(std::size_t(key));
 		if (it_nodes != node_index.end())
 		{
 			const StyleSheetIndex::NodeList& nodes = it_nodes->second;
@@ -209,26 +215,28 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 				// We found a node that has at least one requirement matching the element. Now see if we satisfy the remaining requirements of the
 				// node, including all ancestor nodes. What this involves is traversing the style nodes backwards, trying to match nodes in the
 				// element's hierarchy to nodes in the style hierarchy.
-				if (node->IsApplicable(element))
+				if (node->IsApplicableIndexed(element))
 					applicable_nodes.push_back(node);
 			}
 		}
 	};
 
 	// See if there are any styles defined for this element.
-	const String& tag = element->GetTagName();
-	const String& id = element->GetId();
-	const StringList& class_names = element->GetStyle()->GetClassNameList();
+	const ElementStyle* style = element->GetStyle();
+	const Atom tag = style->GetTagAtom();
+	const Atom id = style->GetIdAtom();
+	const AtomList& class_names = style->GetClassNameList();
 
 	// Text elements are never matched.
-	if (tag == "#text")
+	static const Atom text_atom = AtomTable::Intern("#text");
+	if (tag == text_atom)
 		return nullptr;
 
-	// First, look up the indexed requirements.
-	if (!id.empty())
+	// First, look up the indexed requirements. Ids which are not interned are not used by any selector.
+	if (id != Atom::Empty && id != Atom::Invalid)
 		AddApplicableNodes(styled_node_index.ids, id);
 
-	for (const String& name : class_names)
+	for (Atom name : class_names)
 		AddApplicableNodes(styled_node_index.classes, name);
 
 	AddApplicableNodes(styled_node_index.tags, tag);
@@ -254,6 +262,7 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 	});
 
 	// Check if this puppy has already been cached in the node index.
+	std::lock_guard<std::mutex> lock(cache_mutex);
 	SharedPtr<const ElementDefinition>& definition = node_cache[applicable_nodes];
 	if (!definition)
 	{
@@ -264,4 +273,33 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 	return definition;
 }
 
+static StyleSheetInvalidation GetInvalidation(const StyleSheetIndex::InvalidationIndex& invalidation_index, const String& name)
+{
+	// Names which have never been interned can't appear in any selector.
+	const Atom atom = AtomTable::Find(name);
+	if (atom == Atom::Invalid)
+		return StyleSheetInvalidation::None;
+
+	auto it = invalidation_index.find(std::size_t(atom));
+	if (it == invalidation_index.end())
+		return StyleSheetInvalidation::None;
+
+	return it->second;
+}
+
+StyleSheetInvalidation StyleSheet::GetClassInvalidation(const String& class_name) const
+{
+	return GetInvalidation(styled_node_index.class_invalidation, class_name);
+}
+
+StyleSheetInvalidation StyleSheet::GetPseudoClassInvalidation(const String& pseudo_class) const
+{
+	return GetInvalidation(styled_node_index.pseudo_class_invalidation, pseudo_class);
+}
+
+StyleSheetInvalidation StyleSheet::GetAttributeInvalidation(const String& attribute_name) const
+{
+	return GetInvalidation(styled_node_index.attribute_invalidation, attribute_name);
+}
+
 } // namespace Rml
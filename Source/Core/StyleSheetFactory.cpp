@@ -72,25 +72,30 @@ void StyleSheetFactory::Shutdown()
 const StyleSheetContainer* StyleSheetFactory::GetStyleSheetContainer(const String& sheet_name)
 {
 	// Look up the sheet definition in the cache
-	auto it = instance->stylesheets.find(sheet_name);
-	if (it != instance->stylesheets.end())
-		return it->second.get();
+	{
+		std::lock_guard<std::mutex> lock(instance->stylesheets_mutex);
+		auto it = instance->stylesheets.find(sheet_name);
+		if (it != instance->stylesheets.end())
+			return it->second.get();
+	}
 
-	// Don't currently have the sheet, attempt to load it
+	// Don't currently have the sheet, attempt to load it. The lock is released while loading so that documents can be prepared in parallel.
 	UniquePtr<const StyleSheetContainer> sheet = instance->LoadStyleSheetContainer(sheet_name);
 	if (!sheet)
 		return nullptr;
 
-	const StyleSheetContainer* result = sheet.get();
-
-	// Add it to the cache.
-	instance->stylesheets[sheet_name] = std::move(sheet);
+	// Add it to the cache, unless another thread loaded the same sheet in the meantime.
+	std::lock_guard<std::mutex> lock(instance->stylesheets_mutex);
+	UniquePtr<const StyleSheetContainer>& cached_sheet = instance->stylesheets[sheet_name];
+	if (!cached_sheet)
+		cached_sheet = std::move(sheet);
 
-	return result;
+	return cached_sheet.get();
 }
 
 void StyleSheetFactory::ClearStyleSheetCache()
 {
+	std::lock_guard<std::mutex> lock(instance->stylesheets_mutex);
 	instance->stylesheets.clear();
 }
 
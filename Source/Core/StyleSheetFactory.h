@@ -30,6 +30,7 @@
 #define RMLUI_CORE_STYLESHEETFACTORY_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
 
 namespace Rml {
 
@@ -74,6 +75,7 @@ private:
 	// Individual loaded stylesheets
 	using StyleSheets = UnorderedMap<String, UniquePtr<const StyleSheetContainer>>;
 	StyleSheets stylesheets;
+	std::mutex stylesheets_mutex;
 
 	// Custom complex selectors available for style sheets.
 	using SelectorMap = UnorderedMap<String, StructuralSelectorType>;
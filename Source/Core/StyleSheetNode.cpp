@@ -30,6 +30,7 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "ElementStyle.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetSelector.h"
 #include <algorithm>
@@ -39,22 +40,26 @@ namespace Rml {
 
 static inline bool IsTextElement(const Element* element)
 {
-	return element->GetTagName() == "#text";
+	static const Atom text_atom = AtomTable::Intern("#text");
+	return element->GetStyle()->GetTagAtom() == text_atom;
 }
 
 StyleSheetNode::StyleSheetNode()
 {
 	CalculateAndSetSpecificity();
+	CompileSelector();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, const CompoundSelector& selector) : parent(parent), selector(selector)
 {
 	CalculateAndSetSpecificity();
+	CompileSelector();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, CompoundSelector&& selector) : parent(parent), selector(std::move(selector))
 {
 	CalculateAndSetSpecificity();
+	CompileSelector();
 }
 
 StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(const CompoundSelector& other)
@@ -129,8 +134,8 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 	// If this has properties defined, then we insert it into the styled node index.
 	if (properties.GetNumProperties() > 0)
 	{
-		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, const String& key, const StyleSheetNode* node) {
-			StyleSheetIndex::NodeList& nodes = node_index[Hash<String>()(key)];
+		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, Atom key, const StyleSheetNode* node) {
+			StyleSheetIndex::NodeList& nodes = node_index[std::size_t(key)];
 			auto it = std::find(nodes.begin(), nodes.end(), node);
 			if (it == nodes.end())
 				nodes.push_back(node);
@@ -138,7 +143,7 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 
 		// Add this node to the appropriate index for looking up applicable nodes later. Prioritize the most unique requirement first and the most
 		// general requirement last. This way we are able to rule out as many nodes as possible as quickly as possible.
-		if (!selector.id.empty())
+		if (selector.id != Atom::Empty)
 		{
 			IndexInsertNode(styled_node_index.ids, selector.id, this);
 		}
@@ -148,7 +153,7 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 			// class with the most unique name. For example by adding the class from this node's list that has the fewest existing matches.
 			IndexInsertNode(styled_node_index.classes, selector.class_names.front(), this);
 		}
-		else if (!selector.tag.empty())
+		else if (selector.tag != Atom::Empty)
 		{
 			IndexInsertNode(styled_node_index.tags, selector.tag, this);
 		}
@@ -162,6 +167,45 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 		child->BuildIndex(styled_node_index);
 }
 
+void StyleSheetNode::BuildInvalidationIndex(StyleSheetIndex& styled_node_index, StyleSheetInvalidation inherited_invalidation) const
+{
+	// The names of a subject node affect the matched element itself. For all other nodes, the names affect the elements matched through the
+	// combinators of our children.
+	StyleSheetInvalidation invalidation = inherited_invalidation;
+	if (properties.GetNumProperties() > 0 || children.empty())
+		invalidation = invalidation | StyleSheetInvalidation::Self;
+
+	for (const auto& child : children)
+	{
+		const SelectorCombinator combinator = child->selector.combinator;
+		const bool sibling_combinator = (combinator == SelectorCombinator::NextSibling || combinator == SelectorCombinator::SubsequentSibling);
+		invalidation = invalidation | (sibling_combinator ? StyleSheetInvalidation::Siblings : StyleSheetInvalidation::Descendants);
+	}
+
+	auto AddInvalidation = [invalidation](StyleSheetIndex::InvalidationIndex& invalidation_index, Atom name) {
+		StyleSheetInvalidation& entry = invalidation_index[std::size_t(name)];
+		entry = entry | invalidation;
+	};
+
+	for (Atom name : selector.class_names)
+		AddInvalidation(styled_node_index.class_invalidation, name);
+	for (Atom name : selector.pseudo_class_names)
+		AddInvalidation(styled_node_index.pseudo_class_invalidation, name);
+	for (const AttributeSelector& attribute : selector.attributes)
+		AddInvalidation(styled_node_index.attribute_invalidation, AtomTable::Intern(attribute.name));
+
+	// Names in inner selectors such as in ':not()' are matched relative to the element of this node, thus they also affect all the elements
+	// affected by this node.
+	for (const StructuralSelector& structural_selector : selector.structural_selectors)
+	{
+		if (structural_selector.selector_tree)
+			structural_selector.selector_tree->root->BuildInvalidationIndex(styled_node_index, invalidation);
+	}
+
+	for (auto& child : children)
+		child->BuildInvalidationIndex(styled_node_index, inherited_invalidation);
+}
+
 int StyleSheetNode::GetSpecificity() const
 {
 	return specificity;
@@ -177,118 +221,122 @@ const PropertyDictionary& StyleSheetNode::GetProperties() const
 	return properties;
 }
 
-bool StyleSheetNode::Match(const Element* element) const
+bool StyleSheetNode::MatchAttributeValue(const Variant& variant, const AttributeSelector& attribute)
 {
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
-		return false;
-
-	if (!selector.id.empty() && selector.id != element->GetId())
-		return false;
-
-	for (auto& name : selector.class_names)
+	String buffer;
+	const String* element_value_ptr = &buffer;
+	if (variant.GetType() == Variant::STRING)
+		element_value_ptr = &variant.GetReference<String>();
+	else
+		variant.GetInto(buffer);
+
+	const String& element_value = *element_value_ptr;
+	const String& css_value = attribute.value;
+
+	auto BeginsWith = [](const String& target, const String& prefix) {
+		return prefix.size() <= target.size() && std::equal(prefix.begin(), prefix.end(), target.begin());
+	};
+	auto EndsWith = [](const String& target, const String& suffix) {
+		return suffix.size() <= target.size() && std::equal(suffix.rbegin(), suffix.rend(), target.rbegin());
+	};
+
+	switch (attribute.type)
 	{
-		if (!element->IsClassSet(name))
+	case AttributeSelectorType::Always: break;
+	case AttributeSelectorType::Equal:
+		if (element_value != css_value)
 			return false;
-	}
-
-	for (auto& name : selector.pseudo_class_names)
+		break;
+	case AttributeSelectorType::InList:
 	{
-		if (!element->IsPseudoClassSet(name))
+		bool found = false;
+		for (size_t index = element_value.find(css_value); index != String::npos; index = element_value.find(css_value, index + 1))
+		{
+			const size_t index_right = index + css_value.size();
+			const bool whitespace_left = (index == 0 || element_value[index - 1] == ' ');
+			const bool whitespace_right = (index_right == element_value.size() || element_value[index_right] == ' ');
+
+			if (whitespace_left && whitespace_right)
+			{
+				found = true;
+				break;
+			}
+		}
+		if (!found)
 			return false;
 	}
-
-	if (!selector.attributes.empty() && !MatchAttributes(element))
-		return false;
-
-	if (!selector.structural_selectors.empty() && !MatchStructuralSelector(element))
-		return false;
-
-	return true;
-}
-
-bool StyleSheetNode::MatchStructuralSelector(const Element* element) const
-{
-	for (auto& node_selector : selector.structural_selectors)
-	{
-		if (!IsSelectorApplicable(element, node_selector))
+	break;
+	case AttributeSelectorType::BeginsWithThenHyphen:
+		// Begins with 'css_value' followed by a hyphen, or matches exactly.
+		if (!BeginsWith(element_value, css_value) || (element_value.size() != css_value.size() && element_value[css_value.size()] != '-'))
 			return false;
+		break;
+	case AttributeSelectorType::BeginsWith:
+		if (!BeginsWith(element_value, css_value))
+			return false;
+		break;
+	case AttributeSelectorType::EndsWith:
+		if (!EndsWith(element_value, css_value))
+			return false;
+		break;
+	case AttributeSelectorType::Contains:
+		if (element_value.find(css_value) == String::npos)
+			return false;
+		break;
 	}
 
 	return true;
 }
 
-bool StyleSheetNode::MatchAttributes(const Element* element) const
+bool StyleSheetNode::Match(const Element* element, bool index_key_matched) const
 {
-	for (const AttributeSelector& attribute : selector.attributes)
-	{
-		const Variant* variant = element->GetAttribute(attribute.name);
-		if (!variant)
-			return false;
-		if (attribute.type == AttributeSelectorType::Always)
-			continue;
-
-		String buffer;
-		const String* element_value_ptr = &buffer;
-		if (variant->GetType() == Variant::STRING)
-			element_value_ptr = &variant->GetReference<String>();
-		else
-			variant->GetInto(buffer);
+	const size_t num_ops = (index_key_matched ? compiled_selector.num_unindexed_ops : compiled_selector.ops.size());
+	if (num_ops == 0)
+		return true;
 
-		const String& element_value = *element_value_ptr;
-		const String& css_value = attribute.value;
+	const ElementStyle* style = element->GetStyle();
 
-		auto BeginsWith = [](const String& target, const String& prefix) {
-			return prefix.size() <= target.size() && std::equal(prefix.begin(), prefix.end(), target.begin());
-		};
-		auto EndsWith = [](const String& target, const String& suffix) {
-			return suffix.size() <= target.size() && std::equal(suffix.rbegin(), suffix.rend(), target.rbegin());
-		};
+	// Reject elements which don't have enough names set to possibly match, before doing any lookups.
+	if (compiled_selector.num_pseudo_classes > style->GetActivePseudoClasses().size() ||
+		compiled_selector.num_classes > style->GetClassNameList().size())
+		return false;
 
-		switch (attribute.type)
+	for (size_t i = 0; i < num_ops; i++)
+	{
+		const SelectorMatchOp& op = compiled_selector.ops[i];
+		switch (op.type)
 		{
-		case AttributeSelectorType::Always: break;
-		case AttributeSelectorType::Equal:
-			if (element_value != css_value)
+		case SelectorMatchOpType::Id:
+			if (style->GetIdAtom() != Atom(op.operand))
 				return false;
 			break;
-		case AttributeSelectorType::InList:
-		{
-			bool found = false;
-			for (size_t index = element_value.find(css_value); index != String::npos; index = element_value.find(css_value, index + 1))
-			{
-				const size_t index_right = index + css_value.size();
-				const bool whitespace_left = (index == 0 || element_value[index - 1] == ' ');
-				const bool whitespace_right = (index_right == element_value.size() || element_value[index_right] == ' ');
-
-				if (whitespace_left && whitespace_right)
-				{
-					found = true;
-					break;
-				}
-			}
-			if (!found)
-				return false;
-		}
-		break;
-		case AttributeSelectorType::BeginsWithThenHyphen:
-			// Begins with 'css_value' followed by a hyphen, or matches exactly.
-			if (!BeginsWith(element_value, css_value) || (element_value.size() != css_value.size() && element_value[css_value.size()] != '-'))
+		case SelectorMatchOpType::Tag:
+			if (style->GetTagAtom() != Atom(op.operand))
 				return false;
 			break;
-		case AttributeSelectorType::BeginsWith:
-			if (!BeginsWith(element_value, css_value))
+		case SelectorMatchOpType::PseudoClass:
+			if (!style->IsPseudoClassSet(Atom(op.operand)))
 				return false;
 			break;
-		case AttributeSelectorType::EndsWith:
-			if (!EndsWith(element_value, css_value))
+		case SelectorMatchOpType::Class:
+			if (!style->IsClassSet(Atom(op.operand)))
 				return false;
 			break;
-		case AttributeSelectorType::Contains:
-			if (element_value.find(css_value) == String::npos)
+		case SelectorMatchOpType::Attribute:
+		{
+			const AttributeSelector& attribute = selector.attributes[op.operand];
+			const Variant* variant = element->GetAttribute(attribute.name);
+			if (!variant || (attribute.type != AttributeSelectorType::Always && !MatchAttributeValue(*variant, attribute)))
+				return false;
+		}
+		break;
+		case SelectorMatchOpType::Structural:
+			if (!IsSelectorApplicable(element, selector.structural_selectors[op.operand]))
 				return false;
 			break;
 		}
 	}
+
 	return true;
 }
 
@@ -359,35 +407,21 @@ bool StyleSheetNode::IsApplicable(const Element* element) const
 {
 	// Determine whether the element matches the current node and its entire lineage. The entire hierarchy of the element's document will be
 	// considered during the match as necessary.
-
-	// We could in principle just call Match() here and then go on with the ancestor style nodes. Instead, we test the requirements of this node in a
-	// particular order for performance reasons.
-	for (const String& name : selector.pseudo_class_names)
-	{
-		if (!element->IsPseudoClassSet(name))
-			return false;
-	}
-
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
+	if (!Match(element))
 		return false;
 
-	for (const String& name : selector.class_names)
-	{
-		if (!element->IsClassSet(name))
-			return false;
-	}
-
-	if (!selector.id.empty() && selector.id != element->GetId())
+	// Walk up through all our parent nodes, each one of them must be matched by some ancestor or sibling element.
+	if (parent && !TraverseMatch(element))
 		return false;
 
-	if (!selector.attributes.empty() && !MatchAttributes(element))
-		return false;
+	return true;
+}
 
-	// Check the structural selector requirements last as they can be quite slow.
-	if (!selector.structural_selectors.empty() && !MatchStructuralSelector(element))
+bool StyleSheetNode::IsApplicableIndexed(const Element* element) const
+{
+	if (!Match(element, true))
 		return false;
 
-	// Walk up through all our parent nodes, each one of them must be matched by some ancestor or sibling element.
 	if (parent && !TraverseMatch(element))
 		return false;
 
@@ -399,10 +433,10 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 	// First calculate the specificity of this node alone.
 	specificity = 0;
 
-	if (!selector.tag.empty())
+	if (selector.tag != Atom::Empty)
 		specificity += SelectorSpecificity::Tag;
 
-	if (!selector.id.empty())
+	if (selector.id != Atom::Empty)
 		specificity += SelectorSpecificity::ID;
 
 	specificity += SelectorSpecificity::Class * (int)selector.class_names.size();
@@ -417,4 +451,54 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 		specificity += parent->specificity;
 }
 
+void StyleSheetNode::CompileSelector()
+{
+	compiled_selector = {};
+
+	auto CountDistinct = [](AtomList names) {
+		std::sort(names.begin(), names.end());
+		return uint16_t(std::unique(names.begin(), names.end()) - names.begin());
+	};
+
+	compiled_selector.num_classes = CountDistinct(selector.class_names);
+	compiled_selector.num_pseudo_classes = CountDistinct(selector.pseudo_class_names);
+
+	// The requirement used to index this node, as chosen in BuildIndex().
+	SelectorMatchOp index_key = {};
+	bool has_index_key = true;
+	if (selector.id != Atom::Empty)
+		index_key = {SelectorMatchOpType::Id, uint32_t(selector.id)};
+	else if (!selector.class_names.empty())
+		index_key = {SelectorMatchOpType::Class, uint32_t(selector.class_names.front())};
+	else if (selector.tag != Atom::Empty)
+		index_key = {SelectorMatchOpType::Tag, uint32_t(selector.tag)};
+	else
+		has_index_key = false;
+
+	Vector<SelectorMatchOp>& ops = compiled_selector.ops;
+	auto AddOp = [&](SelectorMatchOpType type, uint32_t operand) {
+		if (!has_index_key || type != index_key.type || operand != index_key.operand)
+			ops.push_back({type, operand});
+	};
+
+	// Start with the integer comparisons. Then test pseudo-classes, as they are rarely set. Then classes, which are searched linearly, followed by
+	// attributes, which require string lookups. Structural selectors go last, as they may need to visit the element's siblings.
+	if (selector.id != Atom::Empty)
+		AddOp(SelectorMatchOpType::Id, uint32_t(selector.id));
+	if (selector.tag != Atom::Empty)
+		AddOp(SelectorMatchOpType::Tag, uint32_t(selector.tag));
+	for (Atom name : selector.pseudo_class_names)
+		AddOp(SelectorMatchOpType::PseudoClass, uint32_t(name));
+	for (Atom name : selector.class_names)
+		AddOp(SelectorMatchOpType::Class, uint32_t(name));
+	for (size_t i = 0; i < selector.attributes.size(); i++)
+		AddOp(SelectorMatchOpType::Attribute, uint32_t(i));
+	for (size_t i = 0; i < selector.structural_selectors.size(); i++)
+		AddOp(SelectorMatchOpType::Structural, uint32_t(i));
+
+	compiled_selector.num_unindexed_ops = uint32_t(ops.size());
+	if (has_index_key)
+		ops.push_back(index_key);
+}
+
 } // namespace Rml
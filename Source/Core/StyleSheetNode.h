@@ -30,12 +30,12 @@
 #define RMLUI_CORE_STYLESHEETNODE_H
 
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
+#include "../../Include/RmlUi/Core/StyleSheetTypes.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "StyleSheetSelector.h"
 
 namespace Rml {
 
-struct StyleSheetIndex;
 class StyleSheetNode;
 using StyleSheetNodeList = Vector<UniquePtr<StyleSheetNode>>;
 
@@ -61,7 +61,12 @@ public:
 	/// Copy this node including all descendent nodes.
 	UniquePtr<StyleSheetNode> DeepCopy(StyleSheetNode* parent = nullptr) const;
 	/// Builds up a style sheet's index recursively.
+	/// @note Nodes are indexed by their id, else their first class, else their tag. Use 'IsApplicableIndexed' for nodes found through the index.
 	void BuildIndex(StyleSheetIndex& styled_node_index) const;
+	/// Builds up the invalidation sets of a style sheet's index recursively, from the names in the selectors of this node and its descendants.
+	/// @param[in] inherited_invalidation Elements affected by all names in the hierarchy, used for the inner selectors of structural selectors.
+	void BuildInvalidationIndex(StyleSheetIndex& styled_node_index,
+		StyleSheetInvalidation inherited_invalidation = StyleSheetInvalidation::None) const;
 
 	/// Imports properties from a single rule definition into the node's properties and sets the appropriate specificity on them. Any existing
 	/// attributes sharing a key with a new attribute will be overwritten if they are of a lower specificity.
@@ -75,17 +80,21 @@ public:
 	/// @note For performance reasons this call does not check whether 'element' is a text element. The caller must manually check this condition and
 	/// consider any text element not applicable.
 	bool IsApplicable(const Element* element) const;
+	/// Returns true if this node is applicable to the given element, where the node was found by looking up the element in the style sheet index.
+	/// @note The requirement used as the index key is assumed to match, and not tested again.
+	bool IsApplicableIndexed(const Element* element) const;
 
 	/// Returns the specificity of this node.
 	int GetSpecificity() const;
 
 private:
 	void CalculateAndSetSpecificity();
+	void CompileSelector();
 
-	// Match an element to the local node requirements.
-	inline bool Match(const Element* element) const;
-	inline bool MatchStructuralSelector(const Element* element) const;
-	inline bool MatchAttributes(const Element* element) const;
+	// Match an element to the local node requirements, optionally skipping the requirement matched by the style sheet index.
+	inline bool Match(const Element* element, bool index_key_matched = false) const;
+	// Kept out of line, so that the common requirements are matched without the setup needed for comparing attribute values.
+	static bool MatchAttributeValue(const Variant& variant, const AttributeSelector& attribute);
 
 	// Recursively traverse the nodes up towards the root to match the element and its hierarchy.
 	bool TraverseMatch(const Element* element) const;
@@ -95,6 +104,8 @@ private:
 
 	// Node requirements
 	CompoundSelector selector;
+	// The node requirements compiled for matching, derived from the selector on construction.
+	CompiledSelector compiled_selector;
 
 	// A measure of specificity of this node; the attribute in a node with a higher value will override those of a node with a lower value.
 	int specificity = 0;
@@ -33,7 +33,7 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
 #include "../../Include/RmlUi/Core/PropertySpecification.h"
-#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/Stream.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetContainer.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
@@ -41,6 +41,7 @@
 #include "StyleSheetFactory.h"
 #include "StyleSheetNode.h"
 #include <algorithm>
+#include <mutex>
 #include <string.h>
 
 namespace Rml {
@@ -53,6 +54,25 @@ public:
 	virtual bool Parse(const String& name, const String& value) = 0;
 };
 
+struct StyleSheetParser::TokenSet {
+	enum class Type : uint8_t { Plain, Token, Special };
+
+	TokenSet(const char* tokens)
+	{
+		for (Type& type : types)
+			type = Type::Plain;
+		// Newlines are counted and comments skipped while scanning, thus we need to stop at their first character.
+		types[(unsigned char)'\n'] = Type::Special;
+		types[(unsigned char)'/'] = Type::Special;
+		for (; *tokens; ++tokens)
+			types[(unsigned char)*tokens] = Type::Token;
+	}
+
+	Type operator[](char character) const { return types[(unsigned char)character]; }
+
+	Type types[256];
+};
+
 /*
  *  PropertySpecificationParser just passes the parsing to a property specification. Usually
  *    the main stylesheet specification, except for e.g. @decorator blocks.
@@ -210,11 +230,14 @@ public:
 
 static UniquePtr<MediaQueryPropertyParser> media_query_property_parser;
 
+// Guards the stateful global parsers above, so that style sheets can be parsed from multiple threads.
+static std::mutex global_parsers_mutex;
+
 StyleSheetParser::StyleSheetParser()
 {
 	line_number = 0;
-	stream = nullptr;
-	parse_buffer_pos = 0;
+	parse_pos = nullptr;
+	parse_end = nullptr;
 }
 
 StyleSheetParser::~StyleSheetParser() {}
@@ -399,6 +422,7 @@ bool StyleSheetParser::ParseDecoratorBlock(const String& at_name, NamedDecorator
 
 bool StyleSheetParser::ParseMediaFeatureMap(const String& rules, PropertyDictionary& properties, MediaQueryModifier& modifier)
 {
+	std::lock_guard<std::mutex> lock(global_parsers_mutex);
 	media_query_property_parser->SetTargetProperties(&properties);
 
 	enum ParseState { Global, Name, Value };
@@ -516,15 +540,22 @@ bool StyleSheetParser::ParseMediaFeatureMap(const String& rules, PropertyDiction
 	return true;
 }
 
-bool StyleSheetParser::Parse(MediaBlockList& style_sheets, Stream* _stream, int begin_line_number)
+bool StyleSheetParser::Parse(MediaBlockList& style_sheets, Stream* stream, int begin_line_number)
 {
 	RMLUI_ZoneScoped;
 
+	static const TokenSet rule_tokens("{@}");
+
 	int rule_count = 0;
 	line_number = begin_line_number;
-	stream = _stream;
 	stream_file_name = StringUtilities::Replace(stream->GetSourceURL().GetURL(), '|', ':');
 
+	// Read the whole stream at once, so that we can scan through it without refilling any buffers.
+	parse_buffer.clear();
+	stream->Read(parse_buffer, stream->Length() - stream->Tell());
+	parse_pos = parse_buffer.data();
+	parse_end = parse_pos + parse_buffer.size();
+
 	enum class State { Global, AtRuleIdentifier, KeyframeBlock, Invalid };
 	State state = State::Global;
 
@@ -536,211 +567,206 @@ bool StyleSheetParser::Parse(MediaBlockList& style_sheets, Stream* _stream, int
 	// At-rules given by the following syntax in global space: @identifier name { block }
 	String at_rule_name;
 
-	// Look for more styles while data is available
-	while (FillBuffer())
-	{
-		String pre_token_str;
+	// Look for more styles until the end of the source
+	String pre_token_str;
 
-		while (char token = FindToken(pre_token_str, "{@}", true))
+	while (char token = FindToken(pre_token_str, rule_tokens, true))
+	{
+		switch (state)
 		{
-			switch (state)
-			{
-			case State::Global:
+		case State::Global:
+		{
+			if (token == '{')
 			{
-				if (token == '{')
+				// Initialize current block if not present
+				if (!current_block.stylesheet)
 				{
-					// Initialize current block if not present
-					if (!current_block.stylesheet)
-					{
-						current_block = MediaBlock{PropertyDictionary{}, UniquePtr<StyleSheet>(new StyleSheet()), MediaQueryModifier::None};
-					}
+					current_block = MediaBlock{PropertyDictionary{}, UniquePtr<StyleSheet>(new StyleSheet()), MediaQueryModifier::None};
+				}
 
-					const int rule_line_number = line_number;
+				const int rule_line_number = line_number;
 
-					// Read the attributes
-					PropertyDictionary properties;
-					PropertySpecificationParser parser(properties, StyleSheetSpecification::GetPropertySpecification());
-					if (!ReadProperties(parser))
-						continue;
+				// Read the attributes
+				PropertyDictionary properties;
+				PropertySpecificationParser parser(properties, StyleSheetSpecification::GetPropertySpecification());
+				if (!ReadProperties(parser))
+					continue;
 
-					StringList rule_name_list;
-					StringUtilities::ExpandString(rule_name_list, pre_token_str, ',', '(', ')');
+				StringList rule_name_list;
+				StringUtilities::ExpandString(rule_name_list, pre_token_str, ',', '(', ')');
 
-					// Add style nodes to the root of the tree
-					for (size_t i = 0; i < rule_name_list.size(); i++)
+				// Add style nodes to the root of the tree
+				for (size_t i = 0; i < rule_name_list.size(); i++)
+				{
+					auto source = MakeShared<PropertySource>(stream_file_name, rule_line_number, rule_name_list[i]);
+					properties.SetSourceOfAllProperties(source);
+					if (!ImportProperties(current_block.stylesheet->root.get(), rule_name_list[i], properties, rule_count))
 					{
-						auto source = MakeShared<PropertySource>(stream_file_name, rule_line_number, rule_name_list[i]);
-						properties.SetSourceOfAllProperties(source);
-						if (!ImportProperties(current_block.stylesheet->root.get(), rule_name_list[i], properties, rule_count))
-						{
-							Log::Message(Log::LT_WARNING, "Invalid selector '%s' encountered while parsing stylesheet at %s:%d.",
-								rule_name_list[i].c_str(), stream_file_name.c_str(), line_number);
-						}
+						Log::Message(Log::LT_WARNING, "Invalid selector '%s' encountered while parsing stylesheet at %s:%d.",
+							rule_name_list[i].c_str(), stream_file_name.c_str(), line_number);
 					}
-
-					rule_count++;
 				}
-				else if (token == '@')
+
+				rule_count++;
+			}
+			else if (token == '@')
+			{
+				state = State::AtRuleIdentifier;
+			}
+			else if (inside_media_block && token == '}')
+			{
+				// Complete current block
+				PostprocessKeyframes(current_block.stylesheet->keyframes);
+				current_block.stylesheet->specificity_offset = rule_count;
+				style_sheets.push_back(std::move(current_block));
+				current_block = {};
+
+				inside_media_block = false;
+				break;
+			}
+			else
+			{
+				Log::Message(Log::LT_WARNING, "Invalid character '%c' found while parsing stylesheet at %s:%d. Trying to proceed.", token,
+					stream_file_name.c_str(), line_number);
+			}
+		}
+		break;
+		case State::AtRuleIdentifier:
+		{
+			if (token == '{')
+			{
+				// Initialize current block if not present
+				if (!current_block.stylesheet)
 				{
-					state = State::AtRuleIdentifier;
+					current_block = {PropertyDictionary{}, UniquePtr<StyleSheet>(new StyleSheet()), MediaQueryModifier::None};
 				}
-				else if (inside_media_block && token == '}')
+
+				const String at_rule_identifier = StringUtilities::StripWhitespace(pre_token_str.substr(0, pre_token_str.find(' ')));
+				at_rule_name = StringUtilities::StripWhitespace(pre_token_str.substr(at_rule_identifier.size()));
+
+				if (at_rule_identifier == "keyframes")
 				{
-					// Complete current block
-					PostprocessKeyframes(current_block.stylesheet->keyframes);
-					current_block.stylesheet->specificity_offset = rule_count;
-					style_sheets.push_back(std::move(current_block));
-					current_block = {};
-
-					inside_media_block = false;
-					break;
+					state = State::KeyframeBlock;
 				}
-				else
+				else if (at_rule_identifier == "decorator")
 				{
-					Log::Message(Log::LT_WARNING, "Invalid character '%c' found while parsing stylesheet at %s:%d. Trying to proceed.", token,
-						stream_file_name.c_str(), line_number);
+					auto source = MakeShared<PropertySource>(stream_file_name, (int)line_number, pre_token_str);
+					ParseDecoratorBlock(at_rule_name, current_block.stylesheet->named_decorator_map, source);
+
+					at_rule_name.clear();
+					state = State::Global;
 				}
-			}
-			break;
-			case State::AtRuleIdentifier:
-			{
-				if (token == '{')
+				else if (at_rule_identifier == "spritesheet")
 				{
-					// Initialize current block if not present
-					if (!current_block.stylesheet)
-					{
-						current_block = {PropertyDictionary{}, UniquePtr<StyleSheet>(new StyleSheet()), MediaQueryModifier::None};
-					}
+					// The spritesheet parser is reasonably heavy to initialize, so we make it a static global.
+					std::lock_guard<std::mutex> lock(global_parsers_mutex);
+					ReadProperties(*spritesheet_property_parser);
 
-					const String at_rule_identifier = StringUtilities::StripWhitespace(pre_token_str.substr(0, pre_token_str.find(' ')));
-					at_rule_name = StringUtilities::StripWhitespace(pre_token_str.substr(at_rule_identifier.size()));
+					const String& image_source = spritesheet_property_parser->GetImageSource();
+					const SpriteDefinitionList& sprite_definitions = spritesheet_property_parser->GetSpriteDefinitions();
+					const float image_resolution_factor = spritesheet_property_parser->GetImageResolutionFactor();
 
-					if (at_rule_identifier == "keyframes")
+					if (sprite_definitions.empty())
 					{
-						state = State::KeyframeBlock;
+						Log::Message(Log::LT_WARNING, "Spritesheet '%s' has no sprites defined, ignored. At %s:%d", at_rule_name.c_str(),
+							stream_file_name.c_str(), line_number);
 					}
-					else if (at_rule_identifier == "decorator")
+					else if (image_source.empty())
 					{
-						auto source = MakeShared<PropertySource>(stream_file_name, (int)line_number, pre_token_str);
-						ParseDecoratorBlock(at_rule_name, current_block.stylesheet->named_decorator_map, source);
-
-						at_rule_name.clear();
-						state = State::Global;
+						Log::Message(Log::LT_WARNING, "No image source (property 'src') specified for spritesheet '%s'. At %s:%d",
+							at_rule_name.c_str(), stream_file_name.c_str(), line_number);
 					}
-					else if (at_rule_identifier == "spritesheet")
+					else if (image_resolution_factor <= 0.0f || image_resolution_factor >= 100.f)
 					{
-						// The spritesheet parser is reasonably heavy to initialize, so we make it a static global.
-						ReadProperties(*spritesheet_property_parser);
-
-						const String& image_source = spritesheet_property_parser->GetImageSource();
-						const SpriteDefinitionList& sprite_definitions = spritesheet_property_parser->GetSpriteDefinitions();
-						const float image_resolution_factor = spritesheet_property_parser->GetImageResolutionFactor();
-
-						if (sprite_definitions.empty())
-						{
-							Log::Message(Log::LT_WARNING, "Spritesheet '%s' has no sprites defined, ignored. At %s:%d", at_rule_name.c_str(),
-								stream_file_name.c_str(), line_number);
-						}
-						else if (image_source.empty())
-						{
-							Log::Message(Log::LT_WARNING, "No image source (property 'src') specified for spritesheet '%s'. At %s:%d",
-								at_rule_name.c_str(), stream_file_name.c_str(), line_number);
-						}
-						else if (image_resolution_factor <= 0.0f || image_resolution_factor >= 100.f)
-						{
-							Log::Message(Log::LT_WARNING,
-								"Spritesheet resolution (property 'resolution') value must be larger than 0.0 and smaller than 100.0, given %g. In "
-								"spritesheet '%s'. At %s:%d",
-								image_resolution_factor, at_rule_name.c_str(), stream_file_name.c_str(), line_number);
-						}
-						else
-						{
-							const float display_scale = 1.0f / image_resolution_factor;
-							current_block.stylesheet->spritesheet_list.AddSpriteSheet(at_rule_name, image_source, stream_file_name, (int)line_number,
-								display_scale, sprite_definitions);
-						}
-
-						spritesheet_property_parser->Clear();
-						at_rule_name.clear();
-						state = State::Global;
-					}
-					else if (at_rule_identifier == "media")
-					{
-						// complete the current "global" block if present and start a new block
-						if (current_block.stylesheet)
-						{
-							PostprocessKeyframes(current_block.stylesheet->keyframes);
-							current_block.stylesheet->specificity_offset = rule_count;
-							style_sheets.push_back(std::move(current_block));
-							current_block = {};
-						}
-
-						// parse media query list into block
-						PropertyDictionary feature_map;
-						MediaQueryModifier modifier;
-						ParseMediaFeatureMap(at_rule_name, feature_map, modifier);
-						current_block = {std::move(feature_map), UniquePtr<StyleSheet>(new StyleSheet()), modifier};
-
-						inside_media_block = true;
-						state = State::Global;
+						Log::Message(Log::LT_WARNING,
+							"Spritesheet resolution (property 'resolution') value must be larger than 0.0 and smaller than 100.0, given %g. In "
+							"spritesheet '%s'. At %s:%d",
+							image_resolution_factor, at_rule_name.c_str(), stream_file_name.c_str(), line_number);
 					}
 					else
 					{
-						// Invalid identifier, should ignore
-						at_rule_name.clear();
-						state = State::Global;
-						Log::Message(Log::LT_WARNING, "Invalid at-rule identifier '%s' found in stylesheet at %s:%d", at_rule_identifier.c_str(),
-							stream_file_name.c_str(), line_number);
+						const float display_scale = 1.0f / image_resolution_factor;
+						current_block.stylesheet->spritesheet_list.AddSpriteSheet(at_rule_name, image_source, stream_file_name, (int)line_number,
+							display_scale, sprite_definitions);
 					}
+
+					spritesheet_property_parser->Clear();
+					at_rule_name.clear();
+					state = State::Global;
 				}
-				else
-				{
-					Log::Message(Log::LT_WARNING, "Invalid character '%c' found while parsing at-rule identifier in stylesheet at %s:%d", token,
-						stream_file_name.c_str(), line_number);
-					state = State::Invalid;
-				}
-			}
-			break;
-			case State::KeyframeBlock:
-			{
-				if (token == '{')
+				else if (at_rule_identifier == "media")
 				{
-					// Initialize current block if not present
-					if (!current_block.stylesheet)
+					// complete the current "global" block if present and start a new block
+					if (current_block.stylesheet)
 					{
-						current_block = {PropertyDictionary{}, UniquePtr<StyleSheet>(new StyleSheet()), MediaQueryModifier::None};
+						PostprocessKeyframes(current_block.stylesheet->keyframes);
+						current_block.stylesheet->specificity_offset = rule_count;
+						style_sheets.push_back(std::move(current_block));
+						current_block = {};
 					}
 
-					// Each keyframe in keyframes has its own block which is processed here
-					PropertyDictionary properties;
-					PropertySpecificationParser parser(properties, StyleSheetSpecification::GetPropertySpecification());
-					if (!ReadProperties(parser))
-						continue;
+					// parse media query list into block
+					PropertyDictionary feature_map;
+					MediaQueryModifier modifier;
+					ParseMediaFeatureMap(at_rule_name, feature_map, modifier);
+					current_block = {std::move(feature_map), UniquePtr<StyleSheet>(new StyleSheet()), modifier};
 
-					if (!ParseKeyframeBlock(current_block.stylesheet->keyframes, at_rule_name, pre_token_str, properties))
-						continue;
-				}
-				else if (token == '}')
-				{
-					at_rule_name.clear();
+					inside_media_block = true;
 					state = State::Global;
 				}
 				else
 				{
-					Log::Message(Log::LT_WARNING, "Invalid character '%c' found while parsing keyframe block in stylesheet at %s:%d", token,
+					// Invalid identifier, should ignore
+					at_rule_name.clear();
+					state = State::Global;
+					Log::Message(Log::LT_WARNING, "Invalid at-rule identifier '%s' found in stylesheet at %s:%d", at_rule_identifier.c_str(),
 						stream_file_name.c_str(), line_number);
-					state = State::Invalid;
 				}
 			}
-			break;
-			default:
-				RMLUI_ERROR;
+			else
+			{
+				Log::Message(Log::LT_WARNING, "Invalid character '%c' found while parsing at-rule identifier in stylesheet at %s:%d", token,
+					stream_file_name.c_str(), line_number);
 				state = State::Invalid;
-				break;
 			}
+		}
+		break;
+		case State::KeyframeBlock:
+		{
+			if (token == '{')
+			{
+				// Initialize current block if not present
+				if (!current_block.stylesheet)
+				{
+					current_block = {PropertyDictionary{}, UniquePtr<StyleSheet>(new StyleSheet()), MediaQueryModifier::None};
+				}
 
-			if (state == State::Invalid)
-				break;
+				// Each keyframe in keyframes has its own block which is processed here
+				PropertyDictionary properties;
+				PropertySpecificationParser parser(properties, StyleSheetSpecification::GetPropertySpecification());
+				if (!ReadProperties(parser))
+					continue;
+
+				if (!ParseKeyframeBlock(current_block.stylesheet->keyframes, at_rule_name, pre_token_str, properties))
+					continue;
+			}
+			else if (token == '}')
+			{
+				at_rule_name.clear();
+				state = State::Global;
+			}
+			else
+			{
+				Log::Message(Log::LT_WARNING, "Invalid character '%c' found while parsing keyframe block in stylesheet at %s:%d", token,
+					stream_file_name.c_str(), line_number);
+				state = State::Invalid;
+			}
+		}
+		break;
+		default:
+			RMLUI_ERROR;
+			state = State::Invalid;
+			break;
 		}
 
 		if (state == State::Invalid)
@@ -755,17 +781,24 @@ bool StyleSheetParser::Parse(MediaBlockList& style_sheets, Stream* _stream, int
 		style_sheets.push_back(std::move(current_block));
 	}
 
+	parse_pos = nullptr;
+	parse_end = nullptr;
+	String().swap(parse_buffer);
+
 	return !style_sheets.empty();
 }
 
 bool StyleSheetParser::ParseProperties(PropertyDictionary& parsed_properties, const String& properties)
 {
-	RMLUI_ASSERT(!stream);
-	StreamMemory stream_owner((const byte*)properties.c_str(), properties.size());
-	stream = &stream_owner;
+	RMLUI_ASSERT(!parse_pos);
+
+	// Parse directly from the given string, there is no need to copy it into our buffer.
+	parse_pos = properties.data();
+	parse_end = parse_pos + properties.size();
 	PropertySpecificationParser parser(parsed_properties, StyleSheetSpecification::GetPropertySpecification());
 	bool success = ReadProperties(parser);
-	stream = nullptr;
+	parse_pos = nullptr;
+	parse_end = nullptr;
 	return success;
 }
 
@@ -795,17 +828,25 @@ bool StyleSheetParser::ReadProperties(AbstractPropertyParser& property_parser)
 {
 	RMLUI_ZoneScoped;
 
+	static const TokenSet name_tokens(";}:");
+	static const TokenSet value_tokens(";}\"");
+	static const TokenSet quote_tokens("\"}");
+
 	String name;
 	String value;
 
 	enum ParseState { NAME, VALUE, QUOTE };
 	ParseState state = NAME;
 
-	char character;
-	char previous_character = 0;
-	while (ReadCharacter(character))
+	bool end_of_rule = false;
+	while (!end_of_rule)
 	{
-		parse_buffer_pos++;
+		const TokenSet& tokens = (state == NAME ? name_tokens : (state == VALUE ? value_tokens : quote_tokens));
+		const char character = ReadUntilToken(state == NAME ? name : value, tokens);
+		if (!character)
+			break;
+
+		parse_pos++;
 
 		switch (state)
 		{
@@ -834,8 +875,6 @@ bool StyleSheetParser::ReadProperties(AbstractPropertyParser& property_parser)
 				name = StringUtilities::StripWhitespace(name);
 				state = VALUE;
 			}
-			else
-				name += character;
 		}
 		break;
 
@@ -855,29 +894,28 @@ bool StyleSheetParser::ReadProperties(AbstractPropertyParser& property_parser)
 			}
 			else if (character == '}')
 			{
-				break;
+				end_of_rule = true;
 			}
-			else
+			else if (character == '"')
 			{
 				value += character;
-				if (character == '"')
-					state = QUOTE;
+				state = QUOTE;
 			}
 		}
 		break;
 
 		case QUOTE:
 		{
+			// Quotes may be escaped, the opening quote is always part of the value thus there is a previous character.
+			const char previous_character = value.back();
 			value += character;
-			if (character == '"' && previous_character != '\\')
+			if (character == '}')
+				end_of_rule = true;
+			else if (previous_character != '\\')
 				state = VALUE;
 		}
 		break;
 		}
-
-		if (character == '}')
-			break;
-		previous_character = character;
 	}
 
 	if (state == VALUE && !name.empty() && !value.empty())
@@ -964,8 +1002,8 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 
 				switch (rule[start_index])
 				{
-				case '#': selector.id = String(p_begin + 1, p_end); break;
-				case '.': selector.class_names.push_back(String(p_begin + 1, p_end)); break;
+				case '#': selector.id = AtomTable::Intern(String(p_begin + 1, p_end)); break;
+				case '.': selector.class_names.push_back(AtomTable::Intern(String(p_begin + 1, p_end))); break;
 				case ':':
 				{
 					String pseudo_class_name = String(p_begin + 1, p_end);
@@ -973,7 +1011,7 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 					if (node_selector.type != StructuralSelectorType::Invalid)
 						selector.structural_selectors.push_back(node_selector);
 					else
-						selector.pseudo_class_names.push_back(std::move(pseudo_class_name));
+						selector.pseudo_class_names.push_back(AtomTable::Intern(pseudo_class_name));
 				}
 				break;
 				case '[':
@@ -1011,7 +1049,7 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 					selector.attributes.push_back(std::move(attribute));
 				}
 				break;
-				default: selector.tag = String(p_begin, p_end); break;
+				default: selector.tag = AtomTable::Intern(String(p_begin, p_end)); break;
 				}
 			}
 
@@ -1039,113 +1077,61 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 	return leaf_node;
 }
 
-char StyleSheetParser::FindToken(String& buffer, const char* tokens, bool remove_token)
+char StyleSheetParser::FindToken(String& buffer, const TokenSet& tokens, bool remove_token)
 {
 	buffer.clear();
-	char character;
-	while (ReadCharacter(character))
-	{
-		if (strchr(tokens, character) != nullptr)
-		{
-			if (remove_token)
-				parse_buffer_pos++;
-			return character;
-		}
-		else
-		{
-			buffer += character;
-			parse_buffer_pos++;
-		}
-	}
 
-	return 0;
+	const char token = ReadUntilToken(buffer, tokens);
+	if (token && remove_token)
+		parse_pos++;
+
+	return token;
 }
 
-bool StyleSheetParser::ReadCharacter(char& buffer)
+char StyleSheetParser::ReadUntilToken(String& buffer, const TokenSet& tokens)
 {
-	bool comment = false;
-
-	// Continuously fill the buffer until either we run out of
-	// stream or we find the requested token
-	do
+	while (parse_pos < parse_end)
 	{
-		while (parse_buffer_pos < parse_buffer.size())
-		{
-			if (parse_buffer[parse_buffer_pos] == '\n')
-				line_number++;
-			else if (comment)
-			{
-				// Check for closing comment
-				if (parse_buffer[parse_buffer_pos] == '*')
-				{
-					parse_buffer_pos++;
-					if (parse_buffer_pos >= parse_buffer.size())
-					{
-						if (!FillBuffer())
-							return false;
-					}
+		// Scan through the plain characters in a tight loop, and append them all at once.
+		const char* run_begin = parse_pos;
+		while (parse_pos < parse_end && tokens[*parse_pos] == TokenSet::Type::Plain)
+			parse_pos++;
 
-					if (parse_buffer[parse_buffer_pos] == '/')
-						comment = false;
-				}
-			}
-			else
-			{
-				// Check for an opening comment
-				if (parse_buffer[parse_buffer_pos] == '/')
-				{
-					parse_buffer_pos++;
-					if (parse_buffer_pos >= parse_buffer.size())
-					{
-						if (!FillBuffer())
-						{
-							buffer = '/';
-							parse_buffer = "/";
-							return true;
-						}
-					}
+		buffer.append(run_begin, parse_pos);
 
-					if (parse_buffer[parse_buffer_pos] == '*')
-						comment = true;
-					else
-					{
-						buffer = '/';
-						if (parse_buffer_pos == 0)
-							parse_buffer.insert(parse_buffer_pos, 1, '/');
-						else
-							parse_buffer_pos--;
-						return true;
-					}
-				}
+		if (parse_pos == parse_end)
+			break;
 
-				if (!comment)
-				{
-					// If we find a character, return it
-					buffer = parse_buffer[parse_buffer_pos];
-					return true;
-				}
-			}
+		const char character = *parse_pos;
+		if (tokens[character] == TokenSet::Type::Token)
+			return character;
 
-			parse_buffer_pos++;
+		if (character == '\n')
+		{
+			line_number++;
+			parse_pos++;
 		}
-	} while (FillBuffer());
-
-	return false;
-}
-
-bool StyleSheetParser::FillBuffer()
-{
-	// If theres no data to process, abort
-	if (stream->IsEOS())
-		return false;
-
-	// Read in some data (4092 instead of 4096 to avoid the buffer growing when we have to add back
-	// a character after a failed comment parse.)
-	parse_buffer.clear();
-	bool read = stream->Read(parse_buffer, 4092) > 0;
-	parse_buffer_pos = 0;
+		else if (parse_pos + 1 < parse_end && parse_pos[1] == '*')
+		{
+			// Skip the comment, while counting the lines it spans.
+			parse_pos += 2;
+			while (parse_pos < parse_end && !(parse_pos[0] == '*' && parse_pos + 1 < parse_end && parse_pos[1] == '/'))
+			{
+				if (*parse_pos == '\n')
+					line_number++;
+				parse_pos++;
+			}
+			parse_pos = Math::Min(parse_pos + 2, parse_end);
+		}
+		else
+		{
+			// A slash which doesn't start a comment is a plain character.
+			buffer += character;
+			parse_pos++;
+		}
+	}
 
-	return read;
+	return 0;
 }
 
 } // namespace Rml
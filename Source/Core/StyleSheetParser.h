@@ -77,12 +77,14 @@ public:
 	static void Shutdown();
 
 private:
-	// Stream we're parsing from.
-	Stream* stream;
-	// Parser memory buffer.
+	// Lookup table of the characters to stop at while scanning for tokens.
+	struct TokenSet;
+
+	// Parser memory buffer, holding the contents of the stream we're parsing from.
 	String parse_buffer;
-	// How far we've read through the buffer.
-	size_t parse_buffer_pos;
+	// The source text we're parsing, and how far we've read through it.
+	const char* parse_pos;
+	const char* parse_end;
 
 	// The name of the file we're parsing.
 	String stream_file_name;
@@ -113,20 +115,19 @@ private:
 	/// @param[out] modifier Media query modifier.
 	bool ParseMediaFeatureMap(const String& rules, PropertyDictionary& properties, MediaQueryModifier &modifier);
 
-	// Attempts to find one of the given character tokens in the active stream
+	// Attempts to find one of the given character tokens in the source text
 	// If it's found, buffer is filled with all content up until the token
 	// @param buffer The buffer that receives the content
-	// @param characters The character tokens to find
-	// @param remove_token If the token that caused the find to stop should be removed from the stream
-	char FindToken(String& buffer, const char* tokens, bool remove_token);
-
-	// Attempts to find the next character in the active stream.
-	// If it's found, buffer is filled with the character
-	// @param buffer The buffer that receives the character, if read.
-	bool ReadCharacter(char& buffer);
+	// @param tokens The character tokens to find
+	// @param remove_token If the token that caused the find to stop should be removed from the source
+	char FindToken(String& buffer, const TokenSet& tokens, bool remove_token);
 
-	// Fill the internal parse buffer
-	bool FillBuffer();
+	// Appends all content up until the next of the given character tokens to the buffer, without removing the token.
+	// Comments and newlines are skipped, all other characters are appended in runs.
+	// @param buffer The buffer that receives the content
+	// @param tokens The character tokens to find
+	// @return The token found, or zero if the end of the source was reached
+	char ReadUntilToken(String& buffer, const TokenSet& tokens);
 };
 
 } // namespace Rml
@@ -30,6 +30,7 @@
 #define RMLUI_CORE_STYLESHEETSELECTOR_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AtomTable.h"
 
 namespace Rml {
 
@@ -138,16 +139,39 @@ using StructuralSelectorList = Vector<StructuralSelector>;
     Such as div#foo.bar:nth-child(2)
  */
 struct CompoundSelector {
-	String tag;
-	String id;
-	StringList class_names;
-	StringList pseudo_class_names;
+	// Names are interned at parse time so that they can be matched against elements by integer comparison.
+	Atom tag = Atom::Empty;
+	Atom id = Atom::Empty;
+	AtomList class_names;
+	AtomList pseudo_class_names;
 	AttributeSelectorList attributes;
 	StructuralSelectorList structural_selectors;
 	SelectorCombinator combinator = SelectorCombinator::Descendant; // Determines how to match with our parent node.
 };
 bool operator==(const CompoundSelector& a, const CompoundSelector& b);
 
+/**
+    Compiled compound selector, for fast matching against elements.
+
+    The requirements of the compound selector are flattened into a list of match operations, ordered so that the cheapest and most selective
+    requirements are tested first.
+ */
+enum class SelectorMatchOpType : uint8_t { Id, Tag, PseudoClass, Class, Attribute, Structural };
+struct SelectorMatchOp {
+	SelectorMatchOpType type;
+	// The atom to match for names, otherwise the index of the attribute or structural selector in the compound selector.
+	uint32_t operand;
+};
+struct CompiledSelector {
+	Vector<SelectorMatchOp> ops;
+	// The requirement used to index the selector in a style sheet is placed last, the preceding operations are the only ones that need to be
+	// tested for elements found through the index.
+	uint32_t num_unindexed_ops = 0;
+	// The number of distinct names required by the selector, elements with fewer names set can be rejected without any lookups.
+	uint16_t num_classes = 0;
+	uint16_t num_pseudo_classes = 0;
+};
+
 /// Returns true if the the node the given selector is discriminating for is applicable to a given element.
 /// @param element[in] The element to determine node applicability for.
 /// @param selector[in] The selector to test against the element.
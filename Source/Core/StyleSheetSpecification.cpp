@@ -28,7 +28,10 @@
 
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
+#include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "ContextActivity.h"
 #include "IdNameMap.h"
 #include "PropertyParserAnimation.h"
 #include "PropertyParserBoxShadow.h"
@@ -43,6 +46,8 @@
 #include "PropertyParserString.h"
 #include "PropertyParserTransform.h"
 #include "PropertyShorthandDefinition.h"
+#include <algorithm>
+#include <atomic>
 
 namespace Rml {
 
@@ -70,6 +75,116 @@ struct DefaultStyleSheetParsers : NonCopyMoveable {
 	PropertyParserBoxShadow box_shadow = PropertyParserBoxShadow(&color, &length);
 };
 
+struct ParsedValueCache : NonCopyMoveable {
+	// The number of distinct values remembered for each property, the least recently used value is replaced first.
+	static constexpr size_t max_values_per_property = 8;
+
+	struct Entry {
+		String value;
+		PropertyDictionary properties;
+		uint64_t last_used = 0;
+	};
+
+	// A unit which is parsed as a number by the given parser of a property, regardless of the numeric value.
+	struct NumericUnit {
+		Unit unit;
+		int parser_index;
+	};
+
+	void Clear()
+	{
+		declarations.clear();
+		numeric_units.clear();
+	}
+
+	const NumericUnit* FindNumericUnit(PropertyId id, Unit unit) const
+	{
+		auto it = numeric_units.find(id);
+		if (it == numeric_units.end())
+			return nullptr;
+		for (const NumericUnit& numeric_unit : it->second)
+		{
+			if (numeric_unit.unit == unit)
+				return &numeric_unit;
+		}
+		return nullptr;
+	}
+
+	UnorderedMap<String, Vector<Entry>> declarations;
+	UnorderedMap<PropertyId, Vector<NumericUnit>> numeric_units;
+
+	// Holds the result of the latest parse when it could not be cached.
+	PropertyDictionary uncached;
+	uint64_t use_counter = 0;
+	int generation = -1;
+};
+
+// Incremented whenever the specification changes, which invalidates all cached values.
+static std::atomic<int> value_cache_generation{0};
+
+static void InvalidateValueCaches()
+{
+	value_cache_generation.fetch_add(1, std::memory_order_release);
+}
+
+// Parsed values are cached separately for each thread, so that contexts can be updated in parallel without locking.
+static ParsedValueCache& GetValueCache()
+{
+	static thread_local ParsedValueCache cache;
+	const int generation = value_cache_generation.load(std::memory_order_acquire);
+	if (cache.generation != generation)
+	{
+		cache.Clear();
+		cache.generation = generation;
+	}
+	return cache;
+}
+
+// Returns true if the value can be kept beyond the lifetime of the element it was set on, which excludes values referencing other resources.
+static bool IsCacheableValue(const Variant& value)
+{
+	switch (value.GetType())
+	{
+	case Variant::NONE:
+	case Variant::BOOL:
+	case Variant::BYTE:
+	case Variant::CHAR:
+	case Variant::FLOAT:
+	case Variant::DOUBLE:
+	case Variant::INT:
+	case Variant::INT64:
+	case Variant::UINT:
+	case Variant::UINT64:
+	case Variant::STRING:
+	case Variant::VECTOR2:
+	case Variant::VECTOR3:
+	case Variant::VECTOR4:
+	case Variant::COLOURF:
+	case Variant::COLOURB: return true;
+	default: break;
+	}
+	return false;
+}
+
+// Returns true if the value consists of a single number and optional unit, without any characters that are treated specially by the parsers.
+static bool IsNumberWithUnit(const String& value)
+{
+	if (value.empty())
+		return false;
+
+	const char first = value[0];
+	if (!((first >= '0' && first <= '9') || first == '.' || first == '-' || first == '+'))
+		return false;
+
+	for (const char c : value)
+	{
+		const bool valid = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '.' || c == '-' || c == '+' || c == '%';
+		if (!valid)
+			return false;
+	}
+	return true;
+}
+
 StyleSheetSpecification::StyleSheetSpecification() :
 	// Reserve space for all defined ids and some more for custom properties
 	properties((size_t)PropertyId::MaxNumIds, 2 * (size_t)ShorthandId::NumDefinedIds)
@@ -78,12 +193,14 @@ StyleSheetSpecification::StyleSheetSpecification() :
 	instance = this;
 
 	default_parsers.reset(new DefaultStyleSheetParsers);
+	InvalidateValueCaches();
 }
 
 StyleSheetSpecification::~StyleSheetSpecification()
 {
 	RMLUI_ASSERT(instance == this);
 	instance = nullptr;
+	InvalidateValueCaches();
 }
 
 PropertyDefinition& StyleSheetSpecification::RegisterProperty(PropertyId id, const String& property_name, const String& default_value, bool inherited,
@@ -120,6 +237,7 @@ void StyleSheetSpecification::Shutdown()
 
 bool StyleSheetSpecification::RegisterParser(const String& parser_name, PropertyParser* parser)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	ParserMap::iterator iterator = instance->parsers.find(parser_name);
 	if (iterator != instance->parsers.end())
 	{
@@ -128,6 +246,7 @@ bool StyleSheetSpecification::RegisterParser(const String& parser_name, Property
 	}
 
 	instance->parsers[parser_name] = parser;
+	InvalidateValueCaches();
 	return true;
 }
 
@@ -143,8 +262,10 @@ PropertyParser* StyleSheetSpecification::GetParser(const String& parser_name)
 PropertyDefinition& StyleSheetSpecification::RegisterProperty(const String& property_name, const String& default_value, bool inherited,
 	bool forces_layout)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	RMLUI_ASSERTMSG((size_t)instance->properties.property_map->GetId(property_name) < (size_t)PropertyId::FirstCustomId,
 		"Custom property name matches an internal property, please make a unique name for the given property.");
+	InvalidateValueCaches();
 	return instance->RegisterProperty(PropertyId::Invalid, property_name, default_value, inherited, forces_layout);
 }
 
@@ -175,10 +296,12 @@ const PropertyIdSet& StyleSheetSpecification::GetRegisteredPropertiesForcingLayo
 
 ShorthandId StyleSheetSpecification::RegisterShorthand(const String& shorthand_name, const String& property_names, ShorthandType type)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	RMLUI_ASSERTMSG(instance->properties.property_map->GetId(shorthand_name) == PropertyId::Invalid,
 		"Custom shorthand name matches a property name, please make a unique name.");
 	RMLUI_ASSERTMSG((size_t)instance->properties.shorthand_map->GetId(shorthand_name) < (size_t)ShorthandId::FirstCustomId,
 		"Custom shorthand name matches an internal shorthand, please make a unique name for the given shorthand property.");
+	InvalidateValueCaches();
 	return instance->properties.RegisterShorthand(shorthand_name, property_names, type);
 }
 
@@ -197,6 +320,107 @@ bool StyleSheetSpecification::ParsePropertyDeclaration(PropertyDictionary& dicti
 	return instance->properties.ParsePropertyDeclaration(dictionary, property_name, property_value);
 }
 
+const PropertyDictionary* StyleSheetSpecification::ParsePropertyDeclarationCached(const String& property_name, const String& property_value)
+{
+	RMLUI_ZoneScoped;
+
+	ParsedValueCache& cache = GetValueCache();
+
+	auto it_declaration = cache.declarations.find(property_name);
+	if (it_declaration != cache.declarations.end())
+	{
+		for (ParsedValueCache::Entry& entry : it_declaration->second)
+		{
+			if (entry.value == property_value)
+			{
+				entry.last_used = ++cache.use_counter;
+				return &entry.properties;
+			}
+		}
+	}
+
+	const PropertyId id = instance->properties.property_map->GetId(property_name);
+
+	float number = 0.f;
+	Unit unit = Unit::UNKNOWN;
+	const bool is_number =
+		(id != PropertyId::Invalid && IsNumberWithUnit(property_value) && PropertyParserNumber::ParseNumber(number, unit, property_value));
+
+	PropertyDictionary properties;
+
+	// Numbers with a unit known to the property can be constructed directly, which avoids the full parse of values changing continuously.
+	if (const ParsedValueCache::NumericUnit* numeric_unit = (is_number ? cache.FindNumericUnit(id, unit) : nullptr))
+	{
+		Property property(number, unit);
+		property.definition = instance->properties.GetProperty(id);
+		property.parser_index = numeric_unit->parser_index;
+		properties.SetProperty(id, property);
+	}
+	else
+	{
+		if (!instance->properties.ParsePropertyDeclaration(properties, property_name, property_value))
+			return nullptr;
+
+		// Remember the unit if the number parsed plainly, then subsequent numbers with this unit don't need a full parse.
+		const Property* parsed = (is_number && properties.GetNumProperties() == 1 ? properties.GetProperty(id) : nullptr);
+		if (parsed && parsed->value.GetType() == Variant::FLOAT && parsed->unit == unit && parsed->Get<float>() == number)
+			cache.numeric_units[id].push_back(ParsedValueCache::NumericUnit{unit, parsed->parser_index});
+	}
+
+	for (const auto& id_property : properties.GetProperties())
+	{
+		if (!IsCacheableValue(id_property.second.value))
+		{
+			cache.uncached = std::move(properties);
+			return &cache.uncached;
+		}
+	}
+
+	Vector<ParsedValueCache::Entry>& entries = cache.declarations[property_name];
+	ParsedValueCache::Entry* entry = nullptr;
+	if (entries.size() < ParsedValueCache::max_values_per_property)
+	{
+		entries.emplace_back();
+		entry = &entries.back();
+	}
+	else
+	{
+		entry = &*std::min_element(entries.begin(), entries.end(),
+			[](const ParsedValueCache::Entry& a, const ParsedValueCache::Entry& b) { return a.last_used < b.last_used; });
+	}
+
+	entry->value = property_value;
+	entry->properties = std::move(properties);
+	entry->last_used = ++cache.use_counter;
+
+	return &entry->properties;
+}
+
+bool StyleSheetSpecification::ParseNumericProperty(Property& property, PropertyId id, float value, Unit unit)
+{
+	const PropertyDefinition* definition = instance->properties.GetProperty(id);
+	if (!definition)
+		return false;
+
+	const ParsedValueCache::NumericUnit* numeric_unit = GetValueCache().FindNumericUnit(id, unit);
+	if (!numeric_unit)
+	{
+		// Parse the string form once, which records the unit for this property if it is accepted as a plain number.
+		const String& name = instance->properties.property_map->GetName(id);
+		if (!ParsePropertyDeclarationCached(name, Property(value, unit).ToString()))
+			return false;
+
+		numeric_unit = GetValueCache().FindNumericUnit(id, unit);
+		if (!numeric_unit)
+			return false;
+	}
+
+	property = Property(value, unit);
+	property.definition = definition;
+	property.parser_index = numeric_unit->parser_index;
+	return true;
+}
+
 PropertyId StyleSheetSpecification::GetPropertyId(const String& property_name)
 {
 	return instance->properties.property_map->GetId(property_name);
@@ -99,20 +99,22 @@ bool Template::Load(Stream* stream)
 
 	header = *parser.GetDocumentHeader();
 
-	// Store the body in stream form
-	body = MakeUnique<StreamMemory>(body_end - body_start);
-	body->SetSourceURL(stream->GetSourceURL());
-	body->PushBack(body_start, body_end - body_start);
+	// Parse the body and store its nodes, so that they can be instanced without parsing the body again
+	StreamMemory body_stream((const byte*)body_start, body_end - body_start);
+	body_stream.SetSourceURL(stream->GetSourceURL());
+	source_url = stream->GetSourceURL();
+
+	body.clear();
+	XMLParser body_parser(nullptr);
+	body_parser.ParseNodes(&body_stream, body);
 
 	return true;
 }
 
 Element* Template::ParseTemplate(Element* element)
 {
-	body->Seek(0, SEEK_SET);
-
 	XMLParser parser(element);
-	parser.Parse(body.get());
+	parser.HandleNodes(body, source_url);
 
 	// If theres an inject attribute on the template,
 	// attempt to find the required element
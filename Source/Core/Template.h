@@ -29,7 +29,9 @@
 #ifndef RMLUI_CORE_TEMPLATE_H
 #define RMLUI_CORE_TEMPLATE_H
 
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/URL.h"
 #include "DocumentHeader.h"
 
 namespace Rml {
@@ -37,7 +39,7 @@ namespace Rml {
 class Element;
 
 /**
-    Contains a RML template. The Header is stored in parsed form, body in an unparsed stream.
+    Contains a RML template. The header is stored in parsed form, the body as parsed nodes ready to be instanced.
 
     @author Lloyd Weehuizen
  */
@@ -65,7 +67,8 @@ private:
 	String name;
 	String content;
 	DocumentHeader header;
-	UniquePtr<StreamMemory> body;
+	URL source_url;
+	XMLParsedNodeList body;
 };
 
 } // namespace Rml
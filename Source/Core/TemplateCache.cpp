@@ -65,6 +65,8 @@ void TemplateCache::Shutdown()
 
 Template* TemplateCache::LoadTemplate(const String& name)
 {
+	std::lock_guard<std::mutex> lock(instance->mutex);
+
 	// Check if the template is already loaded
 	Templates::iterator itr = instance->templates.find(name);
 	if (itr != instance->templates.end())
@@ -104,6 +106,8 @@ Template* TemplateCache::LoadTemplate(const String& name)
 
 Template* TemplateCache::GetTemplate(const String& name)
 {
+	std::lock_guard<std::mutex> lock(instance->mutex);
+
 	// Check if the template is already loaded
 	Templates::iterator itr = instance->template_ids.find(name);
 	if (itr != instance->template_ids.end())
@@ -114,6 +118,8 @@ Template* TemplateCache::GetTemplate(const String& name)
 
 void TemplateCache::Clear()
 {
+	std::lock_guard<std::mutex> lock(instance->mutex);
+
 	for (Templates::iterator i = instance->templates.begin(); i != instance->templates.end(); ++i)
 		delete (*i).second;
 
@@ -30,13 +30,15 @@
 #define RMLUI_CORE_TEMPLATECACHE_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
 
 namespace Rml {
 
 class Template;
 
 /**
-    Manages requests for loading templates, caching as it goes.
+    Manages requests for loading templates, caching as it goes. Templates can be loaded from any thread, loaded templates are
+    never modified and stay alive until the cache is cleared.
 
     @author Lloyd Weehuizen
  */
@@ -62,6 +64,8 @@ private:
 	using Templates = UnorderedMap<String, Template*>;
 	Templates templates;
 	Templates template_ids;
+
+	std::mutex mutex;
 };
 
 } // namespace Rml
@@ -28,9 +28,13 @@
 
 #include "../../Include/RmlUi/Core/Texture.h"
 #include "RenderManagerAccess.h"
+#include <mutex>
 
 namespace Rml {
 
+// Texture sources may be shared by contexts on different threads, each using their own render manager.
+static std::mutex texture_source_mutex;
+
 Texture::Texture(RenderManager* render_manager, TextureFileIndex file_index) : render_manager(render_manager), file_index(file_index) {}
 
 Texture::Texture(RenderManager* render_manager, StableVectorIndex callback_index) : render_manager(render_manager), callback_index(callback_index) {}
@@ -58,9 +62,18 @@ TextureSource::TextureSource(String source, String document_path) : source(std::
 
 Texture TextureSource::GetTexture(RenderManager& render_manager) const
 {
-	Texture& texture = textures[&render_manager];
-	if (!texture)
-		texture = render_manager.LoadTexture(source, document_path);
+	{
+		std::lock_guard<std::mutex> lock(texture_source_mutex);
+		auto it = textures.find(&render_manager);
+		if (it != textures.end() && it->second)
+			return it->second;
+	}
+
+	// Load the texture outside the lock, a render manager is only ever used by a single thread at a time.
+	Texture texture = render_manager.LoadTexture(source, document_path);
+
+	std::lock_guard<std::mutex> lock(texture_source_mutex);
+	textures[&render_manager] = texture;
 	return texture;
 }
 
@@ -44,6 +44,8 @@ public:
 
 	StableVectorIndex CreateTexture(CallbackTextureFunction&& callback);
 	void ReleaseTexture(RenderInterface* render_interface, StableVectorIndex callback_index);
+	// Releases the texture generated by the callback while keeping the callback, so that it is generated again the next time it is used.
+	void ReleaseTextureHandle(RenderInterface* render_interface, StableVectorIndex callback_index);
 
 	Vector2i GetDimensions(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index);
 	TextureHandle GetHandle(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index);
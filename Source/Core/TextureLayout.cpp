@@ -49,6 +49,11 @@ void TextureLayout::AddRectangle(int id, Vector2i dimensions)
 	rectangles.push_back(TextureLayoutRectangle(id, dimensions));
 }
 
+void TextureLayout::AddTexture(Vector2i dimensions)
+{
+	textures.push_back(TextureLayoutTexture(dimensions));
+}
+
 TextureLayoutRectangle& TextureLayout::GetRectangle(int index)
 {
 	RMLUI_ASSERT(index >= 0);
@@ -95,4 +100,31 @@ bool TextureLayout::GenerateLayout(int max_texture_dimensions)
 	return true;
 }
 
+bool TextureLayout::ExtendLayout()
+{
+	// New rectangles are added at the end, sort only those so that the indices of the placed rectangles remain stable.
+	const auto it_first_unplaced =
+		std::find_if(rectangles.begin(), rectangles.end(), [](const TextureLayoutRectangle& rectangle) { return !rectangle.IsPlaced(); });
+	RMLUI_ASSERT(std::none_of(it_first_unplaced, rectangles.end(), [](const TextureLayoutRectangle& rectangle) { return rectangle.IsPlaced(); }));
+
+	const int num_unplaced_rectangles = int(rectangles.end() - it_first_unplaced);
+	if (num_unplaced_rectangles == 0)
+		return true;
+
+	std::sort(it_first_unplaced, rectangles.end(), RectangleSort());
+
+	int num_placed_rectangles = 0;
+	for (int i = 0; i < GetNumTextures() && num_placed_rectangles < num_unplaced_rectangles; ++i)
+		num_placed_rectangles += textures[i].Extend(*this, i);
+
+	return num_placed_rectangles == num_unplaced_rectangles;
+}
+
+void TextureLayout::RemoveUnplacedRectangles()
+{
+	auto it_unplaced =
+		std::remove_if(rectangles.begin(), rectangles.end(), [](const TextureLayoutRectangle& rectangle) { return !rectangle.IsPlaced(); });
+	rectangles.erase(it_unplaced, rectangles.end());
+}
+
 } // namespace Rml
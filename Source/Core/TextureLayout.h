@@ -51,6 +51,9 @@ public:
 	/// @param[in] id The id of the rectangle; used to identify the rectangle after it has been positioned.
 	/// @param[in] dimensions The dimensions of the rectangle.
 	void AddRectangle(int id, Vector2i dimensions);
+	/// Adds an empty texture of fixed dimensions to the layout. Rectangles can then be placed into it using ExtendLayout().
+	/// @param[in] dimensions The dimensions of the texture.
+	void AddTexture(Vector2i dimensions);
 
 	/// Returns one of the layout's rectangles.
 	/// @param[in] index The index of the desired rectangle.
@@ -72,6 +75,12 @@ public:
 	/// @param[in] max_texture_dimensions The maximum dimensions allowed for any single texture.
 	/// @return True if the layout was generated successfully, false if not.
 	bool GenerateLayout(int max_texture_dimensions);
+	/// Attempts to place rectangles added after the layout was generated into the free space of the existing textures. Rectangles
+	/// that were already placed keep their texture, position and index.
+	/// @return True if all the new rectangles were placed, false if they did not fit and the layout needs to be regenerated.
+	bool ExtendLayout();
+	/// Removes all rectangles which have not been placed, such as the ones left over after a failed extension of the layout.
+	void RemoveUnplacedRectangles();
 
 private:
 	using RectangleList = Vector<TextureLayoutRectangle>;
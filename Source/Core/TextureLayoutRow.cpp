@@ -28,23 +28,35 @@
 
 #include "TextureLayoutRow.h"
 #include "TextureLayout.h"
+#include <limits.h>
 
 namespace Rml {
 
 TextureLayoutRow::TextureLayoutRow()
 {
 	height = 0;
+	y = 0;
+	width_used = 1;
 }
 
 TextureLayoutRow::~TextureLayoutRow() {}
 
-int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
+int TextureLayoutRow::Generate(TextureLayout& layout, int texture_index, int max_width, int _y)
+{
+	height = 0;
+	y = _y;
+	width_used = 1;
+	rectangles.clear();
+
+	return Extend(layout, texture_index, max_width, INT_MAX);
+}
+
+int TextureLayoutRow::Extend(TextureLayout& layout, int texture_index, int max_width, int max_height)
 {
-	int width = 1;
 	int first_unplaced_index = 0;
 	int placed_rectangles = 0;
 
-	while (width < max_width)
+	while (width_used < max_width)
 	{
 		// Find the first unplaced rectangle we can fit.
 		int index;
@@ -53,7 +65,7 @@ int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
 			TextureLayoutRectangle& rectangle = layout.GetRectangle(index);
 			if (!rectangle.IsPlaced())
 			{
-				if (width + rectangle.GetDimensions().x + 1 <= max_width)
+				if (width_used + rectangle.GetDimensions().x + 1 <= max_width && rectangle.GetDimensions().y <= max_height)
 					break;
 			}
 		}
@@ -67,14 +79,14 @@ int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
 		height = Math::Max(height, rectangle.GetDimensions().y);
 
 		// Add this glyph onto our list and mark it as placed.
-		rectangles.push_back(&rectangle);
-		rectangle.Place(layout.GetNumTextures(), Vector2i(width, y));
+		rectangles.push_back(index);
+		rectangle.Place(texture_index, Vector2i(width_used, y));
 		++placed_rectangles;
 
 		// Increment our width. An extra pixel is added on so the rectangles aren't pushed up
 		// against each other. This will avoid filtering artifacts.
 		if (rectangle.GetDimensions().x > 0)
-			width += rectangle.GetDimensions().x + 1;
+			width_used += rectangle.GetDimensions().x + 1;
 
 		first_unplaced_index = index + 1;
 	}
@@ -82,10 +94,10 @@ int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
 	return placed_rectangles;
 }
 
-void TextureLayoutRow::Allocate(byte* texture_data, int stride)
+void TextureLayoutRow::Allocate(TextureLayout& layout, byte* texture_data, int stride)
 {
-	for (size_t i = 0; i < rectangles.size(); ++i)
-		rectangles[i]->Allocate(texture_data, stride);
+	for (int index : rectangles)
+		layout.GetRectangle(index).Allocate(texture_data, stride);
 }
 
 int TextureLayoutRow::GetHeight() const
@@ -93,10 +105,15 @@ int TextureLayoutRow::GetHeight() const
 	return height;
 }
 
-void TextureLayoutRow::Unplace()
+int TextureLayoutRow::GetY() const
+{
+	return y;
+}
+
+void TextureLayoutRow::Unplace(TextureLayout& layout)
 {
-	for (size_t i = 0; i < rectangles.size(); ++i)
-		rectangles[i]->Unplace();
+	for (int index : rectangles)
+		layout.GetRectangle(index).Unplace();
 }
 
 } // namespace Rml
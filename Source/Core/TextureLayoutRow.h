@@ -48,28 +48,43 @@ public:
 
 	/// Attempts to position unplaced rectangles from the layout into this row.
 	/// @param[in] layout The layout to position rectangles from.
+	/// @param[in] texture_index The index of the texture this row is placed in.
 	/// @param[in] width The maximum width of this row.
 	/// @param[in] y The y-coordinate of this row.
 	/// @return The number of placed rectangles.
-	int Generate(TextureLayout& layout, int width, int y);
+	int Generate(TextureLayout& layout, int texture_index, int width, int y);
+	/// Attempts to position further unplaced rectangles after the ones already placed in this row.
+	/// @param[in] layout The layout to position rectangles from.
+	/// @param[in] texture_index The index of the texture this row is placed in.
+	/// @param[in] width The maximum width of this row.
+	/// @param[in] max_height The maximum height the row may grow to.
+	/// @return The number of placed rectangles.
+	int Extend(TextureLayout& layout, int texture_index, int width, int max_height);
 
 	/// Assigns allocated texture data to all rectangles in this row.
+	/// @param[in] layout The layout the rectangles belong to.
 	/// @param[in] texture_data The pointer to the beginning of the texture's data.
 	/// @param[in] stride The stride of the texture's surface, in bytes;
-	void Allocate(byte* texture_data, int stride);
+	void Allocate(TextureLayout& layout, byte* texture_data, int stride);
 
 	/// Returns the height of the row.
 	/// @return The row's height.
 	int GetHeight() const;
+	/// Returns the y-coordinate of the row.
+	int GetY() const;
 
 	/// Resets the placed status for all of the rectangles within this row.
-	void Unplace();
+	/// @param[in] layout The layout the rectangles belong to.
+	void Unplace(TextureLayout& layout);
 
 private:
-	using RectangleList = Vector<TextureLayoutRectangle*>;
+	// Indices of the rectangles in the layout. Indices are used rather than pointers, as the layout may grow after the row was generated.
+	using RectangleIndexList = Vector<int>;
 
 	int height;
-	RectangleList rectangles;
+	int y;
+	int width_used;
+	RectangleIndexList rectangles;
 };
 
 } // namespace Rml
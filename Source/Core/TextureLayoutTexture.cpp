@@ -34,6 +34,8 @@ namespace Rml {
 
 TextureLayoutTexture::TextureLayoutTexture() : dimensions(0, 0) {}
 
+TextureLayoutTexture::TextureLayoutTexture(Vector2i dimensions) : dimensions(dimensions) {}
+
 TextureLayoutTexture::~TextureLayoutTexture()
 {
 	// Don't free texture data; freed in the texture loader.
@@ -86,7 +88,7 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 		while (num_placed_rectangles != unplaced_rectangles)
 		{
 			TextureLayoutRow row;
-			int row_size = row.Generate(layout, dimensions.x, height);
+			int row_size = row.Generate(layout, layout.GetNumTextures(), dimensions.x, height);
 			if (row_size == 0)
 			{
 				success = false;
@@ -97,7 +99,7 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 			if (height > dimensions.y)
 			{
 				// D'oh! We've exceeded our height boundaries. This row should be unplaced.
-				row.Unplace();
+				row.Unplace(layout);
 				success = false;
 				break;
 			}
@@ -125,14 +127,49 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 
 		// Unplace all of the glyphs we tried to place and have an other crack.
 		for (size_t i = 0; i < rows.size(); i++)
-			rows[i].Unplace();
+			rows[i].Unplace(layout);
 
 		rows.clear();
 		num_placed_rectangles = 0;
 	}
 }
 
-Vector<byte> TextureLayoutTexture::AllocateTexture()
+int TextureLayoutTexture::Extend(TextureLayout& layout, int texture_index)
+{
+	int num_placed_rectangles = 0;
+
+	// First try to fill up the remaining space at the end of the last row, it may grow as long as it stays within the texture.
+	int height = 1;
+	if (!rows.empty())
+	{
+		TextureLayoutRow& last_row = rows.back();
+		num_placed_rectangles += last_row.Extend(layout, texture_index, dimensions.x, dimensions.y - last_row.GetY() - 1);
+		height = last_row.GetY() + last_row.GetHeight() + 1;
+	}
+
+	// Then add new rows below the existing ones, using the same rules as when generating the texture.
+	while (height < dimensions.y)
+	{
+		TextureLayoutRow row;
+		int row_size = row.Generate(layout, texture_index, dimensions.x, height);
+		if (row_size == 0)
+			break;
+
+		height += row.GetHeight() + 1;
+		if (height > dimensions.y)
+		{
+			row.Unplace(layout);
+			break;
+		}
+
+		rows.push_back(row);
+		num_placed_rectangles += row_size;
+	}
+
+	return num_placed_rectangles;
+}
+
+Vector<byte> TextureLayoutTexture::AllocateTexture(TextureLayout& layout)
 {
 	Vector<byte> texture_data;
 
@@ -142,7 +179,7 @@ Vector<byte> TextureLayoutTexture::AllocateTexture()
 		texture_data.resize(dimensions.x * dimensions.y * 4, 0);
 
 		for (size_t i = 0; i < rows.size(); ++i)
-			rows[i].Allocate(texture_data.data(), dimensions.x * 4);
+			rows[i].Allocate(layout, texture_data.data(), dimensions.x * 4);
 	}
 
 	return texture_data;
@@ -46,6 +46,8 @@ class TextureLayout;
 class TextureLayoutTexture {
 public:
 	TextureLayoutTexture();
+	/// Constructs an empty texture of fixed dimensions, to be filled using Extend().
+	explicit TextureLayoutTexture(Vector2i dimensions);
 	~TextureLayoutTexture();
 
 	/// Returns the texture's dimensions. This is only valid after the texture has been generated.
@@ -59,10 +61,17 @@ public:
 	/// be placed as possible.
 	/// @return The number of placed rectangles.
 	int Generate(TextureLayout& layout, int maximum_dimensions);
+	/// Attempts to position unplaced rectangles from the layout into the free space of this already generated texture,
+	/// without changing its dimensions or moving any of the rectangles previously placed.
+	/// @param[in] layout The layout to position rectangles from.
+	/// @param[in] texture_index The index of this texture in the layout.
+	/// @return The number of placed rectangles.
+	int Extend(TextureLayout& layout, int texture_index);
 
 	/// Allocates the texture.
+	/// @param[in] layout The layout the placed rectangles belong to.
 	/// @return The allocated texture data.
-	Vector<byte> AllocateTexture();
+	Vector<byte> AllocateTexture(TextureLayout& layout);
 
 private:
 	using RowList = Vector<TextureLayoutRow>;
@@ -34,6 +34,7 @@
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/URL.h"
 #include "../../Include/RmlUi/Core/XMLNodeHandler.h"
+#include "ContextActivity.h"
 #include "DocumentHeader.h"
 
 namespace Rml {
@@ -64,6 +65,7 @@ XMLParser::~XMLParser() {}
 
 XMLNodeHandler* XMLParser::RegisterNodeHandler(const String& _tag, SharedPtr<XMLNodeHandler> handler)
 {
+	RMLUI_ASSERT_NO_ACTIVE_CONTEXTS;
 	String tag = StringUtilities::ToLower(_tag);
 
 	// Check for a default node registration.
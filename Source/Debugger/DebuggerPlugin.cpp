@@ -37,6 +37,7 @@
 #include "ElementContextHook.h"
 #include "ElementInfo.h"
 #include "ElementLog.h"
+#include "ElementProfiler.h"
 #include "FontSource.h"
 #include "Geometry.h"
 #include "MenuSource.h"
@@ -58,6 +59,7 @@ DebuggerPlugin::DebuggerPlugin()
 	menu_element = nullptr;
 	info_element = nullptr;
 	log_element = nullptr;
+	profiler_element = nullptr;
 	hook_element = nullptr;
 
 	render_outlines = false;
@@ -81,7 +83,7 @@ bool DebuggerPlugin::Initialise(Context* context)
 		return false;
 	}
 
-	if (!LoadMenuElement() || !LoadInfoElement() || !LoadLogElement())
+	if (!LoadMenuElement() || !LoadInfoElement() || !LoadLogElement() || !LoadProfilerElement())
 	{
 		Log::Message(Log::LT_ERROR, "Failed to initialise debugger, error while load debugger elements.");
 		return false;
@@ -246,6 +248,13 @@ void DebuggerPlugin::ProcessEvent(Event& event)
 		{
 			render_outlines = !render_outlines;
 		}
+		else if (event.GetTargetElement()->GetId() == "profiler-button")
+		{
+			if (profiler_element->IsVisible())
+				profiler_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+			else
+				profiler_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Visible));
+		}
 	}
 }
 
@@ -296,6 +305,9 @@ bool DebuggerPlugin::LoadMenuElement()
 	Element* outlines_button = menu_element->GetElementById("outlines-button");
 	outlines_button->AddEventListener(EventId::Click, this);
 
+	Element* profiler_button = menu_element->GetElementById("profiler-button");
+	profiler_button->AddEventListener(EventId::Click, this);
+
 	return true;
 }
 
@@ -346,6 +358,27 @@ bool DebuggerPlugin::LoadLogElement()
 	return true;
 }
 
+bool DebuggerPlugin::LoadProfilerElement()
+{
+	profiler_element_instancer = MakeUnique<ElementInstancerGeneric<ElementProfiler>>();
+	Factory::RegisterElementInstancer("debug-profiler", profiler_element_instancer.get());
+	profiler_element = rmlui_dynamic_cast<ElementProfiler*>(host_context->CreateDocument("debug-profiler"));
+	if (!profiler_element)
+		return false;
+
+	profiler_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+
+	if (!profiler_element->Initialise())
+	{
+		host_context->UnloadDocument(profiler_element);
+		profiler_element = nullptr;
+
+		return false;
+	}
+
+	return true;
+}
+
 void DebuggerPlugin::SetupInfoListeners(Rml::Context* new_context)
 {
 	RMLUI_ASSERT(info_element);
@@ -385,6 +418,12 @@ void DebuggerPlugin::ReleaseElements()
 			info_element = nullptr;
 		}
 
+		if (profiler_element)
+		{
+			host_context->UnloadDocument(profiler_element);
+			profiler_element = nullptr;
+		}
+
 		if (log_element)
 		{
 			host_context->UnloadDocument(log_element);
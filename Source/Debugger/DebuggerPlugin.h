@@ -41,6 +41,7 @@ namespace Debugger {
 
 class ElementLog;
 class ElementInfo;
+class ElementProfiler;
 class ElementContextHook;
 class DebuggerSystemInterface;
 
@@ -99,6 +100,7 @@ private:
 	bool LoadMenuElement();
 	bool LoadInfoElement();
 	bool LoadLogElement();
+	bool LoadProfilerElement();
 
 	void SetupInfoListeners(Rml::Context* new_context);
 
@@ -114,12 +116,13 @@ private:
 	ElementDocument* menu_element;
 	ElementInfo* info_element;
 	ElementLog* log_element;
+	ElementProfiler* profiler_element;
 	ElementContextHook* hook_element;
 
 	Rml::SystemInterface* application_interface;
 	UniquePtr<DebuggerSystemInterface> log_interface;
 
-	UniquePtr<ElementInstancer> hook_element_instancer, info_element_instancer, log_element_instancer;
+	UniquePtr<ElementInstancer> hook_element_instancer, info_element_instancer, log_element_instancer, profiler_element_instancer;
 
 	bool render_outlines;
 
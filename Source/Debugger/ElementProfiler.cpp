@@ -0,0 +1,191 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementProfiler.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/FrameProfiler.h"
+#include "../../Include/RmlUi/Core/PropertyIdSet.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "CommonSource.h"
+#include "ProfilerSource.h"
+
+namespace Rml {
+namespace Debugger {
+
+// The displayed values are refreshed at this interval, in seconds, to keep them readable.
+static constexpr double refresh_interval = 0.25;
+
+ElementProfiler::ElementProfiler(const String& tag) : ElementDocument(tag) {}
+
+ElementProfiler::~ElementProfiler()
+{
+	RemoveEventListener(EventId::Click, this);
+
+	if (enabled_profiler)
+		FrameProfiler::SetEnabled(false);
+}
+
+bool ElementProfiler::Initialise()
+{
+	SetInnerRML(profiler_rml);
+	SetId("rmlui-debug-profiler");
+
+	content = GetElementById("content");
+
+	SharedPtr<StyleSheetContainer> style_sheet = Factory::InstanceStyleSheetString(String(common_rcss) + String(profiler_rcss));
+	if (!style_sheet)
+		return false;
+
+	SetStyleSheetContainer(std::move(style_sheet));
+
+	AddEventListener(EventId::Click, this);
+
+	return true;
+}
+
+void ElementProfiler::OnUpdate()
+{
+	ElementDocument::OnUpdate();
+
+	if (!IsVisible())
+		return;
+
+	const double time = GetSystemInterface()->GetElapsedTime();
+	if (!paused && time - last_refresh_time >= refresh_interval)
+	{
+		last_refresh_time = time;
+		UpdateContent();
+	}
+
+	// Keep updating so that new frames are displayed, even when nothing else is happening in the context.
+	if (Context* context = GetContext())
+		context->RequestNextUpdate(refresh_interval);
+}
+
+void ElementProfiler::OnPropertyChange(const PropertyIdSet& changed_properties)
+{
+	ElementDocument::OnPropertyChange(changed_properties);
+
+	// Visibility is only known once the computed values are in place, thus toggle the profiler from here rather than during update.
+	if (!changed_properties.Contains(PropertyId::Visibility) && !changed_properties.Contains(PropertyId::Display))
+		return;
+
+	const bool visible = IsVisible();
+	if (visible && !enabled_profiler && !FrameProfiler::IsEnabled())
+	{
+		FrameProfiler::SetEnabled(true);
+		enabled_profiler = true;
+	}
+	else if (!visible && enabled_profiler)
+	{
+		FrameProfiler::SetEnabled(false);
+		enabled_profiler = false;
+	}
+}
+
+void ElementProfiler::ProcessEvent(Event& event)
+{
+	if (event == EventId::Click)
+	{
+		Element* target = event.GetTargetElement();
+		if (target->GetId() == "close_button")
+		{
+			SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+		}
+		else if (target->GetId() == "clear_button")
+		{
+			FrameProfiler::ClearFrames();
+			UpdateContent();
+		}
+		else if (target->GetId() == "pause_button")
+		{
+			paused = !paused;
+			target->SetInnerRML(paused ? "Resume" : "Pause");
+		}
+	}
+}
+
+void ElementProfiler::UpdateContent()
+{
+	if (!content)
+		return;
+
+	const Vector<FrameProfile> frames = FrameProfiler::GetFrames();
+	if (frames.empty())
+	{
+		content->SetInnerRML("No frames recorded.");
+		return;
+	}
+
+	Vector<double> values(frames.size());
+
+	// Adds a row with the last, average, and maximum value over all frames.
+	auto add_row = [&](String& rml, const char* name, int precision) {
+		double sum = 0, max = 0;
+		for (double value : values)
+		{
+			sum += value;
+			max = Math::Max(max, value);
+		}
+		rml += CreateString(256, "<div class=\"profiler-row\"><span class=\"name\">%s</span>", name);
+		rml += CreateString(256, "<span>%.*f</span><span>%.*f</span><span>%.*f</span></div>", precision, values.back(), precision,
+			sum / double(values.size()), precision, max);
+	};
+
+	String rml;
+	rml += CreateString(128, "<h2>Timings (ms) over %d frames</h2>", int(frames.size()));
+	rml += "<div class=\"profiler-row header\"><span class=\"name\">Stage</span><span>Last</span><span>Avg</span><span>Max</span></div>";
+
+	for (size_t i = 0; i < frames.size(); i++)
+		values[i] = frames[i].duration * 1000.0;
+	add_row(rml, "Frame", 2);
+
+	for (size_t timer = 0; timer < size_t(FrameTimer::Count); timer++)
+	{
+		for (size_t i = 0; i < frames.size(); i++)
+			values[i] = frames[i].timers[timer] * 1000.0;
+		add_row(rml, FrameProfiler::GetName(FrameTimer(timer)), 2);
+	}
+
+	rml += "<h2>Counters</h2>";
+	rml += "<div class=\"profiler-row header\"><span class=\"name\">Counter</span><span>Last</span><span>Avg</span><span>Max</span></div>";
+
+	for (size_t counter = 0; counter < size_t(FrameCounter::Count); counter++)
+	{
+		for (size_t i = 0; i < frames.size(); i++)
+			values[i] = double(frames[i].counters[counter]);
+		add_row(rml, FrameProfiler::GetName(FrameCounter(counter)), 1);
+	}
+
+	content->SetInnerRML(rml);
+}
+
+} // namespace Debugger
+} // namespace Rml
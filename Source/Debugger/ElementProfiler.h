@@ -0,0 +1,74 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_DEBUGGER_ELEMENTPROFILER_H
+#define RMLUI_DEBUGGER_ELEMENTPROFILER_H
+
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "../../Include/RmlUi/Core/EventListener.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+namespace Debugger {
+
+/**
+    Displays the timings and counters recorded by the frame profiler. The profiler is enabled while the document is visible, unless it has
+    already been enabled by the application.
+ */
+
+class ElementProfiler : public Rml::ElementDocument, public Rml::EventListener {
+public:
+	RMLUI_RTTI_DefineWithParent(ElementProfiler, Rml::ElementDocument)
+
+	ElementProfiler(const String& tag);
+	~ElementProfiler();
+
+	/// Initialises the profiler element.
+	/// @return True if the element initialised successfully, false otherwise.
+	bool Initialise();
+
+protected:
+	void OnUpdate() override;
+	void OnPropertyChange(const PropertyIdSet& changed_properties) override;
+	void ProcessEvent(Event& event) override;
+
+private:
+	// Regenerates the contents from the frames recorded by the profiler.
+	void UpdateContent();
+
+	Element* content = nullptr;
+	double last_refresh_time = 0;
+	// True if we enabled the profiler, in which case we disable it again when hidden.
+	bool enabled_profiler = false;
+	bool paused = false;
+};
+
+} // namespace Debugger
+} // namespace Rml
+
+#endif
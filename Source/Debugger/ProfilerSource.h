@@ -0,0 +1,104 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+static const char* profiler_rcss = R"RCSS(body
+{
+	width: 380dp;
+	height: 330dp;
+	min-width: 300dp;
+	min-height: 150dp;
+	top: 42dp;
+	left: 440dp;
+}
+div#tools
+{
+	float: right;
+	width: 120dp;
+}
+div.button
+{
+	display: inline-block;
+	width: 50dp;
+	font-size: 13dp;
+	line-height: 20dp;
+	text-align: center;
+	border-width: 1px;
+	border-color: #666;
+	background-color: #aaa;
+	color: #111;
+	margin-right: 3dp;
+}
+div.button:hover
+{
+	border-color: #ddd;
+}
+div.button:active
+{
+	border-color: #fff;
+}
+div#content h2
+{
+	padding-left: 5dp;
+}
+div.profiler-row
+{
+	padding-left: 5dp;
+	font-size: 12dp;
+}
+div.profiler-row.header
+{
+	color: #610;
+}
+div.profiler-row span
+{
+	display: inline-block;
+	width: 60dp;
+	text-align: right;
+}
+div.profiler-row span.name
+{
+	width: 150dp;
+	text-align: left;
+}
+)RCSS";
+
+static const char* profiler_rml = R"RML(
+<h1>
+	<handle id="position_handle" move_target="#document"/>
+	<div id="close_button">X</div>
+	<div id="tools">
+		<div id="clear_button" class="button">Clear</div>
+		<div id="pause_button" class="button">Pause</div>
+	</div>
+	<div style="width: 100dp;">Profiler</div>
+</h1>
+<div id="content">
+	No frames recorded.
+</div>
+<handle id="size_handle" size_target="#document" />
+)RML";
@@ -32,10 +32,12 @@
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/FileInterface.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/MeshUtilities.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/RenderManager.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "LottieFrameRenderer.h"
 #include <cmath>
 #include <rlottie.h>
 
@@ -139,9 +141,11 @@ bool ElementLottie::LoadAnimation()
 	animation_dirty = false;
 	intrinsic_dimensions = Vector2f{};
 	texture = {};
+	frame_renderer.reset();
 	animation.reset();
 	prev_animation_frame = size_t(-1);
 	time_animation_start = -1;
+	time_prev_texture_update = -1;
 
 	const String attribute_src = GetAttribute<String>("src", "");
 
@@ -179,6 +183,9 @@ bool ElementLottie::LoadAnimation()
 	intrinsic_dimensions.x = float(width);
 	intrinsic_dimensions.y = float(height);
 
+	frame_renderer = MakeUnique<Lottie::LottieFrameRenderer>(*animation, path);
+	texture_size_dirty = true;
+
 	return true;
 }
 
@@ -206,46 +213,38 @@ void ElementLottie::UpdateTexture()
 		return;
 	}
 
-	// Resize the texture buffer if necessary.
-	const size_t new_texture_data_size = 4 * render_dimensions.x * render_dimensions.y;
-	if (new_texture_data_size > texture_data_size)
-	{
-		texture_data.reset(new byte[new_texture_data_size]);
-		texture_data_size = new_texture_data_size;
-	}
+	if (texture_size_dirty)
+		frame_renderer->SetDimensions(render_dimensions);
+
+	// Keep displaying the current frame rather than waiting for the background rendering of a frame that was skipped past, we will be updated
+	// again shortly.
+	if (frame_renderer->IsBusy(next_frame))
+		return;
+
+	// Predict the frame displayed after this one from the time between our texture updates, so that it can be rendered ahead of time. When
+	// updated faster than the animation's frame rate, this is simply the following frame.
+	const double frame_duration = 1.0 / animation->frameRate();
+	const double update_interval = (time_prev_texture_update < 0.0 ? frame_duration : Math::Max(t - time_prev_texture_update, frame_duration));
+	const double predicted_pos = std::modf((t + update_interval - time_animation_start) / animation->duration(), &_unused);
+
+	size_t predicted_frame = animation->frameAtPos(predicted_pos);
+	if (predicted_frame == next_frame)
+		predicted_frame = (next_frame + 1) % animation->totalFrame();
+
+	// The frame data is valid until the next frame is rendered, at which point this texture is replaced.
+	const Span<const byte> frame_data = frame_renderer->RenderFrame(next_frame, predicted_frame);
 
 	// Callback for generating texture.
-	auto texture_callback = [this, next_frame](const CallbackTextureInterface& texture_interface) -> bool {
-		RMLUI_ASSERT(animation);
-
-		const size_t bytes_per_line = 4 * render_dimensions.x;
-		const size_t total_bytes = bytes_per_line * render_dimensions.y;
-		byte* p_data = texture_data.get();
-
-		rlottie::Surface surface(reinterpret_cast<uint32_t*>(p_data), render_dimensions.x, render_dimensions.y, bytes_per_line);
-		animation->renderSync(next_frame, surface);
-
-		// Swizzle the channel order from rlottie's BGRA to RmlUi's RGBA.
-		for (size_t i = 0; i < total_bytes; i += 4)
-		{
-			// Swap the RB order for correct color channels.
-			std::swap(p_data[i], p_data[i + 2]);
-
-#ifdef RMLUI_DEBUG
-			const byte alpha = p_data[i + 3];
-			for (int c = 0; c < 3; c++)
-				RMLUI_ASSERTMSG(p_data[i + c] <= alpha, "Glyph data is assumed to be encoded in premultiplied alpha, but that is not the case.");
-#endif
-		}
-
-		if (!texture_interface.GenerateTexture({p_data, total_bytes}, render_dimensions))
+	auto texture_callback = [frame_data, dimensions = render_dimensions](const CallbackTextureInterface& texture_interface) -> bool {
+		if (frame_data.empty())
 			return false;
-		return true;
+		return texture_interface.GenerateTexture(frame_data, dimensions);
 	};
 
 	texture = render_manager->MakeCallbackTexture(std::move(texture_callback));
 
 	prev_animation_frame = next_frame;
+	time_prev_texture_update = t;
 	texture_size_dirty = false;
 }
 
@@ -0,0 +1,240 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "LottieFrameRenderer.h"
+#include "../../Include/RmlUi/Core/Debug.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
+namespace Rml {
+namespace Lottie {
+
+// Animations whose frames fit within this number of bytes have all their rendered frames kept, such as small looping icons.
+static constexpr size_t cached_frames_max_bytes = 4 * 1024 * 1024;
+
+struct LottieFrameCache {
+	Vector2i dimensions;
+
+	// Guards the frames, which may be rendered by elements in contexts rendered from different threads. Frames are never modified once set.
+	std::mutex mutex;
+	Vector<Vector<byte>> frames;
+};
+
+struct LottieFrameCacheData {
+	std::mutex mutex;
+	UnorderedMap<String, Vector<WeakPtr<LottieFrameCache>>> caches;
+};
+
+static LottieFrameCacheData& GetFrameCacheData()
+{
+	static LottieFrameCacheData data;
+	return data;
+}
+
+// Returns the frames of the given animation source at the given dimensions, creating them if they are not already in use by another renderer.
+static SharedPtr<LottieFrameCache> GetFrameCache(const String& source, Vector2i dimensions, size_t total_frames)
+{
+	LottieFrameCacheData& data = GetFrameCacheData();
+	std::lock_guard<std::mutex> lock(data.mutex);
+
+	Vector<WeakPtr<LottieFrameCache>>& source_caches = data.caches[source];
+	for (const WeakPtr<LottieFrameCache>& weak_cache : source_caches)
+	{
+		SharedPtr<LottieFrameCache> cache = weak_cache.lock();
+		if (cache && cache->dimensions == dimensions && cache->frames.size() == total_frames)
+			return cache;
+	}
+
+	auto cache = MakeShared<LottieFrameCache>();
+	cache->dimensions = dimensions;
+	cache->frames.resize(total_frames);
+	source_caches.push_back(cache);
+
+	return cache;
+}
+
+// Converts the pixels from rlottie's native-endian ARGB to RmlUi's RGBA byte order, assuming a little-endian platform.
+static void ConvertToRGBA(Vector<byte>& data)
+{
+	RMLUI_ZoneScoped;
+
+	// Operate on whole pixels so that the loop can be vectorized by the compiler, instead of swapping the channels byte by byte.
+	byte* p_data = data.data();
+	const size_t total_bytes = data.size();
+	for (size_t i = 0; i < total_bytes; i += 4)
+	{
+		uint32_t pixel;
+		memcpy(&pixel, p_data + i, 4);
+		pixel = (pixel & 0xff00ff00u) | ((pixel >> 16) & 0xffu) | ((pixel & 0xffu) << 16);
+		memcpy(p_data + i, &pixel, 4);
+	}
+
+#ifdef RMLUI_DEBUG
+	for (size_t i = 0; i < total_bytes; i += 4)
+	{
+		const byte alpha = p_data[i + 3];
+		for (int c = 0; c < 3; c++)
+			RMLUI_ASSERTMSG(p_data[i + c] <= alpha, "Lottie frame data is assumed to be encoded in premultiplied alpha, but that is not the case.");
+	}
+#endif
+}
+
+static rlottie::Surface MakeSurface(Vector<byte>& data, Vector2i dimensions)
+{
+	return rlottie::Surface(reinterpret_cast<uint32_t*>(data.data()), size_t(dimensions.x), size_t(dimensions.y), 4 * size_t(dimensions.x));
+}
+
+LottieFrameRenderer::LottieFrameRenderer(rlottie::Animation& animation, const String& source) : animation(animation), source(source) {}
+
+LottieFrameRenderer::~LottieFrameRenderer()
+{
+	// The background rendering writes into our buffer, make sure it is done before the buffer is destroyed.
+	FinishPendingFrame(size_t(-1));
+	ReleaseCachedFrames();
+}
+
+void LottieFrameRenderer::SetDimensions(Vector2i new_dimensions)
+{
+	if (new_dimensions == dimensions)
+		return;
+
+	FinishPendingFrame(size_t(-1));
+	dimensions = new_dimensions;
+
+	const size_t frame_bytes = 4 * size_t(dimensions.x) * size_t(dimensions.y);
+	const size_t total_frames = animation.totalFrame();
+
+	ReleaseCachedFrames();
+	if (frame_bytes > 0 && total_frames > 0 && total_frames <= cached_frames_max_bytes / frame_bytes)
+		cached_frames = GetFrameCache(source, dimensions, total_frames);
+}
+
+bool LottieFrameRenderer::IsBusy(size_t frame) const
+{
+	if (!pending_render.valid() || pending_frame == frame || GetCachedFrame(frame))
+		return false;
+
+	return pending_render.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+}
+
+Span<const byte> LottieFrameRenderer::RenderFrame(size_t frame, size_t next_frame)
+{
+	RMLUI_ZoneScoped;
+
+	const size_t frame_bytes = 4 * size_t(dimensions.x) * size_t(dimensions.y);
+	const size_t total_frames = animation.totalFrame();
+	if (frame_bytes == 0 || frame >= total_frames)
+		return {};
+
+	const Vector<byte>* result = GetCachedFrame(frame);
+
+	if (!result)
+	{
+		// Use the frame rendered in the background if it is the one we want, otherwise render it now.
+		if (FinishPendingFrame(frame))
+		{
+			std::swap(frame_data, pending_frame_data);
+		}
+		else
+		{
+			RMLUI_ZoneScopedN("Lottie render frame");
+			frame_data.resize(frame_bytes);
+			animation.renderSync(frame, MakeSurface(frame_data, dimensions));
+		}
+
+		ConvertToRGBA(frame_data);
+		result = &frame_data;
+
+		if (cached_frames)
+		{
+			std::lock_guard<std::mutex> lock(cached_frames->mutex);
+			if (cached_frames->frames[frame].empty())
+				cached_frames->frames[frame] = frame_data;
+		}
+	}
+
+	// Start rendering the frame expected to be displayed next, unless we already have it. The animation can only render a single frame at a
+	// time, so while it is still busy with a frame that was skipped we leave it for a later call instead of waiting.
+	if (next_frame < total_frames && !GetCachedFrame(next_frame) && !(pending_render.valid() && pending_frame == next_frame) &&
+		!IsBusy(next_frame))
+	{
+		FinishPendingFrame(size_t(-1));
+		pending_frame_data.resize(frame_bytes);
+		pending_frame = next_frame;
+		pending_render = animation.render(next_frame, MakeSurface(pending_frame_data, dimensions));
+	}
+
+	return {result->data(), result->size()};
+}
+
+bool LottieFrameRenderer::FinishPendingFrame(size_t frame)
+{
+	if (!pending_render.valid())
+		return false;
+
+	pending_render.get();
+	return pending_frame == frame;
+}
+
+const Vector<byte>* LottieFrameRenderer::GetCachedFrame(size_t frame) const
+{
+	if (!cached_frames || frame >= cached_frames->frames.size())
+		return nullptr;
+
+	std::lock_guard<std::mutex> lock(cached_frames->mutex);
+	const Vector<byte>& data = cached_frames->frames[frame];
+	return data.empty() ? nullptr : &data;
+}
+
+void LottieFrameRenderer::ReleaseCachedFrames()
+{
+	if (!cached_frames)
+		return;
+
+	LottieFrameCacheData& data = GetFrameCacheData();
+	std::lock_guard<std::mutex> lock(data.mutex);
+	cached_frames.reset();
+
+	// Remove the entries of frames no longer in use by any renderer, such as those of previous sizes.
+	auto it = data.caches.find(source);
+	if (it == data.caches.end())
+		return;
+
+	Vector<WeakPtr<LottieFrameCache>>& source_caches = it->second;
+	auto is_expired = [](const WeakPtr<LottieFrameCache>& cache) { return cache.expired(); };
+	source_caches.erase(std::remove_if(source_caches.begin(), source_caches.end(), is_expired), source_caches.end());
+
+	if (source_caches.empty())
+		data.caches.erase(it);
+}
+
+} // namespace Lottie
+} // namespace Rml
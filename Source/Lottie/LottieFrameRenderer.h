@@ -0,0 +1,95 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_LOTTIE_LOTTIE_FRAME_RENDERER_H
+#define RMLUI_LOTTIE_LOTTIE_FRAME_RENDERER_H
+
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <future>
+#include <rlottie.h>
+
+namespace Rml {
+namespace Lottie {
+
+	struct LottieFrameCache;
+
+	/**
+	    Renders the frames of a lottie animation for display.
+
+	    The frame expected to be displayed next is rendered ahead of time in the background. Animations whose frames all fit within a small memory
+	    budget additionally keep every rendered frame, so that they only need to be rendered during the first loop. These frames are shared between
+	    all renderers of the same animation source at the same dimensions.
+	 */
+	class LottieFrameRenderer : NonCopyMoveable {
+	public:
+		/// @param[in] animation The animation to render, must outlive this object.
+		/// @param[in] source The path the animation was loaded from, used to share rendered frames with renderers of the same animation.
+		LottieFrameRenderer(rlottie::Animation& animation, const String& source);
+		~LottieFrameRenderer();
+
+		/// Sets the dimensions of the rendered frames, discarding any frames rendered at other dimensions.
+		void SetDimensions(Vector2i dimensions);
+
+		/// Returns true if the given frame can not be rendered without waiting for a different frame still being rendered in the background.
+		bool IsBusy(size_t frame) const;
+
+		/// Returns the data of the given frame in premultiplied RGBA-ordering, and starts rendering the next frame in the background.
+		/// @param[in] frame The frame to render.
+		/// @param[in] next_frame The frame expected to be displayed after this one.
+		/// @lifetime The returned data is valid until the next call to this object.
+		Span<const byte> RenderFrame(size_t frame, size_t next_frame);
+
+	private:
+		// Waits for any frame being rendered in the background, and returns true if it is the given frame.
+		bool FinishPendingFrame(size_t frame);
+		// Returns the shared data of the given frame, or nullptr if it has not been rendered yet.
+		const Vector<byte>* GetCachedFrame(size_t frame) const;
+		// Releases our reference to the shared frames, removing them from the cache if they are no longer in use.
+		void ReleaseCachedFrames();
+
+		rlottie::Animation& animation;
+		String source;
+		Vector2i dimensions;
+
+		// The data of the most recently returned frame.
+		Vector<byte> frame_data;
+
+		// The buffer that the next frame is rendered into in the background, and the frame number being rendered.
+		Vector<byte> pending_frame_data;
+		size_t pending_frame = size_t(-1);
+		std::future<rlottie::Surface> pending_render;
+
+		// Rendered frames indexed by frame number, null unless the whole animation fits within the budget.
+		SharedPtr<LottieFrameCache> cached_frames;
+	};
+
+} // namespace Lottie
+} // namespace Rml
+
+#endif
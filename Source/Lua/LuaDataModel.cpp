@@ -194,6 +194,12 @@ int LuaTableDef::Size(void* ptr)
 	{
 		return 0;
 	}
+	// Plain tables can't raise errors, only tables with metamethods need a protected call.
+	if (!lua_getmetatable(L, id))
+	{
+		return (int)lua_rawlen(L, id);
+	}
+	lua_pop(L, 1);
 	lua_pushcfunction(L, lLuaTableDefSize);
 	lua_pushvalue(L, id);
 	if (LUA_OK != lua_pcall(L, 1, 1, 0))
@@ -220,6 +226,21 @@ DataVariable LuaTableDef::Child(void* ptr, const DataAddressEntry& address)
 	{
 		return DataVariable{};
 	}
+	// Plain tables can't raise errors, only tables with metamethods need a protected call.
+	if (!lua_getmetatable(L, id))
+	{
+		if (address.index == -1)
+		{
+			lua_pushlstring(L, address.name.data(), address.name.size());
+			lua_rawget(L, id);
+		}
+		else
+		{
+			lua_rawgeti(L, id, address.index + 1);
+		}
+		return DataVariable(model->tableDef, (void*)(intptr_t)lua_gettop(L));
+	}
+	lua_pop(L, 1);
 	lua_pushcfunction(L, lLuaTableDefChild);
 	lua_pushvalue(L, id);
 	if (address.index == -1)
@@ -249,6 +270,199 @@ DataVariable LuaScalarDef::Child(void* ptr, const DataAddressEntry& address)
 	return LuaTableDef::Child(ptr, address);
 }
 
+#if LUA_VERSION_NUM >= 503
+// Tables nested in the data model are handed to scripts wrapped in proxy tables, so that writes to their fields dirty the variable they belong
+// to. Lua 5.3 is required for the table library and 'ipairs' to operate through the metamethods of the proxies.
+	#define RMLUI_LUA_DATAMODEL_PROXIES
+
+// The proxy state table is placed on the stack of the data thread, after the table of variable ids.
+static constexpr int proxy_state_id = 2;
+
+enum ProxyStateField {
+	ProxyMetatable = 1, // The metatable shared by all proxies of the model.
+	ProxyTargets,       // Maps each proxy to its target table.
+	ProxyVariables,     // Maps each proxy to the name of the variable containing its target table.
+	ProxyCache,         // Maps each target table to its most recent proxy.
+};
+
+static void NewWeakTable(lua_State* L, const char* mode)
+{
+	lua_newtable(L);
+	lua_newtable(L);
+	lua_pushstring(L, mode);
+	lua_setfield(L, -2, "__mode");
+	lua_setmetatable(L, -2);
+}
+
+// Replaces the value at the given index with its target table if the value is a proxy, so that proxies are never stored in the model.
+static void UnwrapProxy(lua_State* L, int state, int index)
+{
+	index = lua_absindex(L, index);
+	if (lua_type(L, index) != LUA_TTABLE)
+		return;
+	lua_rawgeti(L, state, ProxyTargets);
+	lua_pushvalue(L, index);
+	if (lua_rawget(L, -2) == LUA_TTABLE)
+		lua_replace(L, index);
+	else
+		lua_pop(L, 1);
+	lua_pop(L, 1); // pop the targets table
+}
+
+// Replaces the table at the top of the stack with a proxy, which dirties the variable whose name is located at the given index when written to.
+static void WrapTable(lua_State* L, int state, int variable)
+{
+	if (lua_type(L, -1) != LUA_TTABLE)
+		return;
+	const int target = lua_gettop(L);
+
+	// The table may already be a proxy, such as when a script has stored one in a table of its own.
+	lua_rawgeti(L, state, ProxyTargets);
+	lua_pushvalue(L, target);
+	const bool is_proxy = (lua_rawget(L, -2) != LUA_TNIL);
+	lua_settop(L, target);
+	if (is_proxy)
+		return;
+
+	// Reuse the previous proxy of the table when it belongs to the same variable, so that repeated lookups return equal values.
+	lua_rawgeti(L, state, ProxyCache);
+	const int cache = target + 1;
+	lua_pushvalue(L, target);
+	if (lua_rawget(L, cache) == LUA_TTABLE)
+	{
+		lua_rawgeti(L, state, ProxyVariables);
+		lua_pushvalue(L, -2);
+		lua_rawget(L, -2);
+		if (lua_rawequal(L, -1, variable))
+		{
+			lua_copy(L, cache + 1, target);
+			lua_settop(L, target);
+			return;
+		}
+	}
+	lua_settop(L, cache);
+
+	lua_newtable(L);
+	const int proxy = cache + 1;
+	lua_rawgeti(L, state, ProxyMetatable);
+	lua_setmetatable(L, proxy);
+
+	lua_rawgeti(L, state, ProxyTargets);
+	lua_pushvalue(L, proxy);
+	lua_pushvalue(L, target);
+	lua_rawset(L, -3);
+	lua_pop(L, 1);
+
+	lua_rawgeti(L, state, ProxyVariables);
+	lua_pushvalue(L, proxy);
+	lua_pushvalue(L, variable);
+	lua_rawset(L, -3);
+	lua_pop(L, 1);
+
+	lua_pushvalue(L, target);
+	lua_pushvalue(L, proxy);
+	lua_rawset(L, cache);
+
+	lua_copy(L, proxy, target);
+	lua_settop(L, target);
+}
+
+// The proxy metamethods have the model and the proxy state as upvalues, and the proxy as their first argument.
+static void PushProxyField(lua_State* L, ProxyStateField field)
+{
+	lua_rawgeti(L, lua_upvalueindex(2), field);
+	lua_pushvalue(L, 1);
+	lua_rawget(L, -2);
+	lua_remove(L, -2);
+}
+
+static int lProxyIndex(lua_State* L)
+{
+	lua_settop(L, 2);
+	PushProxyField(L, ProxyTargets);
+	PushProxyField(L, ProxyVariables);
+	lua_pushvalue(L, 2);
+	lua_gettable(L, 3);
+	WrapTable(L, lua_upvalueindex(2), 4);
+	return 1;
+}
+
+static int lProxyNewIndex(lua_State* L)
+{
+	struct LuaDataModel* D = (struct LuaDataModel*)lua_touserdata(L, lua_upvalueindex(1));
+	if (D->dataL == nullptr)
+		luaL_error(L, "DataModel released");
+	lua_settop(L, 3);
+	UnwrapProxy(L, lua_upvalueindex(2), 3);
+	PushProxyField(L, ProxyTargets);
+	lua_pushvalue(L, 2);
+	lua_pushvalue(L, 3);
+	lua_settable(L, 4);
+	PushProxyField(L, ProxyVariables);
+	D->handle.DirtyVariable(lua_tostring(L, -1));
+	return 0;
+}
+
+static int lProxyLen(lua_State* L)
+{
+	PushProxyField(L, ProxyTargets);
+	lua_len(L, -1);
+	return 1;
+}
+
+static int lProxyNext(lua_State* L)
+{
+	lua_settop(L, 2);
+	PushProxyField(L, ProxyTargets);
+	PushProxyField(L, ProxyVariables);
+	lua_pushvalue(L, 2);
+	if (lua_next(L, 3) == 0)
+	{
+		lua_pushnil(L);
+		return 1;
+	}
+	WrapTable(L, lua_upvalueindex(2), 4);
+	return 2;
+}
+
+static int lProxyPairs(lua_State* L)
+{
+	lua_pushvalue(L, lua_upvalueindex(1));
+	lua_pushvalue(L, lua_upvalueindex(2));
+	lua_pushcclosure(L, lProxyNext, 2);
+	lua_pushvalue(L, 1);
+	lua_pushnil(L);
+	return 3;
+}
+
+// Pushes a new proxy state for the model userdata located at the given index.
+static void NewProxyState(lua_State* L, int model_index)
+{
+	lua_createtable(L, 4, 0);
+	const int state = lua_gettop(L);
+
+	lua_newtable(L);
+	luaL_Reg l[] = {
+		{"__index", lProxyIndex},
+		{"__newindex", lProxyNewIndex},
+		{"__len", lProxyLen},
+		{"__pairs", lProxyPairs},
+		{nullptr, nullptr},
+	};
+	lua_pushvalue(L, model_index);
+	lua_pushvalue(L, state);
+	luaL_setfuncs(L, l, 2);
+	lua_rawseti(L, state, ProxyMetatable);
+
+	NewWeakTable(L, "k");
+	lua_rawseti(L, state, ProxyTargets);
+	NewWeakTable(L, "k");
+	lua_rawseti(L, state, ProxyVariables);
+	NewWeakTable(L, "kv");
+	lua_rawseti(L, state, ProxyCache);
+}
+#endif
+
 static void BindVariable(struct LuaDataModel* D, lua_State* L)
 {
 	lua_State* dataL = D->dataL;
@@ -313,6 +527,15 @@ static int lDataModelGet(lua_State* L)
 	int id = getId(L, dataL);
 	lua_pushvalue(dataL, id);
 	lua_xmove(dataL, L, 1);
+#ifdef RMLUI_LUA_DATAMODEL_PROXIES
+	if (lua_type(L, -1) == LUA_TTABLE)
+	{
+		lua_pushvalue(dataL, proxy_state_id);
+		lua_xmove(dataL, L, 1);
+		lua_insert(L, -2);
+		WrapTable(L, lua_gettop(L) - 1, 2);
+	}
+#endif
 	return 1;
 }
 
@@ -323,6 +546,13 @@ static int lDataModelSet(lua_State* L)
 	if (dataL == NULL)
 		luaL_error(L, "DataModel released");
 	lua_settop(dataL, D->top);
+	lua_settop(L, 3);
+#ifdef RMLUI_LUA_DATAMODEL_PROXIES
+	lua_pushvalue(dataL, proxy_state_id);
+	lua_xmove(dataL, L, 1);
+	UnwrapProxy(L, 4, 3);
+	lua_pop(L, 1);
+#endif
 
 	lua_pushvalue(L, 2);
 	lua_xmove(L, dataL, 1);
@@ -357,6 +587,9 @@ bool OpenLuaDataModel(lua_State* L, Context* context, int name_index, int table_
 	}
 
 	struct LuaDataModel* D = (struct LuaDataModel*)lua_newuserdata(L, sizeof(*D));
+#ifdef RMLUI_LUA_DATAMODEL_PROXIES
+	const int model_index = lua_gettop(L);
+#endif
 	D->dataL = nullptr;
 	D->scalarDef = nullptr;
 	D->tableDef = nullptr;
@@ -368,6 +601,11 @@ bool OpenLuaDataModel(lua_State* L, Context* context, int name_index, int table_
 	D->dataL = lua_newthread(L);
 	D->top = 1;
 	lua_newtable(D->dataL);
+#ifdef RMLUI_LUA_DATAMODEL_PROXIES
+	NewProxyState(L, model_index);
+	lua_xmove(L, D->dataL, 1);
+	D->top = proxy_state_id;
+#endif
 	lua_pushnil(L);
 	while (lua_next(L, table_index) != 0)
 	{
@@ -36,13 +36,54 @@ namespace Rml {
 namespace Lua {
 typedef ElementDocument Document;
 
-LuaEventListener::LuaEventListener(const String& code, Element* element) : EventListener()
+// Pushes the function for the given inline handler code on to the stack. Inline handlers are often instantiated many times with the same
+// code, such as in templates and data-for loops, so the compiled functions are cached by their code and shared between listeners.
+static bool PushInlineFunction(lua_State* L, const String& code)
 {
-	// compose function
-	String function = "return function (event,element,document) ";
-	function.append(code);
-	function.append(" end");
+	lua_getglobal(L, "EVENTLISTENERCHUNKS");
+	if (lua_isnoneornil(L, -1))
+	{
+		lua_pop(L, 1); // pop the unsucessful getglobal
+		lua_newtable(L);
+		// Reference the functions weakly, so that they are collected once all the listeners using them are destroyed.
+		lua_newtable(L);
+		lua_pushstring(L, "v");
+		lua_setfield(L, -2, "__mode");
+		lua_setmetatable(L, -2);
+		lua_pushvalue(L, -1);
+		lua_setglobal(L, "EVENTLISTENERCHUNKS");
+	}
+	int cache = lua_gettop(L);
 
+	lua_pushlstring(L, code.c_str(), code.length());
+	lua_rawget(L, cache);
+	if (!lua_isfunction(L, -1))
+	{
+		lua_pop(L, 1); // pop the cache miss
+
+		// compose function
+		String function = "return function (event,element,document) ";
+		function.append(code);
+		function.append(" end");
+
+		// compile and execute the chunk to get the function
+		if (!Interpreter::LoadString(function, code) || !Interpreter::ExecuteCall(0, 1))
+		{
+			lua_pop(L, 1); // pop the cache table
+			return false;
+		}
+
+		lua_pushlstring(L, code.c_str(), code.length());
+		lua_pushvalue(L, -2);
+		lua_rawset(L, cache);
+	}
+
+	lua_remove(L, cache);
+	return true;
+}
+
+LuaEventListener::LuaEventListener(const String& code, Element* element) : EventListener()
+{
 	// make sure there is an area to save the function
 	lua_State* L = Interpreter::GetLuaState();
 	int top = lua_gettop(L);
@@ -56,9 +97,10 @@ LuaEventListener::LuaEventListener(const String& code, Element* element) : Event
 	}
 	int tbl = lua_gettop(L);
 
-	// compile,execute,and save the function
-	if (!Interpreter::LoadString(function, code) || !Interpreter::ExecuteCall(0, 1))
+	// get the compiled function, and save it
+	if (!PushInlineFunction(L, code))
 	{
+		lua_settop(L, top);
 		return;
 	}
 
@@ -70,7 +112,7 @@ LuaEventListener::LuaEventListener(const String& code, Element* element) : Event
 		owner_document = element->GetOwnerDocument();
 	else
 		owner_document = nullptr;
-	strFunc = function;
+	strFunc = code;
 	lua_settop(L, top);
 }
 
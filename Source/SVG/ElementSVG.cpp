@@ -28,16 +28,15 @@
 
 #include "../../Include/RmlUi/SVG/ElementSVG.h"
 #include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/ElementDocument.h"
-#include "../../Include/RmlUi/Core/FileInterface.h"
-#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/MeshUtilities.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/RenderManager.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "SVGCache.h"
 #include <cmath>
-#include <lunasvg.h>
 #include <string.h>
 
 namespace Rml {
@@ -76,7 +75,18 @@ void ElementSVG::OnRender()
 			GenerateGeometry();
 
 		UpdateTexture();
-		geometry.Render(GetAbsoluteOffset(BoxArea::Content), Texture(texture));
+
+		// Nothing is rendered until the first texture has been rasterized.
+		if (texture)
+			geometry.Render(GetAbsoluteOffset(BoxArea::Content), texture);
+
+		// The texture is rasterized again in the background if it has to be regenerated, such as after textures have been released. Make sure
+		// we are rendered again to pick it up.
+		if (svg_texture && !svg_texture->IsReady())
+		{
+			if (Context* context = GetContext())
+				context->RequestNextUpdate(0);
+		}
 	}
 }
 
@@ -133,6 +143,8 @@ bool ElementSVG::LoadSource()
 	texture_dirty = true;
 	intrinsic_dimensions = Vector2f{};
 	texture = {};
+	svg_texture.reset();
+	pending_svg_texture.reset();
 	svg_document.reset();
 
 	const String attribute_src = GetAttribute<String>("src", "");
@@ -150,58 +162,45 @@ bool ElementSVG::LoadSource()
 		GetSystemInterface()->JoinPath(directory, document_source_url, "");
 	}
 
-	String svg_data;
-
-	if (path.empty() || !GetFileInterface()->LoadFile(path, svg_data))
-	{
-		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG file %s", path.c_str());
-		return false;
-	}
-
-	// We use a reset-release approach here in case clients use a non-std unique_ptr (lunasvg uses std::unique_ptr)
-	svg_document.reset(lunasvg::Document::loadFromData(svg_data).release());
-
+	// Documents are shared between all elements showing the same file, so that each file is only parsed once.
+	svg_document = SVG::SVGCache::GetDocument(path);
 	if (!svg_document)
-	{
-		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG data from file %s", path.c_str());
 		return false;
-	}
 
-	intrinsic_dimensions.x = Math::Max(float(svg_document->width()), 1.0f);
-	intrinsic_dimensions.y = Math::Max(float(svg_document->height()), 1.0f);
+	intrinsic_dimensions = svg_document->intrinsic_dimensions;
 
 	return true;
 }
 
 void ElementSVG::UpdateTexture()
 {
-	if (!svg_document || !texture_dirty)
+	if (!svg_document)
 		return;
 
 	RenderManager* render_manager = GetRenderManager();
 	if (!render_manager)
 		return;
 
-	// Callback for generating texture.
-	auto texture_callback = [this](const CallbackTextureInterface& texture_interface) -> bool {
-		RMLUI_ASSERT(svg_document);
-		lunasvg::Bitmap bitmap = svg_document->renderToBitmap(render_dimensions.x, render_dimensions.y);
-
-		// Swap red and blue channels, assuming LunaSVG v2.3.2 or newer, to convert to RmlUi's expected RGBA-ordering.
-		const size_t bitmap_byte_size = bitmap.width() * bitmap.height() * 4;
-		uint8_t* bitmap_data = bitmap.data();
-		for (size_t i = 0; i < bitmap_byte_size; i += 4)
-			std::swap(bitmap_data[i], bitmap_data[i + 2]);
-
-		if (!bitmap.valid() || !bitmap.data())
-			return false;
-		if (!texture_interface.GenerateTexture({reinterpret_cast<const Rml::byte*>(bitmap.data()), bitmap_byte_size}, render_dimensions))
-			return false;
-		return true;
-	};
-
-	texture = render_manager->MakeCallbackTexture(std::move(texture_callback));
-	texture_dirty = false;
+	if (texture_dirty)
+	{
+		// Textures are shared between all elements showing the same file at the same size, the image color is applied by the geometry.
+		pending_svg_texture = SVG::SVGCache::GetTexture(svg_document, render_dimensions);
+		texture_dirty = false;
+	}
+
+	if (pending_svg_texture)
+	{
+		if (pending_svg_texture->IsReady())
+		{
+			svg_texture = std::move(pending_svg_texture);
+			texture = svg_texture->texture_source.GetTexture(*render_manager);
+		}
+		else if (Context* context = GetContext())
+		{
+			// Make sure we are rendered again to pick up the texture once it has been rasterized.
+			context->RequestNextUpdate(0);
+		}
+	}
 }
 
 } // namespace Rml
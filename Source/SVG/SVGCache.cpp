@@ -0,0 +1,267 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "SVGCache.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/FileInterface.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include <algorithm>
+#include <condition_variable>
+#include <lunasvg.h>
+#include <thread>
+
+namespace Rml {
+namespace SVG {
+
+	struct SVGCacheData {
+		std::mutex mutex;
+		UnorderedMap<String, WeakPtr<SVGDocument>> documents;
+
+		// Bitmaps waiting to be rasterized by the worker thread. Bitmaps no longer in use when their turn comes are skipped, such as those of
+		// intermediate sizes while an element is being resized.
+		Queue<WeakPtr<SVGBitmap>> queued_bitmaps;
+		std::condition_variable queue_condition;
+		std::thread worker;
+		bool stop_worker = false;
+
+		~SVGCacheData() { RMLUI_ASSERT(!worker.joinable()); }
+	};
+
+	static SVGCacheData& GetCacheData()
+	{
+		static SVGCacheData data;
+		return data;
+	}
+
+	static Vector<byte> Rasterize(SVGDocument& svg, Vector2i dimensions)
+	{
+		RMLUI_ZoneScoped;
+
+		Vector<byte> data;
+		{
+			std::lock_guard<std::mutex> lock(svg.render_mutex);
+			lunasvg::Bitmap bitmap = svg.document->renderToBitmap(dimensions.x, dimensions.y);
+			if (!bitmap.valid() || !bitmap.data())
+				return data;
+
+			const byte* bitmap_data = reinterpret_cast<const byte*>(bitmap.data());
+			data.assign(bitmap_data, bitmap_data + bitmap.width() * bitmap.height() * 4);
+		}
+
+		// Swap red and blue channels, assuming LunaSVG v2.3.2 or newer, to convert to RmlUi's expected RGBA-ordering.
+		for (size_t i = 0; i < data.size(); i += 4)
+			std::swap(data[i], data[i + 2]);
+
+		return data;
+	}
+
+	static void RasterizeQueuedBitmaps()
+	{
+		SVGCacheData& data = GetCacheData();
+		std::unique_lock<std::mutex> lock(data.mutex);
+
+		while (true)
+		{
+			data.queue_condition.wait(lock, [&data] { return data.stop_worker || !data.queued_bitmaps.empty(); });
+			if (data.stop_worker)
+				return;
+
+			SharedPtr<SVGBitmap> bitmap = data.queued_bitmaps.front().lock();
+			data.queued_bitmaps.pop();
+			if (!bitmap)
+				continue;
+
+			lock.unlock();
+
+			Vector<byte> bitmap_data = Rasterize(*bitmap->document, bitmap->dimensions);
+			{
+				std::lock_guard<std::mutex> data_lock(bitmap->data_mutex);
+				bitmap->data = std::move(bitmap_data);
+			}
+			bitmap->ready.store(true, std::memory_order_release);
+			bitmap.reset();
+
+			lock.lock();
+		}
+	}
+
+	// Queues the bitmap to be rasterized by the worker thread, must be called with the cache locked.
+	static void QueueBitmap(SVGCacheData& data, const SharedPtr<SVGBitmap>& bitmap)
+	{
+		data.queued_bitmaps.push(bitmap);
+		if (!data.worker.joinable())
+			data.worker = std::thread(RasterizeQueuedBitmaps);
+		data.queue_condition.notify_one();
+	}
+
+	static bool GenerateTexture(const SharedPtr<SVGBitmap>& bitmap, const CallbackTextureInterface& texture_interface)
+	{
+		std::lock_guard<std::mutex> lock(bitmap->data_mutex);
+		if (!bitmap->ready.load(std::memory_order_acquire))
+			return false;
+
+		// The data is released after the first texture has been generated from it. Any later textures, such as when used with another render
+		// manager or after textures have been released, wait for the bitmap to be rasterized again in the background. Until then, generating the
+		// texture fails, and it is retried the next time the texture is used.
+		if (bitmap->data.empty())
+		{
+			bitmap->ready.store(false, std::memory_order_release);
+
+			SVGCacheData& data = GetCacheData();
+			std::lock_guard<std::mutex> cache_lock(data.mutex);
+			QueueBitmap(data, bitmap);
+			return false;
+		}
+
+		const bool result = texture_interface.GenerateTexture({bitmap->data.data(), bitmap->data.size()}, bitmap->dimensions);
+		Vector<byte>().swap(bitmap->data);
+
+		return result;
+	}
+
+	// Removes the document from the cache once it is no longer used by any element, thus documents must never be released while the cache is locked.
+	SVGDocument::~SVGDocument()
+	{
+		SVGCacheData& data = GetCacheData();
+		std::lock_guard<std::mutex> lock(data.mutex);
+
+		// The entry may already refer to a newer document of the same path, such as one loaded by another element while this one was in use.
+		auto it = data.documents.find(path);
+		if (it != data.documents.end() && it->second.expired())
+			data.documents.erase(it);
+	}
+
+	SharedPtr<SVGDocument> SVGCache::GetDocument(const String& path)
+	{
+		SVGCacheData& data = GetCacheData();
+		{
+			std::lock_guard<std::mutex> lock(data.mutex);
+			auto it = data.documents.find(path);
+			if (it != data.documents.end())
+			{
+				if (SharedPtr<SVGDocument> document = it->second.lock())
+					return document;
+			}
+		}
+
+		RMLUI_ZoneScoped;
+
+		// Load and parse the file outside the lock, so that other elements can use the cache in the meantime.
+		String svg_data;
+		if (path.empty() || !GetFileInterface()->LoadFile(path, svg_data))
+		{
+			Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG file %s", path.c_str());
+			return nullptr;
+		}
+
+		auto document = MakeShared<SVGDocument>();
+		document->path = path;
+
+		// We use a reset-release approach here in case clients use a non-std unique_ptr (lunasvg uses std::unique_ptr)
+		document->document.reset(lunasvg::Document::loadFromData(svg_data).release());
+
+		if (!document->document)
+		{
+			Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG data from file %s", path.c_str());
+			return nullptr;
+		}
+
+		document->intrinsic_dimensions.x = Math::Max(float(document->document->width()), 1.0f);
+		document->intrinsic_dimensions.y = Math::Max(float(document->document->height()), 1.0f);
+
+		// Another element may have loaded the same file in the meantime, keep using that one so that only a single document is shared. The lock is
+		// released before our own document, whose destructor uses the cache.
+		std::lock_guard<std::mutex> lock(data.mutex);
+		WeakPtr<SVGDocument>& entry = data.documents[path];
+		if (SharedPtr<SVGDocument> existing_document = entry.lock())
+			return existing_document;
+		entry = document;
+
+		return document;
+	}
+
+	SharedPtr<SVGTexture> SVGCache::GetTexture(const SharedPtr<SVGDocument>& document, Vector2i dimensions)
+	{
+		RMLUI_ASSERT(document);
+
+		SVGCacheData& data = GetCacheData();
+		std::lock_guard<std::mutex> lock(data.mutex);
+
+		Vector<WeakPtr<SVGTexture>>& textures = document->textures;
+		for (const WeakPtr<SVGTexture>& weak_texture : textures)
+		{
+			SharedPtr<SVGTexture> texture = weak_texture.lock();
+			if (texture && texture->bitmap->dimensions == dimensions)
+				return texture;
+		}
+
+		// Remove the textures no longer in use by any element, such as those of previous sizes.
+		textures.erase(std::remove_if(textures.begin(), textures.end(), [](const WeakPtr<SVGTexture>& texture) { return texture.expired(); }),
+			textures.end());
+
+		auto bitmap = MakeShared<SVGBitmap>();
+		bitmap->document = document;
+		bitmap->dimensions = dimensions;
+
+		auto texture = MakeShared<SVGTexture>();
+		texture->bitmap = bitmap;
+
+		// The texture owns the callback and any textures generated from it, thus the bitmap outlives the callback.
+		WeakPtr<SVGBitmap> weak_bitmap = bitmap;
+		texture->texture_source = CallbackTextureSource([weak_bitmap](const CallbackTextureInterface& texture_interface) {
+			SharedPtr<SVGBitmap> callback_bitmap = weak_bitmap.lock();
+			return callback_bitmap && GenerateTexture(callback_bitmap, texture_interface);
+		});
+
+		textures.push_back(texture);
+		QueueBitmap(data, bitmap);
+
+		return texture;
+	}
+
+	void SVGCache::Shutdown()
+	{
+		SVGCacheData& data = GetCacheData();
+		{
+			std::lock_guard<std::mutex> lock(data.mutex);
+			data.stop_worker = true;
+		}
+		data.queue_condition.notify_one();
+
+		if (data.worker.joinable())
+			data.worker.join();
+
+		std::lock_guard<std::mutex> lock(data.mutex);
+		data.queued_bitmaps = {};
+		data.stop_worker = false;
+	}
+
+} // namespace SVG
+} // namespace Rml
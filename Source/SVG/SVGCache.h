@@ -0,0 +1,116 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_SVG_SVG_CACHE_H
+#define RMLUI_SVG_SVG_CACHE_H
+
+#include "../../Include/RmlUi/Core/CallbackTexture.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <atomic>
+#include <mutex>
+
+namespace lunasvg {
+class Document;
+}
+
+namespace Rml {
+namespace SVG {
+
+	struct SVGTexture;
+
+	/**
+	    A parsed SVG document, shared between all elements showing the same file.
+	 */
+	struct SVGDocument {
+		// Removes the document's entry from the cache.
+		~SVGDocument();
+
+		String path;
+		UniquePtr<lunasvg::Document> document;
+		Vector2f intrinsic_dimensions;
+
+		// The textures rasterized from this document, guarded by the cache.
+		Vector<WeakPtr<SVGTexture>> textures;
+
+		// Guards rasterization, which may be requested by elements in contexts rendered from different threads.
+		std::mutex render_mutex;
+	};
+
+	/**
+	    A document rasterized to a bitmap of a given size, which is done on the worker thread of the cache.
+	 */
+	struct SVGBitmap {
+		SharedPtr<SVGDocument> document;
+		Vector2i dimensions;
+
+		// Set by the worker thread once the document has been rasterized, and cleared when it is queued to be rasterized again.
+		std::atomic<bool> ready{false};
+
+		// The rasterized data in RGBA-ordering, released once a texture has been generated from it. Any later textures generated from the bitmap,
+		// such as after textures have been released or for another render manager, queue the bitmap to be rasterized again.
+		Vector<byte> data;
+		std::mutex data_mutex;
+	};
+
+	/**
+	    A document rasterized at a given size, shared between all elements showing the same file at the same size.
+	 */
+	struct SVGTexture {
+		SharedPtr<SVGBitmap> bitmap;
+
+		// Generates and owns the texture for each render manager it is used with. Generating the texture fails while the bitmap is not ready.
+		CallbackTextureSource texture_source;
+
+		bool IsReady() const { return bitmap->ready.load(std::memory_order_acquire); }
+	};
+
+	/**
+	    Cache of SVG documents and their rasterized textures.
+
+	    Entries are reference counted by the elements holding on to them, and are removed from the cache as soon as the last reference is released.
+	    Textures are rasterized on a worker thread, so that large documents don't stall rendering. The cache may be used from multiple threads.
+	 */
+	class SVGCache {
+	public:
+		/// Returns the document at the given path, loading and parsing the file if it is not already in use.
+		/// @param[in] path The resolved path of the SVG file.
+		/// @return The parsed document, or nullptr if the file could not be loaded.
+		static SharedPtr<SVGDocument> GetDocument(const String& path);
+
+		/// Returns the texture of a document rasterized to the given dimensions, creating it if it is not already in use.
+		/// @note New textures are rasterized in the background, and must not be rendered until they are ready.
+		static SharedPtr<SVGTexture> GetTexture(const SharedPtr<SVGDocument>& document, Vector2i dimensions);
+
+		/// Stops the worker thread, discarding any pending rasterization.
+		static void Shutdown();
+	};
+
+} // namespace SVG
+} // namespace Rml
+
+#endif
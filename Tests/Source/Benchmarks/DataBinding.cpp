@@ -245,3 +245,82 @@ TEST_CASE("data_binding")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String progress_bars_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+		.track { width: 200px; height: 4px; }
+		.bar { height: 100%; background-color: #3a6; }
+	</style>
+</head>
+<body>
+<div id="bars" data-model="progress_bars">
+<div class="track" data-for="bar : bars"><div class="bar" data-style-width="bar.progress + '%'" data-style-opacity="bar.opacity"/></div>
+</div>
+</body>
+</rml>
+)";
+
+struct ProgressBar {
+	float progress = 0.f;
+	float opacity = 1.f;
+};
+
+TEST_CASE("data_binding.style")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<ProgressBar> bars(100);
+
+	DataModelConstructor constructor = context->CreateDataModel("progress_bars");
+	REQUIRE(constructor);
+	if (auto handle = constructor.RegisterStruct<ProgressBar>())
+	{
+		handle.RegisterMember("progress", &ProgressBar::progress);
+		handle.RegisterMember("opacity", &ProgressBar::opacity);
+	}
+	constructor.RegisterArray<Vector<ProgressBar>>();
+	constructor.Bind("bars", &bars);
+	DataModelHandle model_handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(progress_bars_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	ElementList bar_elements;
+	document->GetElementsByClassName(bar_elements, "bar");
+
+	nanobench::Bench bench;
+	bench.title("Data bindings: Style");
+	bench.relative(true);
+
+	int frame = 0;
+	bench.run("Reference (SetProperty)", [&] {
+		frame++;
+		for (size_t i = 0; i < bar_elements.size(); i++)
+		{
+			bar_elements[i]->SetProperty("width", Rml::ToString(float((frame + i) % 1000) * 0.1f) + "%");
+			bar_elements[i]->SetProperty("opacity", Rml::ToString(float((frame + i) % 100) * 0.01f));
+		}
+		context->Update();
+	});
+
+	bench.run("Animated progress bars", [&] {
+		frame++;
+		for (size_t i = 0; i < bars.size(); i++)
+		{
+			bars[i].progress = float((frame + i) % 1000) * 0.1f;
+			bars[i].opacity = float((frame + i) % 100) * 0.01f;
+		}
+		model_handle.DirtyVariable("bars");
+		context->Update();
+	});
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -68,12 +68,27 @@ TEST_CASE("data_expressions")
 		bench.run(execute_name, [&] { result &= interpreter.Run(); });
 
 		REQUIRE(result);
+
+		DataCompiler compiler(program, addresses, interface);
+		UniquePtr<CompiledProgram> compiled_program = compiler.Compile();
+		REQUIRE(compiled_program);
+		DataTypedInterpreter typed_interpreter(*compiled_program, addresses, interface);
+		Variant typed_result;
+
+		bench.run(String(execute_name) + " typed", [&] {
+			result &= typed_interpreter.Run();
+			typed_interpreter.GetResult(typed_result);
+		});
+
+		REQUIRE(result);
 	};
 
 	bench_expression("2 * 2", "Simple (parse)", "Simple (execute)");
 
 	bench_expression("true || false ? true && radius==1+2 ? 'Absolutely!' : color_value : 'no'", "Complex (parse)", "Complex (execute)");
 
+	bench_expression("radius * 2 + 1 > 10 ? radius / 3 + ' px' : 'none'", "Arithmetic (parse)", "Arithmetic (execute)");
+
 	auto bench_assignment = [&](const String& expression, const char* parse_name, const char* execute_name) {
 		DataParser parser(expression, interface);
 
@@ -89,6 +104,19 @@ TEST_CASE("data_expressions")
 		bench.run(execute_name, [&] { result &= interpreter.Run(); });
 
 		REQUIRE(result);
+
+		DataCompiler compiler(program, addresses, interface);
+		UniquePtr<CompiledProgram> compiled_program = compiler.Compile();
+		REQUIRE(compiled_program);
+		DataTypedInterpreter typed_interpreter(*compiled_program, addresses, interface);
+		Variant typed_result;
+
+		bench.run(String(execute_name) + " typed", [&] {
+			result &= typed_interpreter.Run();
+			typed_interpreter.GetResult(typed_result);
+		});
+
+		REQUIRE(result);
 	};
 
 	bench_assignment("radius = 15", "Simple assign (parse)", "Simple assign (execute)");
@@ -28,6 +28,8 @@
 
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/ConvolutionFilter.h>
+#include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
 #include <RmlUi/Core/Types.h>
@@ -44,7 +46,7 @@ static const String rml_font_effect_document = R"(
     <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
 	<style>
 		body {
-			font-size: 25px;
+			font-size: %dpx;
 			font-effect: %s(%dpx #ff6);
 		}
 	</style>
@@ -64,18 +66,25 @@ TEST_CASE("font_effect")
 	bench.title("Font effect");
 	bench.relative(true);
 
-	for (const char* effect_name : {"shadow", "blur", "outline", "glow"})
-	{
-		constexpr int effect_size = 8;
+	struct Case {
+		const char* effect_name;
+		int font_size;
+		int effect_size;
+	};
+	const Case cases[] = {{"shadow", 25, 8}, {"blur", 25, 8}, {"outline", 25, 8}, {"glow", 25, 8}, {"outline", 48, 12}, {"glow", 48, 12}};
 
-		const String rml_document = CreateString(rml_font_effect_document.size() + 100, rml_font_effect_document.c_str(), effect_name, effect_size);
+	for (const Case& test_case : cases)
+	{
+		const String rml_document = CreateString(rml_font_effect_document.size() + 100, rml_font_effect_document.c_str(), test_case.font_size,
+			test_case.effect_name, test_case.effect_size);
 
 		ElementDocument* document = context->LoadDocumentFromMemory(rml_document);
 		document->Show();
 		context->Update();
 		context->Render();
 
-		bench.run(effect_name, [&]() {
+		const String name = CreateString(64, "%s %dpx (font-size %dpx)", test_case.effect_name, test_case.effect_size, test_case.font_size);
+		bench.run(name, [&]() {
 			Rml::ReleaseFontResources();
 			context->Render();
 		});
@@ -85,3 +94,140 @@ TEST_CASE("font_effect")
 
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("font_effect.distance_field")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Text in many font sizes, as during a zoom or font-size animation.
+	String rml = "<rml><head><link type='text/rcss' href='/../Tests/Data/style.rcss'/></head><body>";
+	for (int size = 24; size <= 96; size += 4)
+		rml += CreateString(128, "<p style='font-size: %dpx; font-effect: outline(8px #ff6)'>The quick brown fox jumps over the lazy dog.</p>", size);
+	rml += "</body></rml>";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	nanobench::Bench bench;
+	bench.title("Font distance field");
+	bench.relative(true);
+
+	bench.run("Rasterized glyphs", [&]() {
+		Rml::ReleaseFontResources();
+		context->Render();
+	});
+
+	Rml::SetFontDistanceFieldThreshold(24);
+	bench.run("Distance field glyphs", [&]() {
+		Rml::ReleaseFontResources();
+		context->Render();
+	});
+	Rml::SetFontDistanceFieldThreshold(0);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+// Brute-force convolution, kept for comparison with the optimized filter.
+static void RunConvolutionReference(const Vector<float>& kernel, Vector2i kernel_radius, FilterOperation operation, byte* destination,
+	Vector2i destination_dimensions, const byte* source, Vector2i source_dimensions)
+{
+	const Vector2i kernel_size = kernel_radius * 2 + Vector2i(1);
+
+	for (int y = 0; y < destination_dimensions.y; ++y)
+	{
+		for (int x = 0; x < destination_dimensions.x; ++x)
+		{
+			float opacity = 0.f;
+
+			for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+			{
+				const int source_y = y - 2 * kernel_radius.y + kernel_y;
+
+				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+				{
+					const int source_x = x - 2 * kernel_radius.x + kernel_x;
+					if (source_y >= 0 && source_y < source_dimensions.y && source_x >= 0 && source_x < source_dimensions.x)
+					{
+						const float weight = kernel[kernel_y * kernel_size.x + kernel_x];
+						const float pixel_opacity = float(source[source_y * source_dimensions.x + source_x]) * weight;
+
+						switch (operation)
+						{
+						case FilterOperation::Sum: opacity += pixel_opacity; break;
+						case FilterOperation::Dilation: opacity = Math::Max(opacity, pixel_opacity); break;
+						}
+					}
+				}
+			}
+
+			destination[y * destination_dimensions.x + x] = byte(Math::Min(255.f, opacity));
+		}
+	}
+}
+
+TEST_CASE("font_effect.convolution_filter")
+{
+	// Roughly the size of a glyph in a 48px font.
+	const Vector2i source_dimensions(32, 40);
+	Vector<byte> source(source_dimensions.x * source_dimensions.y);
+	for (int y = 0; y < source_dimensions.y; y++)
+		for (int x = 0; x < source_dimensions.x; x++)
+			source[y * source_dimensions.x + x] = ((x / 6 + y / 8) % 2 == 0 ? 255 : 0);
+
+	nanobench::Bench bench;
+	bench.title("Convolution filter");
+	bench.relative(true);
+
+	constexpr int radius = 12;
+	const Vector2i destination_dimensions = source_dimensions + Vector2i(2 * radius);
+	Vector<byte> destination(destination_dimensions.x * destination_dimensions.y);
+
+	struct Case {
+		const char* name;
+		Vector2i kernel_radius;
+		FilterOperation operation;
+	};
+	const Case cases[] = {
+		{"Dilation, round kernel", Vector2i(radius), FilterOperation::Dilation},
+		{"Sum, horizontal kernel", Vector2i(radius, 0), FilterOperation::Sum},
+		{"Sum, vertical kernel", Vector2i(0, radius), FilterOperation::Sum},
+	};
+
+	for (const Case& test_case : cases)
+	{
+		const Vector2i kernel_size = test_case.kernel_radius * 2 + Vector2i(1);
+		Vector<float> kernel(kernel_size.x * kernel_size.y);
+
+		ConvolutionFilter filter;
+		filter.Initialise(test_case.kernel_radius, test_case.operation);
+		for (int y = 0; y < kernel_size.y; y++)
+		{
+			for (int x = 0; x < kernel_size.x; x++)
+			{
+				const Vector2i p = Vector2i(x, y) - test_case.kernel_radius;
+				const float distance = Math::SquareRoot(float(p.x * p.x + p.y * p.y));
+				float weight = 1.f / float(kernel_size.x * kernel_size.y);
+				if (test_case.operation == FilterOperation::Dilation)
+					weight = Math::Clamp(float(radius + 1) - distance, 0.f, 1.f);
+				kernel[y * kernel_size.x + x] = weight;
+				filter[y][x] = weight;
+			}
+		}
+
+		bench.run(String(test_case.name) + " (reference)", [&]() {
+			RunConvolutionReference(kernel, test_case.kernel_radius, test_case.operation, destination.data(), destination_dimensions, source.data(),
+				source_dimensions);
+			nanobench::doNotOptimizeAway(destination);
+		});
+
+		bench.run(test_case.name, [&]() {
+			filter.Run(destination.data(), destination_dimensions, destination_dimensions.x, ColorFormat::A8, source.data(), source_dimensions,
+				test_case.kernel_radius, ColorFormat::A8);
+			nanobench::doNotOptimizeAway(destination);
+		});
+	}
+}
@@ -293,3 +293,108 @@ TEST_CASE("Selectors")
 		context->Update();
 	}
 }
+
+TEST_CASE("Selectors.query")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_rows = 50;
+	const String rml = GenerateRml(num_rows);
+
+	// Benchmark the matching of selectors against elements in isolation, without any style computation, by querying all matching elements.
+	ElementDocument* document = context->LoadDocumentFromMemory(Rml::CreateString(1000, document_rml_template, ""));
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	el->SetInnerRML(rml);
+	context->Update();
+
+	nanobench::Bench bench;
+	bench.title("Selector query (selector)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	const Vector<String> selectors = {
+		"div",
+		".col",
+		"div.col4",
+		"#performance",
+		".row > .col",
+		".row .col4.assign_text",
+		"input.assign_range[type=range]",
+		"div.col:first-child",
+		"div:hover .col",
+		".inrow > .col ~ .col",
+		":not(.col) > div",
+	};
+
+	String msg = Rml::CreateString(128, "\nQuery selector on document with %d elements.", GetNumDescendentElements(document));
+	MESSAGE(msg);
+
+	ElementList elements;
+	for (const String& selector : selectors)
+	{
+		bench.run(selector, [&] {
+			elements.clear();
+			document->QuerySelectorAll(elements, selector);
+			nanobench::doNotOptimizeAway(elements.size());
+		});
+	}
+
+	document->Close();
+	context->Update();
+}
+
+TEST_CASE("Selectors.structural")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	static const String document_structural_rml = R"(
+<rml>
+<head>
+	<style>
+		body { font-family: LatoLatin; }
+		div.row { display: block; height: 2px; }
+		div.row:nth-child(odd) { background-color: #333; }
+		div.row:nth-last-of-type(3n) { border-left: 1px #f00; }
+		div.row:first-child, div.row:last-child { height: 4px; }
+	</style>
+</head>
+<body>
+<div id="rows"/>
+</body>
+</rml>
+)";
+
+	nanobench::Bench bench;
+	bench.title("Structural selectors (insert and remove a row)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	for (int num_rows : {100, 1000})
+	{
+		ElementDocument* document = context->LoadDocumentFromMemory(document_structural_rml);
+		REQUIRE(document);
+		document->Show();
+
+		Element* rows = document->GetElementById("rows");
+		for (int i = 0; i < num_rows; i++)
+			rows->AppendChild(document->CreateElement("div"))->SetClass("row", true);
+		context->Update();
+
+		// Inserting a row at the front changes the position of every other row, thereby requiring all of them to be matched again.
+		bench.run(CreateString(64, "%d rows", num_rows), [&] {
+			ElementPtr row = document->CreateElement("div");
+			row->SetClass("row", true);
+			Element* inserted_row = rows->InsertBefore(std::move(row), rows->GetFirstChild());
+			context->Update();
+			rows->RemoveChild(inserted_row);
+			context->Update();
+		});
+
+		document->Close();
+		context->Update();
+	}
+}
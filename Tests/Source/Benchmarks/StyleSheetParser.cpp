@@ -0,0 +1,73 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/StreamMemory.h>
+#include <RmlUi/Core/StyleSheetContainer.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const char* rule_template = R"(
+/* Rule %d, with a comment spanning
+   multiple lines. */
+div.panel-%d > p.item:hover, #panel-%d .header span
+{
+	width: %dpx;
+	height: 20px;
+	margin: 2px 4px;
+	color: #%06x; /* Comment after a property. */
+	background-color: rgba(30, 40, 50, 0.5);
+	font-family: "LatoLatin";
+	decorator: gradient(vertical #415857 #5990A3);
+}
+)";
+
+TEST_CASE("style_sheet_parser")
+{
+	TestsShell::GetContext();
+
+	String style_sheet;
+	for (int i = 0; style_sheet.size() < 300 * 1024; i++)
+		style_sheet += CreateString(1024, rule_template, i, i, i, 100 + i % 200, (i * 7919) & 0xffffff);
+
+	nanobench::Bench bench;
+	bench.title("StyleSheetParser");
+	bench.timeUnit(std::chrono::milliseconds(1), "ms");
+	bench.relative(true);
+
+	bench.run("Parse 300 KB style sheet", [&] {
+		StyleSheetContainer style_sheet_container;
+		StreamMemory stream(reinterpret_cast<const byte*>(style_sheet.data()), style_sheet.size());
+		style_sheet_container.LoadStyleSheetContainer(&stream, 1);
+	});
+
+	TestsShell::ShutdownShell();
+}
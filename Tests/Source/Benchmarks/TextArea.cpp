@@ -0,0 +1,107 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Elements/ElementFormControlTextArea.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String document_textarea_rml = R"(
+<rml>
+<head>
+	<link type="text/template" href="/assets/window.rml"/>
+	<title>Benchmark Sample</title>
+	<style>
+		body.window
+		{
+			left: 50px;
+			top: 50px;
+			width: 800px;
+			height: 600px;
+		}
+		textarea
+		{
+			display: block;
+			width: 500px;
+			height: 400px;
+		}
+	</style>
+</head>
+
+<body template="window">
+<textarea id="textarea"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("textarea")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_textarea_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* textarea = document->GetElementById("textarea");
+	REQUIRE(textarea);
+
+	nanobench::Bench bench;
+	bench.title("Textarea typing");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	for (int num_paragraphs : {10, 1000, 10000})
+	{
+		String value;
+		for (int i = 0; i < num_paragraphs; i++)
+			value += CreateString(128, "Log entry %d: some words that make up a typical line of the log, wrapping in the text area.\n", i);
+
+		rmlui_static_cast<ElementFormControlTextArea*>(textarea)->SetValue(value);
+		textarea->Focus();
+		context->Update();
+		context->Render();
+
+		bench.run(CreateString(64, "Type character with %d paragraphs", num_paragraphs), [&] {
+			textarea->DispatchEvent(EventId::Textinput, Dictionary{{"text", Variant("x")}});
+			context->Update();
+			TestsShell::BeginFrame();
+			context->Render();
+			TestsShell::PresentFrame();
+		});
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
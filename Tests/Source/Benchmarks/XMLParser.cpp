@@ -0,0 +1,84 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/BaseXMLParser.h>
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/StreamMemory.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const char* row_template = R"(
+		<tr class="row" id="row-%d" data-index="%d">
+			<td class="name" title="Item &amp; details %d">Item %d</td>
+			<td class="value" style="color: #%06x;">%d</td>
+			<td><input type="checkbox" name="selected" value="%d"/></td>
+		</tr>)";
+
+static String GenerateReportRml(int num_rows)
+{
+	String rml = R"(<rml><head><link type="text/rcss" href="/assets/rml.rcss"/></head><body style="font-family: LatoLatin;"><table>)";
+	for (int i = 0; i < num_rows; i++)
+		rml += CreateString(1024, row_template, i, i, i, i, (i * 7919) & 0xffffff, i * 3, i);
+	rml += "\n\t</table></body></rml>";
+	return rml;
+}
+
+// Parses without handling any of the contents, to measure the parser alone.
+class NullXMLParser : public BaseXMLParser {};
+
+TEST_CASE("xml_parser")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	const String rml = GenerateReportRml(2000);
+
+	nanobench::Bench bench;
+	bench.title("XMLParser");
+	bench.timeUnit(std::chrono::milliseconds(1), "ms");
+	bench.relative(true);
+
+	bench.run("Parse report", [&] {
+		StreamMemory stream(reinterpret_cast<const byte*>(rml.data()), rml.size());
+		NullXMLParser parser;
+		parser.Parse(&stream);
+	});
+
+	bench.run("Load report document", [&] {
+		ElementDocument* document = context->LoadDocumentFromMemory(rml);
+		document->Close();
+		context->Update();
+	});
+
+	TestsShell::ShutdownShell();
+}
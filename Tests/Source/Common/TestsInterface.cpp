@@ -64,6 +64,17 @@ bool TestsSystemInterface::LogMessage(Rml::Log::Type type, const Rml::String& me
 	return result;
 }
 
+int TestsSystemInterface::TranslateString(Rml::String& translated, const Rml::String& input)
+{
+	num_translations += 1;
+	return Rml::SystemInterface::TranslateString(translated, input);
+}
+
+int TestsSystemInterface::ResetNumTranslations()
+{
+	return num_translations.exchange(0);
+}
+
 void TestsSystemInterface::SetNumExpectedWarnings(int in_num_expected_warnings)
 {
 	if (num_expected_warnings > 0)
@@ -135,15 +146,26 @@ Rml::TextureHandle TestsRenderInterface::LoadTexture(Rml::Vector2i& texture_dime
 	return 1;
 }
 
-Rml::TextureHandle TestsRenderInterface::GenerateTexture(Rml::Span<const Rml::byte> /*source*/, Rml::Vector2i /*source_dimensions*/)
+Rml::TextureHandle TestsRenderInterface::GenerateTexture(Rml::Span<const Rml::byte> /*source*/, Rml::Vector2i source_dimensions)
 {
 	counters.generate_texture += 1;
-	return 1;
+	const Rml::TextureHandle handle = next_texture_handle++;
+	generated_texture_pixels[handle] = size_t(source_dimensions.x * source_dimensions.y);
+	return handle;
 }
 
-void TestsRenderInterface::ReleaseTexture(Rml::TextureHandle /*texture_handle*/)
+void TestsRenderInterface::ReleaseTexture(Rml::TextureHandle texture_handle)
 {
 	counters.release_texture += 1;
+	generated_texture_pixels.erase(texture_handle);
+}
+
+size_t TestsRenderInterface::GetNumGeneratedTexturePixels() const
+{
+	size_t result = 0;
+	for (const auto& pair : generated_texture_pixels)
+		result += pair.second;
+	return result;
 }
 
 void TestsRenderInterface::SetTransform(const Rml::Matrix4f* /*transform*/)
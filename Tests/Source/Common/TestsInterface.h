@@ -32,6 +32,7 @@
 #include <RmlUi/Core/RenderInterface.h>
 #include <RmlUi/Core/SystemInterface.h>
 #include <Shell.h>
+#include <atomic>
 
 class TestsSystemInterface : public Rml::SystemInterface {
 public:
@@ -41,15 +42,23 @@ public:
 
 	bool LogMessage(Rml::Log::Type type, const Rml::String& message) override;
 
+	int TranslateString(Rml::String& translated, const Rml::String& input) override;
+
 	// Checks and clears previously logged messages, then sets the number of expected
 	// warnings and errors until the next call.
 	void SetNumExpectedWarnings(int num_expected_warnings);
 
 	void SetTime(double t);
 
+	// Returns the number of translated strings since the last call.
+	int ResetNumTranslations();
+
 private:
 	double elapsed_time = 0.0;
 
+	// Strings may be translated by contexts updated on different threads.
+	std::atomic<int> num_translations{0};
+
 	int num_logged_warnings = 0;
 	int num_expected_warnings = 0;
 
@@ -104,10 +113,21 @@ public:
 	const Counters& GetCounters() const { return counters; }
 	void ResetCounters() { counters = {}; }
 
-	void Reset() { ResetCounters(); }
+	// Returns the total number of pixels of all the generated textures which have not yet been released.
+	size_t GetNumGeneratedTexturePixels() const;
+
+	void Reset()
+	{
+		ResetCounters();
+		generated_texture_pixels.clear();
+	}
 
 private:
 	Counters counters = {};
+
+	// Generated textures are given unique handles, so that their sizes can be tracked.
+	Rml::UnorderedMap<Rml::TextureHandle, size_t> generated_texture_pixels;
+	Rml::TextureHandle next_texture_handle = 2;
 };
 
 #endif
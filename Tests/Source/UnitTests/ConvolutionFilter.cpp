@@ -0,0 +1,181 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <RmlUi/Core/ConvolutionFilter.h>
+#include <RmlUi/Core/Math.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+// Straightforward convolution used as the reference for the optimized filter.
+static void RunReference(const Vector<float>& kernel, Vector2i kernel_size, FilterOperation operation, byte* destination,
+	Vector2i destination_dimensions, int destination_stride, int destination_bytes_per_pixel, const byte* source, Vector2i source_dimensions,
+	Vector2i source_offset)
+{
+	const Vector2i kernel_radius = (kernel_size - Vector2i(1)) / 2;
+
+	for (int y = 0; y < destination_dimensions.y; ++y)
+	{
+		for (int x = 0; x < destination_dimensions.x; ++x)
+		{
+			float opacity = 0.f;
+
+			for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+			{
+				const int source_y = y - source_offset.y - kernel_radius.y + kernel_y;
+
+				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+				{
+					const int source_x = x - source_offset.x - kernel_radius.x + kernel_x;
+					if (source_y >= 0 && source_y < source_dimensions.y && source_x >= 0 && source_x < source_dimensions.x)
+					{
+						const float weight = kernel[kernel_y * kernel_size.x + kernel_x];
+						const float pixel_opacity = float(source[source_y * source_dimensions.x + source_x]) * weight;
+
+						switch (operation)
+						{
+						case FilterOperation::Sum: opacity += pixel_opacity; break;
+						case FilterOperation::Dilation: opacity = Math::Max(opacity, pixel_opacity); break;
+						}
+					}
+				}
+			}
+
+			opacity = Math::Min(255.f, opacity);
+			destination[y * destination_stride + x * destination_bytes_per_pixel + destination_bytes_per_pixel - 1] = byte(opacity);
+		}
+	}
+}
+
+static Vector<byte> GenerateSource(Vector2i dimensions)
+{
+	// Simple deterministic pattern with both solid and partially covered pixels, resembling a rasterized glyph.
+	Vector<byte> source(dimensions.x * dimensions.y);
+	unsigned int state = 12345u;
+	for (int y = 0; y < dimensions.y; y++)
+	{
+		for (int x = 0; x < dimensions.x; x++)
+		{
+			state = state * 1103515245u + 12345u;
+			const bool inside = ((x / 5 + y / 7) % 3 != 0);
+			source[y * dimensions.x + x] = (inside ? 255 : byte((state >> 16) % 3 == 0 ? (state >> 8) & 0xff : 0));
+		}
+	}
+	return source;
+}
+
+static void TestFilter(const Vector<float>& kernel, Vector2i kernel_radius, FilterOperation operation, ColorFormat destination_color_format)
+{
+	const Vector2i kernel_size = kernel_radius * 2 + Vector2i(1);
+	REQUIRE(int(kernel.size()) == kernel_size.x * kernel_size.y);
+
+	ConvolutionFilter filter;
+	REQUIRE(filter.Initialise(kernel_radius, operation));
+	for (int y = 0; y < kernel_size.y; y++)
+		for (int x = 0; x < kernel_size.x; x++)
+			filter[y][x] = kernel[y * kernel_size.x + x];
+
+	const Vector2i source_dimensions(23, 31);
+	const Vector<byte> source = GenerateSource(source_dimensions);
+
+	const int bytes_per_pixel = (destination_color_format == ColorFormat::RGBA8 ? 4 : 1);
+	const Vector2i destination_dimensions = source_dimensions + kernel_radius * 2;
+	const int destination_stride = destination_dimensions.x * bytes_per_pixel + 3;
+
+	Vector<byte> result(destination_stride * destination_dimensions.y);
+	Vector<byte> expected(destination_stride * destination_dimensions.y);
+
+	filter.Run(result.data(), destination_dimensions, destination_stride, destination_color_format, source.data(), source_dimensions, kernel_radius,
+		ColorFormat::A8);
+	RunReference(kernel, kernel_size, operation, expected.data(), destination_dimensions, destination_stride, bytes_per_pixel, source.data(),
+		source_dimensions, kernel_radius);
+
+	CHECK(result == expected);
+}
+
+static Vector<float> RoundKernel(int radius)
+{
+	const int size = 2 * radius + 1;
+	Vector<float> kernel(size * size);
+	for (int y = -radius; y <= radius; y++)
+	{
+		for (int x = -radius; x <= radius; x++)
+		{
+			const float distance = Math::SquareRoot(float(x * x + y * y));
+			kernel[(y + radius) * size + x + radius] = (distance > radius ? Math::Max(float(radius + 1) - distance, 0.f) : 1.f);
+		}
+	}
+	return kernel;
+}
+
+static Vector<float> GaussianKernel(int radius)
+{
+	Vector<float> kernel(2 * radius + 1);
+	float sum = 0.f;
+	for (int x = -radius; x <= radius; x++)
+	{
+		kernel[x + radius] = Math::Exp(-float(x * x) / float(radius * radius + 1));
+		sum += kernel[x + radius];
+	}
+	for (float& weight : kernel)
+		weight /= sum;
+	return kernel;
+}
+
+TEST_CASE("ConvolutionFilter.Dilation")
+{
+	for (int radius : {0, 1, 2, 5, 12})
+	{
+		CAPTURE(radius);
+		TestFilter(RoundKernel(radius), Vector2i(radius), FilterOperation::Dilation, ColorFormat::A8);
+		TestFilter(RoundKernel(radius), Vector2i(radius), FilterOperation::Dilation, ColorFormat::RGBA8);
+	}
+
+	// Rectangular kernel with both unit and non-unit weights in the same row.
+	Vector<float> kernel(7 * 3, 1.f);
+	kernel[3] = 0.5f;
+	kernel[7 + 6] = 0.25f;
+	kernel[14] = 0.f;
+	TestFilter(kernel, Vector2i(3, 1), FilterOperation::Dilation, ColorFormat::A8);
+}
+
+TEST_CASE("ConvolutionFilter.Sum")
+{
+	for (int radius : {0, 1, 4, 12})
+	{
+		CAPTURE(radius);
+		const Vector<float> kernel = GaussianKernel(radius);
+		TestFilter(kernel, Vector2i(radius, 0), FilterOperation::Sum, ColorFormat::A8);
+		TestFilter(kernel, Vector2i(0, radius), FilterOperation::Sum, ColorFormat::RGBA8);
+	}
+
+	// Saturating two-dimensional kernel.
+	const Vector<float> kernel = {0.5f, 1.f, 0.5f, 1.f, 2.f, 1.f, 0.f, 1.f, 0.5f};
+	TestFilter(kernel, Vector2i(1), FilterOperation::Sum, ColorFormat::A8);
+}
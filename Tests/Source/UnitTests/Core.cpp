@@ -32,6 +32,8 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/FontGlyph.h>
 #include <algorithm>
 #include <doctest.h>
 
@@ -124,6 +126,289 @@ TEST_CASE("core.texture_source_list")
 	TestsShell::ShutdownShell();
 }
 
+TEST_CASE("core.font_glyph_atlas")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Start from a clean slate, so that only the textures of this document are counted.
+	Rml::ReleaseFontResources();
+	render_interface->Reset();
+	const auto& counters = render_interface->GetCounters();
+
+	// Pages are sized by demand, text in a single small font size only needs a small page.
+	ElementDocument* small_document = context->LoadDocumentFromMemory(
+		"<rml><head><link type='text/rcss' href='/assets/rml.rcss'/></head><body style='font-family: LatoLatin; font-size: 14px'>"
+		"The quick brown fox jumps over the lazy dog.</body></rml>");
+	REQUIRE(small_document);
+	small_document->Show();
+	TestsShell::RenderLoop();
+	CHECK(counters.generate_texture - counters.release_texture == 1);
+	CHECK(render_interface->GetNumGeneratedTexturePixels() <= 256 * 256);
+
+	small_document->Close();
+	TestsShell::RenderLoop();
+	Rml::ReleaseFontResources();
+
+	// Text in many different sizes and styles, each of them using a separate font face handle.
+	String rml = "<rml><head><link type='text/rcss' href='/assets/rml.rcss'/></head><body style='font-family: LatoLatin;'>";
+	for (int size = 10; size < 34; size += 2)
+	{
+		rml += CreateString(128, "<p style='font-size: %dpx'>The quick brown fox</p>", size);
+		rml += CreateString(128, "<p style='font-size: %dpx; font-weight: bold'>jumps over</p>", size);
+		rml += CreateString(128, "<p style='font-size: %dpx; font-style: italic; font-effect: outline(2px black)'>the lazy dog.</p>", size);
+	}
+	rml += "</body></rml>";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	// The glyphs of all the handles and their layers are packed into a few shared atlas pages, rather than one or more textures per handle.
+	const size_t num_textures = counters.generate_texture - counters.release_texture;
+	CHECK(num_textures > 0);
+	CHECK(num_textures <= 20);
+	CHECK(render_interface->GetNumGeneratedTexturePixels() <= 2 * 1024 * 1024);
+
+	// Rendering again should not affect the textures.
+	const size_t num_generated_textures = counters.generate_texture;
+	TestsShell::RenderLoop();
+	CHECK(counters.generate_texture == num_generated_textures);
+
+	// New glyphs are added to the existing pages, which are then uploaded again. The regions of the existing glyphs are unchanged, thus text
+	// already generated with the same handle does not need to be regenerated.
+	FontEngineInterface* font_interface = Rml::GetFontEngineInterface();
+	const FontFaceHandle handle = document->GetFirstChild()->GetFontFaceHandle();
+	const int handle_version = font_interface->GetVersion(handle);
+
+	Element* new_glyphs_element = document->AppendChild(document->CreateElement("p"));
+	new_glyphs_element->SetProperty("font-size", "10px");
+	new_glyphs_element->SetInnerRML("&#xC6;&#xD8;&#xC5;");
+	TestsShell::RenderLoop();
+	CHECK(new_glyphs_element->GetFontFaceHandle() == handle);
+	CHECK(counters.generate_texture > num_generated_textures);
+	CHECK(font_interface->GetVersion(handle) == handle_version);
+
+	// Large glyphs quickly fill up the atlas, beyond its page budget. Pages are then cleared and reused, but all the visible text must settle
+	// on a stable set of pages, instead of continuously evicting each other.
+	for (int size = 100; size <= 300; size += 25)
+	{
+		Element* element = document->AppendChild(document->CreateElement("p"));
+		element->SetProperty("font-size", CreateString(32, "%dpx", size));
+		element->SetInnerRML("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+		TestsShell::RenderLoop();
+		TestsShell::RenderLoop();
+
+		const size_t num_settled_textures = counters.generate_texture;
+		TestsShell::RenderLoop();
+		CHECK(counters.generate_texture == num_settled_textures);
+	}
+
+	document->Close();
+	TestsShell::RenderLoop();
+
+	// All atlas pages are freed together with the font face handles.
+	Rml::ReleaseFontResources();
+	CHECK(counters.generate_texture == counters.release_texture);
+
+	TestsShell::ShutdownShell();
+	render_interface->Reset();
+}
+
+TEST_CASE("core.font_glyph_edge_distance")
+{
+	// Distance values increasing from left to right, with the edge between the fourth and fifth field pixels.
+	FontGlyphDistanceField distance_field;
+	distance_field.dimensions = {8, 1};
+	distance_field.origin = {0, 0};
+	distance_field.spread = 4.f;
+	distance_field.data.reset(new byte[8]{0, 32, 64, 96, 128, 160, 192, 224});
+
+	FontGlyph glyph;
+	CHECK(glyph.GetMaxEdgeDistance() == 0.f);
+
+	glyph.distance_field = &distance_field;
+	glyph.distance_field_scale = 2.f;
+	CHECK(glyph.GetMaxEdgeDistance() == 8.f);
+
+	// Distances are given in bitmap pixels, which are half the size of the field pixels.
+	CHECK(glyph.GetEdgeDistance({9.f, 1.f}) == doctest::Approx(0.f));
+	CHECK(glyph.GetEdgeDistance({10.f, 1.f}) == doctest::Approx(1.f));
+	CHECK(glyph.GetEdgeDistance({11.f, 1.f}) == doctest::Approx(2.f));
+	CHECK(glyph.GetEdgeDistance({5.f, 1.f}) == doctest::Approx(-4.f));
+
+	// Positions outside the field are as far outside the glyph as can be represented.
+	CHECK(glyph.GetEdgeDistance({-10.f, 1.f}) == doctest::Approx(-8.f));
+	CHECK(glyph.GetEdgeDistance({9.f, 10.f}) == doctest::Approx(-8.f));
+
+	// The bearing places the bitmap relative to the glyph origin.
+	glyph.bearing = {2, 0};
+	CHECK(glyph.GetEdgeDistance({7.f, 1.f}) == doctest::Approx(0.f));
+}
+
+TEST_CASE("core.font_distance_fields")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	String rml = "<rml><head><link type='text/rcss' href='/assets/rml.rcss'/></head><body style='font-family: LatoLatin;'>";
+	const int font_sizes[] = {12, 32, 48, 96};
+	for (int size : font_sizes)
+	{
+		rml += CreateString(128, "<p style='display: inline-block; font-size: %dpx'>The quick brown fox</p>", size);
+		rml += CreateString(128, "<p style='display: inline-block; font-size: %dpx; font-effect: outline(3px black)'>jumps over</p>", size);
+	}
+	rml += "</body></rml>";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Vector<float> rasterized_widths;
+	for (int i = 0; i < document->GetNumChildren(); i++)
+		rasterized_widths.push_back(document->GetChild(i)->GetClientWidth());
+
+	// Render sizes from 32px and up from distance fields. Without hinting, the text widths are slightly different.
+	Rml::SetFontDistanceFieldThreshold(32);
+	render_interface->Reset();
+	TestsShell::RenderLoop();
+
+	const auto& counters = render_interface->GetCounters();
+	CHECK(counters.generate_texture > 0);
+
+	for (int i = 0; i < document->GetNumChildren(); i++)
+	{
+		const float width = document->GetChild(i)->GetClientWidth();
+		CHECK(width > 0.f);
+		CHECK(width == doctest::Approx(rasterized_widths[i]).epsilon(0.05));
+	}
+
+	Rml::SetFontDistanceFieldThreshold(0);
+	TestsShell::RenderLoop();
+
+	for (int i = 0; i < document->GetNumChildren(); i++)
+		CHECK(document->GetChild(i)->GetClientWidth() == rasterized_widths[i]);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+	render_interface->Reset();
+}
+
+TEST_CASE("core.font_memory_budget")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	FontEngineInterface* font_interface = Rml::GetFontEngineInterface();
+	REQUIRE(font_interface);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(R"(<rml><head><link type='text/rcss' href='/assets/rml.rcss'/></head>
+		<body style='font-family: LatoLatin;'><p id='text' style='font-effect: outline(2px black)'>The quick brown fox jumps over the lazy dog</p>
+		</body></rml>)");
+	REQUIRE(document);
+	document->Show();
+	Element* element = document->GetElementById("text");
+
+	const auto SetFontSizeAndMeasure = [&](int size) {
+		element->SetProperty("font-size", CreateString(32, "%dpx", size));
+		TestsShell::RenderLoop();
+		return element->GetClientWidth();
+	};
+
+	// Find the memory used by a handle of the largest font size, and allow the resources of only a few of them to be loaded.
+	const float initial_width = SetFontSizeAndMeasure(14);
+	const size_t small_memory_usage = font_interface->GetStatistics().memory_usage;
+	SetFontSizeAndMeasure(40);
+
+	const FontEngineStatistics initial_statistics = font_interface->GetStatistics();
+	CHECK(initial_statistics.num_loaded_handles > 0);
+	CHECK(initial_statistics.memory_usage > small_memory_usage);
+	CHECK(initial_statistics.memory_budget == 0);
+
+	const size_t handle_memory_usage = initial_statistics.memory_usage - small_memory_usage;
+	const size_t memory_budget = initial_statistics.memory_usage + 2 * handle_memory_usage;
+	font_interface->SetMemoryBudget(memory_budget);
+
+	for (int size = 15; size <= 40; size++)
+		SetFontSizeAndMeasure(size);
+
+	// Resources used during the last couple of renders are kept, give the engine a few renders to enforce the budget on them.
+	for (int i = 0; i < 4; i++)
+		TestsShell::RenderLoop();
+
+	const FontEngineStatistics statistics = font_interface->GetStatistics();
+	CHECK(statistics.memory_budget == memory_budget);
+	CHECK(statistics.handle_evictions > initial_statistics.handle_evictions);
+	CHECK(statistics.num_handles > statistics.num_loaded_handles);
+	CHECK(statistics.handle_hits > initial_statistics.handle_hits);
+	CHECK(statistics.memory_usage <= memory_budget);
+
+	// Evicted handles remain valid and reload their resources when used again.
+	CHECK(SetFontSizeAndMeasure(14) == initial_width);
+	CHECK(font_interface->GetStatistics().handle_misses > statistics.handle_misses);
+
+	font_interface->SetMemoryBudget(0);
+	CHECK(font_interface->GetStatistics().memory_budget == 0);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.font_memory_budget.distance_fields")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	FontEngineInterface* font_interface = Rml::GetFontEngineInterface();
+	REQUIRE(font_interface);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(R"(<rml><head><link type='text/rcss' href='/assets/rml.rcss'/></head>
+		<body style='font-family: LatoLatin;'><p id='text'>The quick brown fox jumps over the lazy dog</p></body></rml>)");
+	REQUIRE(document);
+	document->Show();
+	Element* element = document->GetElementById("text");
+
+	const auto SetFontSize = [&](int size) {
+		element->SetProperty("font-size", CreateString(32, "%dpx", size));
+		TestsShell::RenderLoop();
+	};
+
+	// Render the large size from distance fields, which are shared by the handles of the face and counted once.
+	Rml::SetFontDistanceFieldThreshold(32);
+	SetFontSize(14);
+	const size_t rasterized_memory_usage = font_interface->GetStatistics().memory_usage;
+	SetFontSize(48);
+	CHECK(font_interface->GetStatistics().memory_usage > rasterized_memory_usage);
+
+	// Releasing the last handle rendering from the distance fields also releases the distance fields.
+	font_interface->SetMemoryBudget(1);
+	SetFontSize(14);
+	for (int i = 0; i < 4; i++)
+		TestsShell::RenderLoop();
+
+	const FontEngineStatistics statistics = font_interface->GetStatistics();
+	CHECK(statistics.num_loaded_handles == 1);
+	CHECK(statistics.memory_usage <= rasterized_memory_usage);
+
+	font_interface->SetMemoryBudget(0);
+	Rml::SetFontDistanceFieldThreshold(0);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
 TEST_CASE("core.release_resources")
 {
 	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
@@ -26,6 +26,7 @@
  *
  */
 
+#include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/DataModelHandle.h>
@@ -610,3 +611,253 @@ TEST_CASE("databinding.set_enum")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+static const String text_numbers_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<link type="text/rcss" href="/assets/invader.rcss"/>
+</head>
+<body data-model="text_numbers">
+<p id="numbers">{{ i }} {{ u }} {{ f }} {{ d }}</p>
+<p id="label">Score: {{ i }}</p>
+<p id="mixed">{{ d }} {{ s }}</p>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.text_numbers")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	int i = -12;
+	unsigned int u = 4000000000u;
+	float f = 3.14159f;
+	double d = 5.0;
+	String s = "text";
+
+	DataModelConstructor constructor = context->CreateDataModel("text_numbers");
+	REQUIRE(constructor);
+	constructor.Bind("i", &i);
+	constructor.Bind("u", &u);
+	constructor.Bind("f", &f);
+	constructor.Bind("d", &d);
+	constructor.Bind("s", &s);
+	constructor.SetTranslateNumericText(false);
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(text_numbers_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsSystemInterface* system_interface = TestsShell::GetTestsSystemInterface();
+	TestsShell::RenderLoop();
+	system_interface->ResetNumTranslations();
+
+	Element* numbers = document->GetElementById("numbers");
+	Element* label = document->GetElementById("label");
+	Element* mixed = document->GetElementById("mixed");
+
+	CHECK(numbers->GetInnerRML() == "-12 4000000000 3.142 5");
+	CHECK(label->GetInnerRML() == "Score: -12");
+	CHECK(mixed->GetInnerRML() == "5 text");
+
+	// Numbers should be formatted the same as when converted through variants.
+	const double test_values[] = {-0.0, 0.0005, -1.0005, 1e15, -1e20, 123456.789, 0.1 + 0.2};
+	for (double value : test_values)
+	{
+		d = value;
+		handle.DirtyVariable("d");
+		TestsShell::RenderLoop();
+		CHECK(numbers->GetInnerRML() == "-12 4000000000 3.142 " + Variant(value).Get<String>());
+	}
+
+	// Only text consisting purely of numbers skips translation.
+	system_interface->ResetNumTranslations();
+	i = 7;
+	handle.DirtyVariable("i");
+	TestsShell::RenderLoop();
+	CHECK(numbers->GetInnerRML() == "7 4000000000 3.142 0.3");
+	CHECK(label->GetInnerRML() == "Score: 7");
+	CHECK(system_interface->ResetNumTranslations() == 1);
+
+	d = 2.5;
+	handle.DirtyVariable("d");
+	TestsShell::RenderLoop();
+	CHECK(mixed->GetInnerRML() == "2.5 text");
+	CHECK(system_interface->ResetNumTranslations() == 1);
+
+	// Unchanged values should not cause any updates.
+	handle.DirtyAllVariables();
+	TestsShell::RenderLoop();
+	CHECK(system_interface->ResetNumTranslations() == 0);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String view_budget_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<link type="text/rcss" href="/assets/invader.rcss"/>
+</head>
+<body>
+<div data-model="view_budget">
+<p id="a">{{ a }}</p>
+<p id="b">{{ b }}</p>
+<p id="c">{{ c }}</p>
+<div id="list"><span data-for="list">{{ it }}</span></div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.view_budget")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	int a = 1, b = 2, c = 3;
+	Vector<int> list = {1, 2};
+
+	DataModelConstructor constructor = context->CreateDataModel("view_budget");
+	REQUIRE(constructor);
+	constructor.RegisterArray<Vector<int>>();
+	constructor.Bind("a", &a);
+	constructor.Bind("b", &b);
+	constructor.Bind("c", &c);
+	constructor.Bind("list", &list);
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(view_budget_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* element_a = document->GetElementById("a");
+	Element* element_b = document->GetElementById("b");
+	Element* element_c = document->GetElementById("c");
+	Element* element_list = document->GetElementById("list");
+	// The 'data-for' element itself is kept as a hidden child.
+	CHECK(element_list->GetNumChildren() == 3);
+
+	// Clean models should not update any views.
+	context->Update();
+	CHECK(handle.GetNumViewsUpdated() == 0);
+
+	// Views dirtied multiple times are only updated once.
+	a = 10;
+	handle.DirtyVariable("a");
+	handle.DirtyVariable("a");
+	context->Update();
+	CHECK(handle.GetNumViewsUpdated() == 1);
+	CHECK(element_a->GetInnerRML() == "10");
+
+	// Views added during the update, here by the 'data-for' view, are updated in the same update.
+	list = {4, 5, 6};
+	handle.DirtyVariable("list");
+	context->Update();
+	CHECK(handle.GetNumViewsUpdated() == 4);
+	REQUIRE(element_list->GetNumChildren() == 4);
+	CHECK(element_list->GetChild(2)->GetInnerRML() == "6");
+
+	// Views exceeding the limit are carried over to the following updates.
+	handle.SetMaxViewsPerUpdate(2);
+	a = 11;
+	b = 12;
+	c = 13;
+	handle.DirtyAllVariables();
+	const int expected_num_views_updated[] = {2, 2, 2, 1, 0};
+	for (int expected : expected_num_views_updated)
+	{
+		context->Update();
+		CHECK(handle.GetNumViewsUpdated() == expected);
+		if (expected > 1)
+			CHECK(context->GetNextUpdateDelay() == 0.0);
+	}
+
+	CHECK(element_a->GetInnerRML() == "11");
+	CHECK(element_b->GetInnerRML() == "12");
+	CHECK(element_c->GetInnerRML() == "13");
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String style_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<link type="text/rcss" href="/assets/invader.rcss"/>
+</head>
+<body data-model="style">
+<div id="bar" data-style-width="progress + '%'" data-style-opacity="opacity" data-style-z-index="layer" data-style-height="height"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.style")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	float progress = 10.f;
+	float opacity = 0.5f;
+	int layer = 3;
+	int height = 0;
+
+	DataModelConstructor constructor = context->CreateDataModel("style");
+	REQUIRE(constructor);
+	constructor.Bind("progress", &progress);
+	constructor.Bind("opacity", &opacity);
+	constructor.Bind("layer", &layer);
+	constructor.Bind("height", &height);
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(style_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* bar = document->GetElementById("bar");
+	REQUIRE(bar);
+
+	auto CheckLocalProperty = [bar](PropertyId id, const Property& expected) {
+		const Property* property = bar->GetLocalProperty(id);
+		REQUIRE(property);
+		CHECK(*property == expected);
+	};
+
+	CheckLocalProperty(PropertyId::Width, Property(10.f, Unit::PERCENT));
+	CheckLocalProperty(PropertyId::Opacity, Property(0.5f, Unit::NUMBER));
+	CheckLocalProperty(PropertyId::ZIndex, Property(3.f, Unit::NUMBER));
+	// Plain numbers are only accepted as lengths when zero.
+	CheckLocalProperty(PropertyId::Height, Property(0.f, Unit::PX));
+
+	for (int i = 1; i <= 20; i++)
+	{
+		progress = 10.f + 4.5f * float(i);
+		opacity = 1.f / float(i);
+		layer = i;
+		handle.DirtyAllVariables();
+		TestsShell::RenderLoop();
+
+		CheckLocalProperty(PropertyId::Width, Property(progress, Unit::PERCENT));
+		CheckLocalProperty(PropertyId::Opacity, Property(opacity, Unit::NUMBER));
+		CheckLocalProperty(PropertyId::ZIndex, Property(float(i), Unit::NUMBER));
+	}
+
+	height = 10;
+	handle.DirtyVariable("height");
+	TestsShell::SetNumExpectedWarnings(1);
+	TestsShell::RenderLoop();
+	CheckLocalProperty(PropertyId::Height, Property(0.f, Unit::PX));
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
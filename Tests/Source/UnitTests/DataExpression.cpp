@@ -37,6 +37,27 @@ static DataTypeRegister type_register;
 static DataModel model(&type_register);
 static DataExpressionInterface interface(&model, nullptr);
 
+static bool RunCompiled(const String& expression, const Program& program, const AddressList& addresses, Variant& out_value)
+{
+	DataCompiler compiler(program, addresses, interface);
+	UniquePtr<CompiledProgram> compiled_program = compiler.Compile();
+	if (!compiled_program)
+	{
+		FAIL_CHECK("Could not compile expression: " << expression << "\n\n  Parsed program: \n" << DumpProgram(program));
+		return false;
+	}
+
+	DataTypedInterpreter interpreter(*compiled_program, addresses, interface);
+	if (!interpreter.Run())
+	{
+		FAIL_CHECK("Could not execute compiled expression: " << expression << "\n\n  Parsed program: \n" << DumpProgram(program));
+		return false;
+	}
+
+	interpreter.GetResult(out_value);
+	return true;
+}
+
 static String TestExpression(const String& expression)
 {
 	String result;
@@ -51,7 +72,17 @@ static String TestExpression(const String& expression)
 		DataInterpreter interpreter(program, addresses, interface);
 
 		if (interpreter.Run())
+		{
 			result = interpreter.Result().Get<String>();
+
+			// The compiled program should produce the same result, including its type.
+			Variant compiled_result;
+			if (RunCompiled(expression, program, addresses, compiled_result))
+			{
+				CHECK_MESSAGE(compiled_result.Get<String>() == result, "Compiled expression: " << expression);
+				CHECK_MESSAGE(compiled_result.GetType() == interpreter.Result().GetType(), "Compiled expression: " << expression);
+			}
+		}
 		else
 			FAIL_CHECK("Could not execute expression: " << expression << "\n\n  Parsed program: \n" << DumpProgram(program));
 	}
@@ -73,8 +104,10 @@ static bool TestAssignment(const String& expression)
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
 
+		// Assignments in the tests are idempotent, thus we can run both the interpreted and compiled program.
 		DataInterpreter interpreter(program, addresses, interface);
-		if (interpreter.Run())
+		Variant compiled_result;
+		if (interpreter.Run() && RunCompiled(expression, program, addresses, compiled_result))
 			result = true;
 		else
 			FAIL_CHECK("Could not execute assignment expression: " << expression << "\n\n  Parsed program: \n" << DumpProgram(program));
@@ -87,6 +120,19 @@ static bool TestAssignment(const String& expression)
 	return result;
 }
 
+static size_t CompiledInstructionCount(const String& expression)
+{
+	DataParser parser(expression, interface);
+	if (!parser.Parse(false))
+		return size_t(-1);
+
+	Program program = parser.ReleaseProgram();
+	AddressList addresses = parser.ReleaseAddresses();
+	DataCompiler compiler(program, addresses, interface);
+	UniquePtr<CompiledProgram> compiled_program = compiler.Compile();
+	return compiled_program ? compiled_program->instructions.size() : size_t(-1);
+}
+
 TEST_CASE("Data expressions")
 {
 	float radius = 8.7f;
@@ -193,3 +239,36 @@ TEST_CASE("Data expressions")
 	CHECK(TestExpression("concatenate('It takes', num_trolls*3 + ' goats', 'to outsmart', num_trolls | number_suffix('troll','trolls'))") ==
 		"It takes,9 goats,to outsmart,3 trolls");
 }
+
+TEST_CASE("Data expressions.compiled")
+{
+	float radius = 8.7f;
+	String color_name = "color";
+
+	DataModelConstructor constructor(&model);
+	constructor.Bind("compiled_radius", &radius);
+	constructor.Bind("compiled_color_name", &color_name);
+
+	// Constant subexpressions are folded.
+	CHECK(CompiledInstructionCount("2 * 2") == 0);
+	CHECK(CompiledInstructionCount("5 == 1 + 2*2 || 8 == 1 + 4  ? 'yes' : 'no'") == 0);
+	CHECK(CompiledInstructionCount("true ? compiled_radius : 'no'") == 1);
+
+	// Typed operations on variables only convert at the boundary.
+	CHECK(CompiledInstructionCount("compiled_radius * 2 + 1") == 4);
+	CHECK(TestExpression("compiled_radius * 2 + 1") == "18.4");
+	CHECK(TestExpression("compiled_radius") == "8.7");
+	CHECK(TestExpression("compiled_radius + compiled_color_name") == "8.7color");
+	CHECK(TestExpression("compiled_radius + 1 + compiled_color_name") == "9.7color");
+	CHECK(TestExpression("compiled_color_name == 'color' ? compiled_radius : 0") == "8.7");
+	CHECK(TestExpression("compiled_color_name != compiled_radius") == "1");
+	CHECK(TestExpression("!compiled_radius") == "0");
+	CHECK(TestExpression("'' + compiled_radius > 8 && compiled_radius < 9") == "1");
+
+	CHECK(TestExpression("compiled_radius | format(1)") == "8.7");
+	CHECK(TestAssignment("compiled_color_name = 'x' + compiled_radius * 2"));
+	CHECK(color_name == "x17.4");
+	CHECK(TestAssignment("compiled_radius = 3; compiled_color_name = compiled_radius < 5 ? 'small' : 'large'"));
+	CHECK(radius == doctest::Approx(3.f));
+	CHECK(color_name == "small");
+}
@@ -33,6 +33,7 @@
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementUtilities.h>
 #include <RmlUi/Core/Factory.h>
 #include <doctest.h>
 
@@ -421,3 +422,48 @@ TEST_CASE("Element.ScrollIntoView")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("Element.MemoryUsage")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_scroll_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Run(context);
+
+	const ElementMemoryUsage usage = ElementUtilities::GetMemoryUsage(document);
+	CHECK(usage.num_elements > 20);
+	CHECK(usage.element_bytes >= usage.num_elements * sizeof(Element));
+	CHECK(usage.GetTotalBytes() == usage.element_bytes + usage.cold_meta_bytes + usage.container_bytes);
+	CHECK(usage.GetBytesPerElement() == usage.GetTotalBytes() / usage.num_elements);
+
+	// Plain elements without effects or event attributes should not need the rarely used meta data.
+	CHECK(usage.num_elements_with_cold_meta * 4 < usage.num_elements);
+
+	Element* cell = document->GetElementById("cell00");
+	REQUIRE(cell);
+	const ElementMemoryUsage cell_usage = ElementUtilities::GetMemoryUsage(cell);
+	CHECK(cell_usage.num_elements == 1);
+	CHECK(cell_usage.num_elements_with_cold_meta == 0);
+	CHECK(cell_usage.cold_meta_bytes == 0);
+
+	// Setting an effect property allocates the cold meta data.
+	cell->SetProperty("decorator", "horizontal-gradient(#f00 #00f)");
+	Run(context);
+	CHECK(ElementUtilities::GetMemoryUsage(cell).num_elements_with_cold_meta == 1);
+	CHECK(ElementUtilities::GetMemoryUsage(document).num_elements_with_cold_meta == usage.num_elements_with_cold_meta + 1);
+
+	Element* other_cell = document->GetElementById("cell01");
+	REQUIRE(other_cell);
+	CHECK(ElementUtilities::GetMemoryUsage(other_cell).num_elements_with_cold_meta == 0);
+	other_cell->SetAttribute("onclick", "noop");
+	CHECK(ElementUtilities::GetMemoryUsage(other_cell).num_elements_with_cold_meta == 1);
+
+	CHECK(ElementUtilities::GetMemoryUsage(nullptr).num_elements == 0);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -29,9 +29,11 @@
 #include "../Common/Mocks.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
 #include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/PreparedDocument.h>
 #include <algorithm>
 #include <doctest.h>
 
@@ -286,4 +288,60 @@ TEST_CASE("ReloadStyleSheet")
 	TestsShell::ShutdownShell();
 }
 
+TEST_CASE("LoadPrepared")
+{
+	Context* context = TestsShell::GetContext();
+	const String document_path = "basic/demo/data/demo.rml";
+
+	UniquePtr<PreparedDocument> prepared_document = Rml::PrepareDocument(document_path);
+	REQUIRE(prepared_document);
+	CHECK(prepared_document->GetStyleSheetContainer().get() != nullptr);
+	CHECK(!prepared_document->GetNodes().empty());
+
+	ElementDocument* loaded_document = context->LoadDocument(document_path);
+	REQUIRE(loaded_document);
+
+	// The prepared document can be loaded several times, and should give the same result as loading it directly.
+	for (int i = 0; i < 2; i++)
+	{
+		ElementDocument* document = context->LoadDocument(*prepared_document);
+		REQUIRE(document);
+
+		CHECK(document->GetSourceURL() == loaded_document->GetSourceURL());
+		CHECK(document->GetTitle() == loaded_document->GetTitle());
+		CHECK(document->GetInnerRML() == loaded_document->GetInnerRML());
+
+		document->Show();
+		loaded_document->Show();
+		context->Update();
+
+		Element* element = document->GetElementById("menu");
+		Element* loaded_element = loaded_document->GetElementById("menu");
+		REQUIRE(element);
+		REQUIRE(loaded_element);
+		CHECK(element->GetBox().GetSize() == loaded_element->GetBox().GetSize());
+		CHECK(element->GetProperty<String>("font-family") == loaded_element->GetProperty<String>("font-family"));
+
+		document->Close();
+	}
+
+	loaded_document->Close();
+	prepared_document.reset();
+
+	// Documents without a header have no style sheets to prepare.
+	prepared_document = Rml::PrepareDocumentFromMemory("<rml><body><div/></body></rml>");
+	REQUIRE(prepared_document);
+	CHECK(prepared_document->GetSourceURL() == "[document from memory]");
+	CHECK(prepared_document->GetStyleSheetContainer().get() == nullptr);
+	CHECK(prepared_document->GetNodes().size() == 6);
+
+	ElementDocument* document = context->LoadDocument(*prepared_document);
+	REQUIRE(document);
+	CHECK(document->GetNumChildren() == 1);
+	document->Close();
+
+	prepared_document.reset();
+	TestsShell::ShutdownShell();
+}
+
 TEST_SUITE_END();
@@ -0,0 +1,214 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Elements/ElementFormControlTextArea.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String textarea_doc_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 16px;
+			width: 800px;
+			height: 600px;
+		}
+		textarea {
+			display: block;
+			width: 200px;
+			height: 100px;
+		}
+		scrollbarvertical {
+			width: 12px;
+		}
+	</style>
+</head>
+<body>
+<textarea id="edited"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("form.textarea.reflow")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(textarea_doc_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto edited = rmlui_dynamic_cast<ElementFormControlTextArea*>(document->GetElementById("edited"));
+	REQUIRE(edited);
+
+	String value;
+	for (int i = 0; i < 40; i++)
+		value += CreateString(128, "Paragraph %d with a number of words that wrap around in the narrow text area.\n", i);
+
+	edited->SetValue(value);
+	context->Update();
+	context->Render();
+
+	// Edits are reflowed incrementally, the result should match a text area which is formatted from scratch with the same value.
+	auto ApplyEdit = [&](size_t offset, size_t erase_size, const String& insert) {
+		value.replace(offset, erase_size, insert);
+		edited->SetValue(value);
+		context->Update();
+		context->Render();
+
+		ElementPtr reference_ptr = document->CreateElement("textarea");
+		auto reference = rmlui_dynamic_cast<ElementFormControlTextArea*>(reference_ptr.get());
+		REQUIRE(reference);
+		reference->SetValue(value);
+		document->AppendChild(std::move(reference_ptr));
+		context->Update();
+		context->Render();
+
+		CHECK(edited->GetValue() == value);
+		CHECK(edited->GetScrollHeight() == reference->GetScrollHeight());
+		CHECK(edited->GetScrollWidth() == reference->GetScrollWidth());
+
+		document->RemoveChild(reference);
+	};
+
+	const size_t middle = value.find("Paragraph 20");
+	REQUIRE(middle != String::npos);
+
+	SUBCASE("InsertWord")
+	{
+		ApplyEdit(middle + 10, 0, "additional ");
+	}
+	SUBCASE("InsertLongText")
+	{
+		ApplyEdit(middle + 20, 0, "a long piece of text which definitely needs to wrap onto several new lines of the text area");
+	}
+	SUBCASE("InsertNewlines")
+	{
+		ApplyEdit(middle + 15, 0, "\n\n");
+	}
+	SUBCASE("JoinParagraphs")
+	{
+		ApplyEdit(middle - 1, 1, " ");
+	}
+	SUBCASE("DeleteAcrossParagraphs")
+	{
+		ApplyEdit(middle - 30, 60, "");
+	}
+	SUBCASE("EditStartAndEnd")
+	{
+		ApplyEdit(0, 5, "");
+		ApplyEdit(value.size(), 0, "Appended text at the very end");
+		ApplyEdit(value.size() - 3, 3, "\n");
+	}
+	SUBCASE("Replace")
+	{
+		const String original_value = value;
+		ApplyEdit(0, value.size(), "Short");
+		ApplyEdit(0, value.size(), original_value);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("form.textarea.reflow_property_change")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(textarea_doc_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto edited = rmlui_dynamic_cast<ElementFormControlTextArea*>(document->GetElementById("edited"));
+	REQUIRE(edited);
+
+	String value;
+	for (int i = 0; i < 10; i++)
+		value += CreateString(128, "Paragraph %d with a number of words that wrap around in the narrow text area.\n", i);
+
+	edited->SetValue(value);
+	context->Update();
+	context->Render();
+
+	// Make an edit which is reflowed incrementally, then change a text property before the next layout. The lines must be laid out from
+	// scratch for the new property value, as compared to a text area which is formatted from scratch with the same property and value.
+	auto ApplyEditAndProperty = [&](const String& property, const String& property_value) {
+		value.insert(value.find("Paragraph 5"), "Edited ");
+		edited->SetValue(value);
+		edited->SetProperty(property, property_value);
+		context->Update();
+		context->Render();
+
+		ElementPtr reference_ptr = document->CreateElement("textarea");
+		auto reference = rmlui_dynamic_cast<ElementFormControlTextArea*>(reference_ptr.get());
+		REQUIRE(reference);
+		reference->SetValue(value);
+		reference->SetProperty(property, property_value);
+		document->AppendChild(std::move(reference_ptr));
+		context->Update();
+		context->Render();
+
+		CHECK(edited->GetScrollHeight() == reference->GetScrollHeight());
+
+		// Moving the cursor to the end of each line depends on the line layout, including trailing spaces removed for right-aligned text.
+		auto GetEndOfLineIndex = [&](ElementFormControlTextArea* element, int index) {
+			element->Focus();
+			element->SetSelectionRange(index, index);
+			context->ProcessKeyDown(Input::KI_END, 0);
+			int selection_start = 0, selection_end = 0;
+			element->GetSelection(&selection_start, &selection_end, nullptr);
+			return selection_end;
+		};
+
+		for (int index = 0; index < (int)value.size(); index += 7)
+			CHECK(GetEndOfLineIndex(edited, index) == GetEndOfLineIndex(reference, index));
+
+		document->RemoveChild(reference);
+	};
+
+	SUBCASE("TextAlign")
+	{
+		ApplyEditAndProperty("text-align", "right");
+	}
+	SUBCASE("LetterSpacing")
+	{
+		ApplyEditAndProperty("letter-spacing", "2px");
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,120 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FrameProfiler.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_profiler_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; font-size: 17px; }
+		p.large { font-size: 41px; }
+	</style>
+</head>
+<body>
+<p>Some text</p>
+<p>More text</p>
+</body>
+</rml>
+)";
+
+TEST_CASE("frame_profiler")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	REQUIRE(!FrameProfiler::IsEnabled());
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_profiler_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+	TestsShell::RenderLoop();
+	CHECK(FrameProfiler::GetFrames().empty());
+
+	FrameProfiler::SetEnabled(true);
+	CHECK(FrameProfiler::IsEnabled());
+
+	// Add an element with a new font size, which requires its glyphs to be rendered.
+	document->AppendChild(document->CreateElement("p"))->SetClass("large", true);
+	document->GetLastChild()->SetInnerRML("Large text");
+
+	// The frame is ended when the context is updated again after rendering.
+	TestsShell::RenderLoop();
+	CHECK(FrameProfiler::GetFrames().empty());
+	TestsShell::RenderLoop();
+
+	Vector<FrameProfile> frames = FrameProfiler::GetFrames();
+	REQUIRE(frames.size() == 1);
+	{
+		const FrameProfile& frame = frames[0];
+		CHECK(frame.GetCounter(FrameCounter::ElementsUpdated) > 0);
+		CHECK(frame.GetCounter(FrameCounter::DefinitionLookups) > 0);
+		CHECK(frame.GetCounter(FrameCounter::Layouts) == 1);
+		CHECK(frame.GetCounter(FrameCounter::DrawCalls) > 0);
+		CHECK(frame.GetCounter(FrameCounter::GlyphsRasterized) > 0);
+		CHECK(frame.GetTimer(FrameTimer::Layout) > 0.0);
+		CHECK(frame.GetTimer(FrameTimer::Render) > 0.0);
+		CHECK(frame.duration >= frame.GetTimer(FrameTimer::Render));
+	}
+
+	// Nothing changed in the next frame, thus only rendering should be recorded.
+	FrameProfiler::EndFrame();
+	frames = FrameProfiler::GetFrames();
+	REQUIRE(frames.size() == 2);
+	CHECK(frames[1].GetCounter(FrameCounter::ElementsUpdated) == 0);
+	CHECK(frames[1].GetCounter(FrameCounter::Layouts) == 0);
+	CHECK(frames[1].GetCounter(FrameCounter::DrawCalls) > 0);
+
+	// Only the most recent frames are kept.
+	for (int i = 0; i < FrameProfiler::max_frames + 10; i++)
+		TestsShell::RenderLoop();
+	frames = FrameProfiler::GetFrames();
+	REQUIRE(frames.size() == size_t(FrameProfiler::max_frames));
+	CHECK(frames.back().GetCounter(FrameCounter::DrawCalls) > 0);
+	CHECK(frames.back().GetCounter(FrameCounter::Layouts) == 0);
+
+	FrameProfiler::ClearFrames();
+	CHECK(FrameProfiler::GetFrames().empty());
+
+	FrameProfiler::SetEnabled(false);
+	TestsShell::RenderLoop();
+	TestsShell::RenderLoop();
+	CHECK(FrameProfiler::GetFrames().empty());
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
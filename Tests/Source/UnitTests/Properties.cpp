@@ -207,3 +207,100 @@ TEST_CASE("Property.ToString")
 
 	Rml::Shutdown();
 }
+
+TEST_CASE("Properties.parsed_value_cache")
+{
+	TestsSystemInterface system_interface;
+	TestsRenderInterface render_interface;
+	SetRenderInterface(&render_interface);
+	SetSystemInterface(&system_interface);
+
+	Rml::Initialise();
+
+	auto ParsedValue = [](const String& name, const String& value) -> Property {
+		PropertyDictionary properties;
+		REQUIRE(StyleSheetSpecification::ParsePropertyDeclaration(properties, name, value));
+		REQUIRE(properties.GetNumProperties() == 1);
+		return properties.GetProperties().begin()->second;
+	};
+	auto CachedValue = [](const String& name, const String& value) -> Property {
+		const PropertyDictionary* properties = StyleSheetSpecification::ParsePropertyDeclarationCached(name, value);
+		REQUIRE(properties);
+		REQUIRE(properties->GetNumProperties() == 1);
+		return properties->GetProperties().begin()->second;
+	};
+
+	SUBCASE("equivalence")
+	{
+		// Repeated values, and numbers with a previously seen unit, take different paths through the cache.
+		const Pair<String, String> declarations[] = {
+			{"width", "10px"},
+			{"width", "10px"},
+			{"width", "12.5px"},
+			{"width", "-3e2PX"},
+			{"width", "50%"},
+			{"width", "75.5%"},
+			{"width", "0"},
+			{"width", "auto"},
+			{"opacity", "0.5"},
+			{"opacity", "1"},
+			{"opacity", ".25"},
+			{"z-index", "auto"},
+			{"z-index", "7"},
+			{"color", "red"},
+			{"font-family", "LatoLatin"},
+		};
+
+		for (const auto& declaration : declarations)
+		{
+			const Property expected = ParsedValue(declaration.first, declaration.second);
+			const Property result = CachedValue(declaration.first, declaration.second);
+			CHECK_MESSAGE(result == expected, declaration.first, ": ", declaration.second);
+			CHECK(result.definition == expected.definition);
+			CHECK(result.parser_index == expected.parser_index);
+			CHECK(result.ToString() == expected.ToString());
+		}
+	}
+
+	SUBCASE("uncached")
+	{
+		// Values referencing other objects are parsed anew each time.
+		for (int i = 0; i < 2; i++)
+			CHECK(CachedValue("transform", "rotate(10deg)").ToString() == "rotate(10deg)");
+	}
+
+	SUBCASE("shorthand")
+	{
+		for (int i = 0; i < 2; i++)
+		{
+			const PropertyDictionary* properties = StyleSheetSpecification::ParsePropertyDeclarationCached("margin", "1px 2px");
+			REQUIRE(properties);
+			CHECK(properties->GetNumProperties() == 4);
+			CHECK(*properties->GetProperty(PropertyId::MarginLeft) == Property(2.f, Unit::PX));
+		}
+	}
+
+	SUBCASE("invalid")
+	{
+		CHECK(StyleSheetSpecification::ParsePropertyDeclarationCached("width", "10") == nullptr);
+		CHECK(StyleSheetSpecification::ParsePropertyDeclarationCached("width", "10furlongs") == nullptr);
+		CHECK(StyleSheetSpecification::ParsePropertyDeclarationCached("not-a-property", "10px") == nullptr);
+	}
+
+	SUBCASE("numeric")
+	{
+		Property property;
+		REQUIRE(StyleSheetSpecification::ParseNumericProperty(property, PropertyId::Opacity, 0.75f, Unit::NUMBER));
+		CHECK(property == ParsedValue("opacity", "0.75"));
+		CHECK(property.definition == StyleSheetSpecification::GetProperty(PropertyId::Opacity));
+
+		REQUIRE(StyleSheetSpecification::ParseNumericProperty(property, PropertyId::Width, 25.f, Unit::PERCENT));
+		CHECK(property == ParsedValue("width", "25%"));
+
+		CHECK_FALSE(StyleSheetSpecification::ParseNumericProperty(property, PropertyId::Width, 25.f, Unit::NUMBER));
+		CHECK_FALSE(StyleSheetSpecification::ParseNumericProperty(property, PropertyId::Width, 0.f, Unit::NUMBER));
+		CHECK_FALSE(StyleSheetSpecification::ParseNumericProperty(property, PropertyId::Opacity, 1.f, Unit::PX));
+	}
+
+	Rml::Shutdown();
+}
@@ -31,6 +31,8 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/StyleSheet.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
 
@@ -134,6 +136,11 @@ static const Vector<QuerySelector> query_selectors =
 	{ "*[class~=hello].world",        "Z H" },
 	{ ".world[class~=hello]",         "Z H" },
 	{ "[class~=hello][class~=world]", "Z H" },
+	{ ".hello.hello",                 "X Z H" },
+	{ "#Z.world.hello",               "Z" },
+	{ "span.world.hello",             "" },
+	{ "[class][class~=hello]",        "X Z H" },
+	{ "p[unit][unit=m]",              "B" },
 
 	{ "[class=hello world]",          "Z" },
 	{ "[class='hello world']",        "Z" },
@@ -175,6 +182,8 @@ static const Vector<QuerySelector> query_selectors =
 	{ ":last-of-type",               "Y P A D1 E F0 H I" },
 	{ ":only-child",                 "F0",              SelectorOp::RemoveElementsByIds,  "D0",    "D1 F0" },
 	{ ":only-of-type",               "Y A E F0 I" },
+	{ "p:nth-of-type(2)",            "C",               SelectorOp::InsertElementBefore,  "B",     "B" },
+	{ "p:last-of-type",              "H",               SelectorOp::RemoveElementsByIds,  "H",     "G" },
 	{ "span:empty",                  "Y D0 F0" },
 	
 	{ ".hello.world, #P span, #I",   "Z D0 D1 F0 H I",  SelectorOp::RemoveClasses,        "world", "D0 D1 F0 I" },
@@ -214,9 +223,15 @@ static const Vector<QuerySelector> query_selectors =
 	{ ":hover + #P #D1",             "",                SelectorOp::SetHover,             "Z", "D1"  },
 	{ ":not(:hover) + #P #D1",       "D1",              SelectorOp::SetHover,             "Z", ""  },
 	{ "#X + #Y",                     "Y",               SelectorOp::RemoveId,             "X", ""  },
+	{ ".parent span",                "D0 D1 F0",        SelectorOp::RemoveClasses,        "parent", ""  },
+	{ ":not(.parent) > p",           "",                SelectorOp::RemoveClasses,        "parent", "B C D F G H"  },
+	{ "p:not(.world)",               "B C D F G",       SelectorOp::RemoveClasses,        "world", "B C D F G H"  },
+	{ ".hello ~ #P > p",             "B C D F G H",     SelectorOp::RemoveClasses,        "hello", ""  },
+	{ "#P:hover span",               "",                SelectorOp::SetHover,             "P", "D0 D1 F0"  },
 
 	{ "p[unit=m]",                   "B",               SelectorOp::RemoveAttributeUnit,  "B", ""  },
 	{ "p[unit=m] + *",               "C",               SelectorOp::RemoveAttributeUnit,  "B", ""  },
+	{ "[unit] ~ p",                  "C D F G H",       SelectorOp::RemoveAttributeUnit,  "B", ""  },
 
 	{ "body > * #D0",                "D0" },
 	{ "#E + * ~ *",                  "G H" },
@@ -458,3 +473,85 @@ TEST_CASE("Selectors")
 
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("Selectors.invalidation")
+{
+	Context* context = TestsShell::GetContext();
+
+	const String document_string = doc_begin + R"(
+		.a { opacity: 0.5; }
+		.b span { drag: drag; }
+		.c + p, :hover ~ p { drag: drag; }
+		div:not(.d) > p, p:not(:checked .e) { drag: drag; }
+		[unit] p { drag: drag; }
+	)" + doc_end;
+	ElementDocument* document = context->LoadDocumentFromMemory(document_string);
+	REQUIRE(document);
+
+	const StyleSheet* style_sheet = document->GetStyleSheet();
+	REQUIRE(style_sheet);
+
+	using Inv = StyleSheetInvalidation;
+	CHECK(style_sheet->GetClassInvalidation("a") == Inv::Self);
+	CHECK(style_sheet->GetClassInvalidation("b") == Inv::Descendants);
+	CHECK(style_sheet->GetClassInvalidation("c") == Inv::Siblings);
+	CHECK(style_sheet->GetPseudoClassInvalidation("hover") == Inv::Siblings);
+
+	// Names in inner selectors also affect the elements affected by the outer selector.
+	CHECK(style_sheet->GetClassInvalidation("d") == (Inv::Self | Inv::Descendants));
+	CHECK(style_sheet->GetClassInvalidation("e") == Inv::Self);
+	CHECK(style_sheet->GetPseudoClassInvalidation("checked") == (Inv::Self | Inv::Descendants));
+
+	CHECK(style_sheet->GetAttributeInvalidation("unit") == Inv::Descendants);
+
+	// Names which are not used in any selectors don't affect any elements.
+	CHECK(style_sheet->GetClassInvalidation("hello") == Inv::None);
+	CHECK(style_sheet->GetPseudoClassInvalidation("focus") == Inv::None);
+	CHECK(style_sheet->GetAttributeInvalidation("type") == Inv::None);
+	CHECK(style_sheet->GetClassInvalidation("never-used-in-any-document") == Inv::None);
+
+	// Toggling names only used in the subject of selectors still updates the style of the element.
+	Element* element = document->GetElementById("B");
+	context->Update();
+	CHECK(element->GetProperty<float>("opacity") == 1.f);
+	element->SetClass("a", true);
+	context->Update();
+	CHECK(element->GetProperty<float>("opacity") == 0.5f);
+
+	context->UnloadDocument(document);
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("Selectors.names_before_style_sheet")
+{
+	Context* context = TestsShell::GetContext();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(doc_begin + doc_end);
+	REQUIRE(document);
+
+	// Ids and classes are not added to the atom table until a selector refers to them, yet elements must still match once such a selector is
+	// loaded.
+	Element* element = document->GetElementById("B");
+	Element* class_element = document->GetElementById("Y");
+	REQUIRE(element);
+	REQUIRE(class_element);
+	element->SetId("id-set-before-any-selector");
+	class_element->SetClass("class-set-before-any-selector", true);
+	CHECK(element->GetId() == "id-set-before-any-selector");
+	CHECK(class_element->IsClassSet("class-set-before-any-selector"));
+	context->Update();
+	CHECK(element->GetProperty<float>("opacity") == 1.f);
+	CHECK(class_element->GetProperty<float>("opacity") == 1.f);
+
+	const String style_sheet = "body { font-family: LatoLatin; } #id-set-before-any-selector { opacity: 0.5; } "
+							   ".class-set-before-any-selector { opacity: 0.25; }";
+	document->SetStyleSheetContainer(Factory::InstanceStyleSheetString(style_sheet));
+	context->Update();
+	CHECK(element->GetProperty<float>("opacity") == 0.5f);
+	CHECK(class_element->GetProperty<float>("opacity") == 0.25f);
+	CHECK(document->GetElementById("id-set-before-any-selector") == element);
+	CHECK(class_element->GetClassNames() == "world class-set-before-any-selector");
+
+	context->UnloadDocument(document);
+	TestsShell::ShutdownShell();
+}
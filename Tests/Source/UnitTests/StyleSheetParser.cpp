@@ -27,7 +27,10 @@
  */
 
 #include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
 #include <RmlUi/Core/Spritesheet.h>
 #include <RmlUi/Core/StreamMemory.h>
 #include <RmlUi/Core/StyleSheet.h>
@@ -156,3 +159,41 @@ TEST_CASE("style_sheet_parser.spritesheet_with_path_string_encoding")
 
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("style_sheet_parser.comments_and_line_numbers")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	static const String document_rml = R"(<rml><head><style>
+div#a { width: 10px; /* Comment with tokens { } ; : */ height: 20px }
+div#b
+{
+	width: /* Comment
+	spanning lines. */ 30px;
+	font-family: "Lato/\"Latin\"";
+}
+/* Comment ending in multiple stars **/ div#c { width: 40px; }
+</style></head><body><div id="a"/><div id="b"/><div id="c"/></body></rml>)";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+
+	Element* a = document->GetElementById("a");
+	Element* b = document->GetElementById("b");
+	Element* c = document->GetElementById("c");
+
+	CHECK(a->GetProperty<float>("width") == 10.f);
+	CHECK(a->GetProperty<float>("height") == 20.f);
+	CHECK(b->GetProperty<float>("width") == 30.f);
+	CHECK(b->GetProperty<String>("font-family") == "Lato/\"Latin\"");
+	CHECK(c->GetProperty<float>("width") == 40.f);
+
+	// Line numbers refer to the opening brace of each rule.
+	const int line_a = a->GetProperty("width")->source->line_number;
+	CHECK(b->GetProperty("width")->source->line_number == line_a + 2);
+	CHECK(c->GetProperty("width")->source->line_number == line_a + 7);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
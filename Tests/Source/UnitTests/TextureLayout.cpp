@@ -0,0 +1,120 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../../Source/Core/TextureLayout.cpp"
+#include "../../../Source/Core/TextureLayoutRectangle.cpp"
+#include "../../../Source/Core/TextureLayoutRow.cpp"
+#include "../../../Source/Core/TextureLayoutTexture.cpp"
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static Vector2i GetRectangleDimensions(int id)
+{
+	return Vector2i(3 + (id * 7) % 13, 5 + (id * 11) % 17);
+}
+
+static void CheckLayoutValid(TextureLayout& layout)
+{
+	for (int i = 0; i < layout.GetNumRectangles(); i++)
+	{
+		TextureLayoutRectangle& a = layout.GetRectangle(i);
+		REQUIRE(a.IsPlaced());
+		REQUIRE(a.GetTextureIndex() < layout.GetNumTextures());
+
+		const Vector2i texture_dimensions = layout.GetTexture(a.GetTextureIndex()).GetDimensions();
+		CHECK(a.GetPosition().x >= 1);
+		CHECK(a.GetPosition().y >= 1);
+		CHECK(a.GetPosition().x + a.GetDimensions().x < texture_dimensions.x);
+		CHECK(a.GetPosition().y + a.GetDimensions().y < texture_dimensions.y);
+
+		for (int j = i + 1; j < layout.GetNumRectangles(); j++)
+		{
+			TextureLayoutRectangle& b = layout.GetRectangle(j);
+			if (a.GetTextureIndex() != b.GetTextureIndex())
+				continue;
+
+			const bool separated = (a.GetPosition().x + a.GetDimensions().x < b.GetPosition().x) ||
+				(b.GetPosition().x + b.GetDimensions().x < a.GetPosition().x) || (a.GetPosition().y + a.GetDimensions().y < b.GetPosition().y) ||
+				(b.GetPosition().y + b.GetDimensions().y < a.GetPosition().y);
+			CHECK_MESSAGE(separated, "Rectangles " << a.GetId() << " and " << b.GetId() << " overlap.");
+		}
+	}
+}
+
+TEST_CASE("TextureLayout.Extend")
+{
+	TextureLayout layout;
+
+	constexpr int num_initial_rectangles = 90;
+	for (int id = 0; id < num_initial_rectangles; id++)
+		layout.AddRectangle(id, GetRectangleDimensions(id));
+
+	REQUIRE(layout.GenerateLayout(1024));
+	REQUIRE(layout.GetNumTextures() == 1);
+	CheckLayoutValid(layout);
+
+	const Vector2i texture_dimensions = layout.GetTexture(0).GetDimensions();
+
+	Vector<Vector2i> initial_positions(num_initial_rectangles);
+	for (int i = 0; i < layout.GetNumRectangles(); i++)
+		initial_positions[layout.GetRectangle(i).GetId()] = layout.GetRectangle(i).GetPosition();
+
+	SUBCASE("NoNewRectangles")
+	{
+		CHECK(layout.ExtendLayout());
+		CHECK(layout.GetNumRectangles() == num_initial_rectangles);
+	}
+
+	SUBCASE("Fits")
+	{
+		constexpr int num_new_rectangles = 10;
+		for (int id = num_initial_rectangles; id < num_initial_rectangles + num_new_rectangles; id++)
+			layout.AddRectangle(id, Vector2i(4, 4));
+
+		REQUIRE(layout.ExtendLayout());
+		CHECK(layout.GetNumTextures() == 1);
+		CHECK(layout.GetTexture(0).GetDimensions() == texture_dimensions);
+		CheckLayoutValid(layout);
+
+		// The previously placed rectangles must keep both their index and position.
+		for (int i = 0; i < num_initial_rectangles; i++)
+		{
+			TextureLayoutRectangle& rectangle = layout.GetRectangle(i);
+			REQUIRE(rectangle.GetId() < num_initial_rectangles);
+			CHECK(rectangle.GetPosition() == initial_positions[rectangle.GetId()]);
+		}
+	}
+
+	SUBCASE("Overflow")
+	{
+		layout.AddRectangle(num_initial_rectangles, texture_dimensions);
+		CHECK_FALSE(layout.ExtendLayout());
+	}
+}
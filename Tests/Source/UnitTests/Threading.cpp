@@ -0,0 +1,218 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/PreparedDocument.h>
+#include <RmlUi/Core/StringUtilities.h>
+#include <atomic>
+#include <doctest.h>
+#include <thread>
+
+using namespace Rml;
+
+static const String document_threading_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+			font-family: LatoLatin;
+			font-size: 16px;
+		}
+		.item {
+			display: block;
+			height: 20px;
+			border: 1px #f00;
+		}
+		.odd {
+			decorator: linear-gradient(90deg, #f00, #00f);
+		}
+		.even {
+			box-shadow: #000 2px 2px 4px;
+			transition: opacity 1s;
+		}
+	</style>
+</head>
+
+<body>
+<div id="list"/>
+</body>
+</rml>
+)";
+
+namespace {
+class CountingListener : public EventListener {
+public:
+	void ProcessEvent(Event& /*event*/) override { num_events += 1; }
+	int num_events = 0;
+};
+} // namespace
+
+TEST_CASE("Threading.parallel_contexts")
+{
+	// Initializes the library and loads the fonts.
+	TestsShell::GetContext();
+
+	constexpr int num_contexts = 4;
+	constexpr int num_frames = 40;
+	const Vector2i window_size(800, 600);
+
+	// Contexts updated in parallel must use their own render interfaces.
+	TestsRenderInterface render_interfaces[num_contexts];
+	CountingListener listeners[num_contexts];
+	Context* contexts[num_contexts] = {};
+
+	for (int i = 0; i < num_contexts; i++)
+	{
+		contexts[i] = Rml::CreateContext(CreateString(64, "threading_%d", i), window_size, &render_interfaces[i]);
+		REQUIRE(contexts[i]);
+		ElementDocument* document = contexts[i]->LoadDocumentFromMemory(document_threading_rml);
+		REQUIRE(document);
+		document->Show();
+	}
+
+	Vector<std::thread> threads;
+	for (int i = 0; i < num_contexts; i++)
+	{
+		threads.emplace_back([i, context = contexts[i], listener = &listeners[i]]() {
+			ElementDocument* document = context->GetDocument(0);
+			Element* list = document->GetElementById("list");
+
+			// Custom event types are registered on first use, here concurrently from each context.
+			const String event_type = CreateString(64, "threading_event_%d", i);
+			list->AddEventListener(event_type, listener);
+
+			for (int frame = 0; frame < num_frames; frame++)
+			{
+				Element* item = list->AppendChild(document->CreateElement("div"));
+				item->SetClass("item", true);
+				item->SetClass(frame % 2 == 0 ? "even" : "odd", true);
+				item->SetProperty("width", CreateString(64, "%dpx", 100 + frame));
+				item->SetInnerRML(CreateString(64, "Context <em>%d</em>, frame %d", i, frame));
+				if (frame % 3 == 0)
+					item->SetProperty("opacity", "0.5");
+
+				item->DispatchEvent(event_type, {});
+
+				context->Update();
+				context->Render();
+			}
+		});
+	}
+
+	for (std::thread& thread : threads)
+		thread.join();
+
+	for (int i = 0; i < num_contexts; i++)
+	{
+		Element* list = contexts[i]->GetDocument(0)->GetElementById("list");
+		REQUIRE(list->GetNumChildren() == num_frames);
+
+		Element* last_item = list->GetLastChild();
+		CHECK(last_item->GetInnerRML() == CreateString(64, "Context <em>%d</em>, frame %d", i, num_frames - 1));
+		CHECK(last_item->GetBox().GetSize().x == doctest::Approx(100.f + float(num_frames - 1)));
+		// The emphasized text follows the formatted text of the first child.
+		Element* emphasis = last_item->GetChild(1);
+		REQUIRE(emphasis);
+		CHECK(emphasis->GetAbsoluteLeft() > last_item->GetAbsoluteLeft() + 10.f);
+
+		CHECK(listeners[i].num_events == num_frames);
+		CHECK(render_interfaces[i].GetCounters().render_geometry > 0);
+	}
+
+	for (int i = 0; i < num_contexts; i++)
+	{
+		Rml::RemoveContext(contexts[i]->GetName());
+		Rml::ReleaseTextures(&render_interfaces[i]);
+		Rml::ReleaseCompiledGeometry(&render_interfaces[i]);
+	}
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("Threading.prepare_document")
+{
+	Context* context = TestsShell::GetContext();
+	ElementDocument* running_document = context->LoadDocumentFromMemory(document_threading_rml);
+	REQUIRE(running_document);
+	running_document->Show();
+
+	// Make sure the linked style sheet is loaded by the worker thread.
+	Factory::ClearStyleSheetCache();
+
+	// Prepare the document while the context is being updated and rendered.
+	std::atomic<bool> prepared{false};
+	UniquePtr<PreparedDocument> prepared_document;
+	std::thread worker([&]() {
+		prepared_document = Rml::PrepareDocumentFromMemory(document_threading_rml, "threading.rml");
+		prepared = true;
+	});
+
+	int num_frames = 0;
+	while (!prepared || num_frames < 2)
+	{
+		running_document->GetElementById("list")->AppendChild(running_document->CreateElement("div"))->SetClass("item", true);
+		context->Update();
+		context->Render();
+		num_frames += 1;
+	}
+	worker.join();
+
+	REQUIRE(prepared_document);
+	CHECK(prepared_document->GetSourceURL() == "threading.rml");
+	REQUIRE(prepared_document->GetStyleSheetContainer().get() != nullptr);
+
+	ElementDocument* document = context->LoadDocument(*prepared_document);
+	REQUIRE(document);
+	CHECK(document->GetSourceURL() == "threading.rml");
+
+	Element* item = document->GetElementById("list")->AppendChild(document->CreateElement("div"));
+	item->SetClass("item", true);
+	document->Show();
+	context->Update();
+
+	CHECK(item->GetProperty<String>("font-family") == "LatoLatin");
+	CHECK(item->GetBox().GetSize().y == doctest::Approx(20.f));
+
+	document->Close();
+	running_document->Close();
+	prepared_document.reset();
+
+	TestsShell::ShutdownShell();
+}
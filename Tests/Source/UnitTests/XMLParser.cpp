@@ -145,3 +145,49 @@ TEST_CASE("XMLParser.escaping_tags")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+static const String document_comments_and_attributes = R"(
+<rml>
+    <head>
+	<style>
+	* { 
+		font-family: LatoLatin;
+	}
+	</style>
+    </head>
+    <body>
+	<!-- A comment with <tags>, - and -- inside --->
+	<p id="p" title="a &amp; b"
+		class="first second">Text<!----> with <!-- - -->comments</p>
+	<div id="div" title=""/>
+    </body>
+</rml>
+)";
+
+TEST_CASE("XMLParser.comments_and_attributes")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_comments_and_attributes);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	Element* p = document->GetElementById("p");
+	REQUIRE(p);
+	CHECK(p->GetAttribute<String>("title", "") == "a & b");
+	CHECK(p->IsClassSet("first"));
+	CHECK(p->IsClassSet("second"));
+	CHECK(p->GetInnerRML() == "Text with comments");
+
+	Element* div = document->GetElementById("div");
+	REQUIRE(div);
+	CHECK(div->HasAttribute("title"));
+	CHECK(div->GetAttribute<String>("title", "x") == "");
+	CHECK(div->GetNumChildren() == 0);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}